@@ -0,0 +1,29 @@
+/**
+ * @file    empty_profile_config.hpp
+ * @brief   Generated lsh-core static configuration. Edit the TOML source instead.
+ */
+
+// Generated by tools/generate_lsh_static_config.py from lsh_devices.toml. Do not edit by hand.
+
+#ifndef LSH_GENERATED_ALL_OPTIONS_CONFIGS_EMPTY_PROFILE_CONFIG_HPP
+#define LSH_GENERATED_ALL_OPTIONS_CONFIGS_EMPTY_PROFILE_CONFIG_HPP
+
+#define LSH_HARDWARE_INCLUDE <Arduino.h>
+#include LSH_HARDWARE_INCLUDE
+
+static constexpr auto LSH_DEVICE_NAME() -> const char *
+{
+    return "empty-profile";
+}
+
+static constexpr auto LSH_COM_SERIAL() -> HardwareSerial *
+{
+    return &Serial;
+}
+
+static constexpr auto LSH_DEBUG_SERIAL() -> HardwareSerial *
+{
+    return &Serial;
+}
+
+#endif  // LSH_GENERATED_ALL_OPTIONS_CONFIGS_EMPTY_PROFILE_CONFIG_HPP
@@ -0,0 +1,388 @@
+/**
+ * @file    empty_profile_static_config.hpp
+ * @brief   Generated lsh-core static configuration. Edit the TOML source instead.
+ */
+
+// Generated by tools/generate_lsh_static_config.py from lsh_devices.toml. Do not edit by hand.
+
+#if defined(LSH_STATIC_CONFIG_RESOURCE_PASS)
+
+#ifndef LSH_GENERATED_ALL_OPTIONS_CONFIGS_EMPTY_PROFILE_STATIC_CONFIG_HPP_RESOURCE
+#define LSH_GENERATED_ALL_OPTIONS_CONFIGS_EMPTY_PROFILE_STATIC_CONFIG_HPP_RESOURCE
+
+#define LSH_STATIC_CONFIG_CLICKABLES 0
+#define LSH_STATIC_CONFIG_ACTUATORS 0
+#define LSH_STATIC_CONFIG_INDICATORS 0
+#define LSH_STATIC_CONFIG_MAX_CLICKABLE_ID 1
+#define LSH_STATIC_CONFIG_MAX_ACTUATOR_ID 1
+#define LSH_STATIC_CONFIG_SHORT_CLICK_ACTUATOR_LINKS 0
+#define LSH_STATIC_CONFIG_LONG_CLICK_ACTUATOR_LINKS 0
+#define LSH_STATIC_CONFIG_SUPER_LONG_CLICK_ACTUATOR_LINKS 0
+#define LSH_STATIC_CONFIG_INDICATOR_ACTUATOR_LINKS 0
+#define LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS 0
+#define LSH_STATIC_CONFIG_PULSE_ACTUATORS 0
+#define LSH_STATIC_CONFIG_PRIORITY_INPUTS 0
+#define LSH_STATIC_CONFIG_TOUCH_KEYS 0
+#define LSH_STATIC_CONFIG_MATRIX_KEYS 0
+#define LSH_STATIC_CONFIG_ENCODERS 0
+#define LSH_STATIC_CONFIG_NETWORK_ENCODERS 0
+#define LSH_STATIC_CONFIG_OCCUPANCY_INPUTS 0
+#define LSH_STATIC_CONFIG_NETWORK_OCCUPANCY 0
+#define LSH_STATIC_CONFIG_TEMPERATURE_SENSORS 0
+#define LSH_STATIC_CONFIG_ONE_WIRE_BUSES 0
+#define LSH_STATIC_CONFIG_PEER_ADDRESS 0
+#define LSH_STATIC_CONFIG_ACTIVE_NETWORK_CLICKS 0
+#define LSH_STATIC_CONFIG_DISABLE_NETWORK_CLICKS 1
+
+#endif  // LSH_GENERATED_ALL_OPTIONS_CONFIGS_EMPTY_PROFILE_STATIC_CONFIG_HPP_RESOURCE
+
+#elif defined(LSH_STATIC_CONFIG_IMPLEMENTATION_PASS)
+
+#ifndef LSH_GENERATED_ALL_OPTIONS_CONFIGS_EMPTY_PROFILE_STATIC_CONFIG_HPP_IMPLEMENTATION
+#define LSH_GENERATED_ALL_OPTIONS_CONFIGS_EMPTY_PROFILE_STATIC_CONFIG_HPP_IMPLEMENTATION
+
+#include "communication/bridge_serial.hpp"
+#include "communication/bridge_transport.hpp"
+#include "config/static_config.hpp"
+#include "core/network_clicks.hpp"
+#include "device/actuator_manager.hpp"
+#include "device/clickable_manager.hpp"
+#include "device/indicator_manager.hpp"
+#include "internal/hot_loop_state.hpp"
+#include "lsh_user_macros.hpp"
+#include "util/constants/click_detection.hpp"
+#include "util/constants/click_results.hpp"
+#include "util/constants/click_types.hpp"
+#include "util/constants/timing.hpp"
+#include "util/debug/debug.hpp"
+#include "util/time_keeper.hpp"
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define LSH_STATIC_CONFIG_PROGMEM LSH_HOT_PROGMEM
+#define LSH_STATIC_CONFIG_READ_BYTE(address) pgm_read_byte(address)
+#else
+#define LSH_STATIC_CONFIG_PROGMEM
+#define LSH_STATIC_CONFIG_READ_BYTE(address) (*(address))
+#endif
+
+namespace
+{
+// clang-format off
+const uint8_t DETAILS_JSON_PAYLOAD[] LSH_STATIC_CONFIG_PROGMEM = {
+    0x7BU, 0x22U, 0x70U, 0x22U, 0x3AU, 0x31U, 0x2CU, 0x22U, 0x76U, 0x22U, 0x3AU, 0x33U,
+    0x2CU, 0x22U, 0x6EU, 0x22U, 0x3AU, 0x22U, 0x65U, 0x6DU, 0x70U, 0x74U, 0x79U, 0x2DU,
+    0x70U, 0x72U, 0x6FU, 0x66U, 0x69U, 0x6CU, 0x65U, 0x22U, 0x2CU, 0x22U, 0x61U, 0x22U,
+    0x3AU, 0x5BU, 0x5DU, 0x2CU, 0x22U, 0x62U, 0x22U, 0x3AU, 0x5BU, 0x5DU, 0x7DU, 0x0AU
+};
+
+const uint8_t DETAILS_MSGPACK_PAYLOAD[] LSH_STATIC_CONFIG_PROGMEM = {
+    0xC0U, 0x85U, 0xA1U, 0x70U, 0x01U, 0xA1U, 0x76U, 0x03U, 0xA1U, 0x6EU, 0xADU, 0x65U,
+    0x6DU, 0x70U, 0x74U, 0x79U, 0x2DU, 0x70U, 0x72U, 0x6FU, 0x66U, 0x69U, 0x6CU, 0x65U,
+    0xA1U, 0x61U, 0x90U, 0xA1U, 0x62U, 0x90U, 0xC0U
+};
+// clang-format on
+
+constexpr uint16_t LSH_STATIC_CONFIG_UNROLLED_PAYLOAD_LIMIT = 128U;
+
+template <uint16_t ByteIndex, uint16_t PayloadSize> struct GeneratedPayloadByteWriter
+{
+    static auto write(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
+    {
+        return BridgeTransport::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[ByteIndex])) == 1U &&
+               GeneratedPayloadByteWriter<static_cast<uint16_t>(ByteIndex + 1U), PayloadSize>::write(payload);
+    }
+};
+
+template <uint16_t PayloadSize> struct GeneratedPayloadByteWriter<PayloadSize, PayloadSize>
+{
+    static auto write(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
+    {
+        static_cast<void>(payload);
+        return true;
+    }
+};
+
+template <uint16_t PayloadSize> auto writeGeneratedPayloadLoop(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
+{
+    for (uint16_t byteIndex = 0U; byteIndex < PayloadSize; ++byteIndex)
+    {
+        if (BridgeTransport::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex])) != 1U)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <uint16_t PayloadSize> auto writeGeneratedPayload(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
+{
+    static_assert(PayloadSize > 0U, "Generated static payloads must not be empty.");
+    if constexpr (PayloadSize <= LSH_STATIC_CONFIG_UNROLLED_PAYLOAD_LIMIT)
+    {
+        return GeneratedPayloadByteWriter<0U, PayloadSize>::write(payload);
+    }
+    return writeGeneratedPayloadLoop(payload);
+}
+}  // namespace
+
+namespace lsh::core::static_config
+{
+auto getActuatorId(uint8_t actuatorIndex) noexcept -> uint8_t
+{
+    static_cast<void>(actuatorIndex);
+    return 0U;
+}
+
+auto getClickableId(uint8_t clickableIndex) noexcept -> uint8_t
+{
+    static_cast<void>(clickableIndex);
+    return 0U;
+}
+
+auto getActuatorIndexById(uint8_t actuatorId) noexcept -> uint8_t
+{
+    static_cast<void>(actuatorId);
+    return UINT8_MAX;
+}
+
+auto getClickableIndexById(uint8_t clickableId) noexcept -> uint8_t
+{
+    static_cast<void>(clickableId);
+    return UINT8_MAX;
+}
+
+auto getAutoOffActuatorIndex(uint8_t autoOffIndex) noexcept -> uint8_t
+{
+    static_cast<void>(autoOffIndex);
+    return UINT8_MAX;
+}
+
+auto getAutoOffIndexByActuatorIndex(uint8_t actuatorIndex) noexcept -> uint8_t
+{
+    static_cast<void>(actuatorIndex);
+    return UINT8_MAX;
+}
+
+auto getAutoOffTimer(uint8_t actuatorIndex) noexcept -> uint32_t
+{
+    static_cast<void>(actuatorIndex);
+    return 0UL;
+}
+
+auto getIndicatorActuatorLinkCount(uint8_t indicatorIndex) noexcept -> uint8_t
+{
+    static_cast<void>(indicatorIndex);
+    return 0U;
+}
+
+auto writeDetailsPayload() noexcept -> bool
+{
+#ifdef CONFIG_MSG_PACK
+    return writeGeneratedPayload(DETAILS_MSGPACK_PAYLOAD);
+#else
+    return writeGeneratedPayload(DETAILS_JSON_PAYLOAD);
+#endif
+}
+
+auto writeNetworkClickRequestPrefix(uint8_t slotIndex, bool timestamped) noexcept -> bool
+{
+    static_cast<void>(slotIndex);
+    static_cast<void>(timestamped);
+    return false;
+}
+
+auto runShortClick(uint8_t clickableIndex) noexcept -> bool
+{
+    static_cast<void>(clickableIndex);
+    return false;
+}
+
+auto runLongClick(uint8_t clickableIndex) noexcept -> bool
+{
+    static_cast<void>(clickableIndex);
+    return false;
+}
+
+auto turnOffAllActuators() noexcept -> bool
+{
+    return false;
+}
+
+auto turnOffUnprotectedActuators() noexcept -> bool
+{
+    return false;
+}
+
+auto runSuperLongClick(uint8_t clickableIndex) noexcept -> bool
+{
+    static_cast<void>(clickableIndex);
+    return false;
+}
+
+auto runClick(uint8_t clickableIndex, constants::ClickType clickType) noexcept -> bool
+{
+    switch (clickType)
+    {
+    case constants::ClickType::SHORT:
+        return runShortClick(clickableIndex);
+    case constants::ClickType::LONG:
+        return runLongClick(clickableIndex);
+    case constants::ClickType::SUPER_LONG:
+        return runSuperLongClick(clickableIndex);
+    default:
+        return false;
+    }
+}
+
+auto runNetworkClickFallback(uint8_t clickableIndex, constants::ClickType clickType) noexcept -> bool
+{
+    static_cast<void>(clickableIndex);
+    static_cast<void>(clickType);
+    return false;
+}
+
+auto getNetworkClickSlotCount(uint8_t clickableIndex) noexcept -> uint8_t
+{
+    static_cast<void>(clickableIndex);
+    return 0U;
+}
+
+auto getNetworkClickSlotIndex(uint8_t clickableIndex, constants::ClickType clickType) noexcept -> uint8_t
+{
+    static_cast<void>(clickableIndex);
+    static_cast<void>(clickType);
+    return UINT8_MAX;
+}
+
+auto getNetworkClickClickableIndex(uint8_t slotIndex) noexcept -> uint8_t
+{
+    static_cast<void>(slotIndex);
+    return UINT8_MAX;
+}
+
+auto getNetworkClickType(uint8_t slotIndex) noexcept -> constants::ClickType
+{
+    static_cast<void>(slotIndex);
+    return constants::ClickType::NONE;
+}
+
+auto getNetworkClickQueueDepth(uint8_t slotIndex) noexcept -> uint8_t
+{
+    static_cast<void>(slotIndex);
+    return 0U;
+}
+
+auto isClickableConfigurationValid(uint8_t clickableIndex) noexcept -> bool
+{
+    static_cast<void>(clickableIndex);
+    return false;
+}
+
+auto setActuatorStateById(uint8_t actuatorId, bool state) noexcept -> bool
+{
+    static_cast<void>(actuatorId);
+    static_cast<void>(state);
+    return false;
+}
+
+auto scanClickables(uint16_t elapsed_ms) noexcept -> uint8_t
+{
+    static_cast<void>(elapsed_ms);
+    return 0U;
+}
+
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+auto getBounceProfile(uint8_t clickableIndex) noexcept -> const BounceProfile *
+{
+    static_cast<void>(clickableIndex);
+    return nullptr;
+}
+#endif
+
+auto checkPulseTimers(uint16_t elapsed_ms) noexcept -> bool
+{
+    static_cast<void>(elapsed_ms);
+    return false;
+}
+
+auto reconcilePriorityInputs() noexcept -> bool
+{
+    return false;
+}
+
+auto drainEncoders() noexcept -> bool
+{
+    return false;
+}
+
+auto scanOccupancy() noexcept -> bool
+{
+    return false;
+}
+
+void reportOccupancy() noexcept
+{
+}
+
+void pollOneWire(uint16_t elapsed_ms) noexcept
+{
+    static_cast<void>(elapsed_ms);
+}
+
+auto checkAutoOffTimers(uint32_t now_ms) noexcept -> bool
+{
+    static_cast<void>(now_ms);
+    return false;
+}
+
+auto getActiveTimer(uint8_t timerIndex, uint32_t now_ms, uint8_t &actuatorId, uint32_t &remaining_ms) noexcept -> bool
+{
+    static_cast<void>(timerIndex);
+    static_cast<void>(now_ms);
+    static_cast<void>(actuatorId);
+    static_cast<void>(remaining_ms);
+    return false;
+}
+
+auto applyPackedActuatorStateByte(uint8_t byteIndex, uint8_t packedByte) noexcept -> bool
+{
+    static_cast<void>(byteIndex);
+    static_cast<void>(packedByte);
+    return false;
+}
+
+auto actuatorTopologyFingerprint() noexcept -> uint32_t
+{
+    return 2166136261UL;
+}
+
+auto computeIndicatorState(uint8_t indicatorIndex) noexcept -> bool
+{
+    static_cast<void>(indicatorIndex);
+    return false;
+}
+
+void refreshIndicators() noexcept
+{
+    return;
+}
+}  // namespace lsh::core::static_config
+
+void Configurator::configure()
+{
+    using namespace Debug;
+
+    DP_CONTEXT();
+
+    Actuators::packedActuatorStates[0U] = 0U;
+}
+
+#undef LSH_STATIC_CONFIG_READ_BYTE
+#undef LSH_STATIC_CONFIG_PROGMEM
+
+#endif  // LSH_GENERATED_ALL_OPTIONS_CONFIGS_EMPTY_PROFILE_STATIC_CONFIG_HPP_IMPLEMENTATION
+
+#else
+#error "empty_profile_static_config.hpp must be included through a static-config pass macro."
+#endif
@@ -0,0 +1,34 @@
+/**
+ * @file    maximal_panel_config.hpp
+ * @brief   Generated lsh-core static configuration. Edit the TOML source instead.
+ */
+
+// Generated by tools/generate_lsh_static_config.py from lsh_devices.toml. Do not edit by hand.
+
+#ifndef LSH_GENERATED_CUSTOM_MAXIMAL_PANEL_CONFIG_HPP
+#define LSH_GENERATED_CUSTOM_MAXIMAL_PANEL_CONFIG_HPP
+
+#define LSH_HARDWARE_INCLUDE <Controllino.h>
+#include LSH_HARDWARE_INCLUDE
+
+static constexpr auto LSH_DEVICE_NAME() -> const char *
+{
+    return "maximal-panel";
+}
+
+static constexpr auto LSH_COM_SERIAL() -> HardwareSerial *
+{
+    return &Serial1;
+}
+
+static constexpr auto LSH_DEBUG_SERIAL() -> HardwareSerial *
+{
+    return &Serial;
+}
+
+static constexpr auto LSH_PEER_SERIAL() -> HardwareSerial *
+{
+    return &Serial3;
+}
+
+#endif  // LSH_GENERATED_CUSTOM_MAXIMAL_PANEL_CONFIG_HPP
@@ -0,0 +1,2042 @@
+/**
+ * @file    maximal_panel_static_config.hpp
+ * @brief   Generated lsh-core static configuration. Edit the TOML source instead.
+ */
+
+// Generated by tools/generate_lsh_static_config.py from lsh_devices.toml. Do not edit by hand.
+
+#if defined(LSH_STATIC_CONFIG_RESOURCE_PASS)
+
+#ifndef LSH_GENERATED_CUSTOM_MAXIMAL_PANEL_STATIC_CONFIG_HPP_RESOURCE
+#define LSH_GENERATED_CUSTOM_MAXIMAL_PANEL_STATIC_CONFIG_HPP_RESOURCE
+
+#define LSH_STATIC_CONFIG_CLICKABLES 10
+#define LSH_STATIC_CONFIG_ACTUATORS 7
+#define LSH_STATIC_CONFIG_INDICATORS 3
+#define LSH_STATIC_CONFIG_MAX_CLICKABLE_ID 24
+#define LSH_STATIC_CONFIG_MAX_ACTUATOR_ID 250
+#define LSH_STATIC_CONFIG_SHORT_CLICK_ACTUATOR_LINKS 9
+#define LSH_STATIC_CONFIG_LONG_CLICK_ACTUATOR_LINKS 10
+#define LSH_STATIC_CONFIG_SUPER_LONG_CLICK_ACTUATOR_LINKS 3
+#define LSH_STATIC_CONFIG_INDICATOR_ACTUATOR_LINKS 7
+#define LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS 2
+#define LSH_STATIC_CONFIG_PULSE_ACTUATORS 1
+#define LSH_STATIC_CONFIG_PRIORITY_INPUTS 1
+#define LSH_STATIC_CONFIG_TOUCH_KEYS 1
+#define LSH_STATIC_CONFIG_MATRIX_KEYS 2
+#define LSH_STATIC_CONFIG_ENCODERS 1
+#define LSH_STATIC_CONFIG_NETWORK_ENCODERS 1
+#define LSH_STATIC_CONFIG_OCCUPANCY_INPUTS 1
+#define LSH_STATIC_CONFIG_NETWORK_OCCUPANCY 1
+#define LSH_STATIC_CONFIG_TEMPERATURE_SENSORS 2
+#define LSH_STATIC_CONFIG_ONE_WIRE_BUSES 1
+#define LSH_STATIC_CONFIG_PEER_ADDRESS 1
+#define LSH_STATIC_CONFIG_ACTIVE_NETWORK_CLICKS 3
+#define LSH_STATIC_CONFIG_DISABLE_NETWORK_CLICKS 0
+
+#endif  // LSH_GENERATED_CUSTOM_MAXIMAL_PANEL_STATIC_CONFIG_HPP_RESOURCE
+
+#elif defined(LSH_STATIC_CONFIG_IMPLEMENTATION_PASS)
+
+#ifndef LSH_GENERATED_CUSTOM_MAXIMAL_PANEL_STATIC_CONFIG_HPP_IMPLEMENTATION
+#define LSH_GENERATED_CUSTOM_MAXIMAL_PANEL_STATIC_CONFIG_HPP_IMPLEMENTATION
+
+#include "communication/bridge_serial.hpp"
+#include "communication/bridge_transport.hpp"
+#include "communication/bridge_sync.hpp"
+#include "communication/serializer.hpp"
+#include "communication/peer_link.hpp"
+#include "config/static_config.hpp"
+#include "core/network_clicks.hpp"
+#include "device/actuator_manager.hpp"
+#include "device/clickable_manager.hpp"
+#include "device/indicator_manager.hpp"
+#include "internal/hot_loop_state.hpp"
+#include "lsh_user_macros.hpp"
+#include "util/constants/click_detection.hpp"
+#include "util/constants/click_results.hpp"
+#include "util/constants/click_types.hpp"
+#include "util/constants/timing.hpp"
+#include "util/debug/debug.hpp"
+#include "util/time_keeper.hpp"
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define LSH_STATIC_CONFIG_PROGMEM LSH_HOT_PROGMEM
+#define LSH_STATIC_CONFIG_READ_BYTE(address) pgm_read_byte(address)
+#else
+#define LSH_STATIC_CONFIG_PROGMEM
+#define LSH_STATIC_CONFIG_READ_BYTE(address) (*(address))
+#endif
+
+namespace
+{
+// clang-format off
+const uint8_t NETWORK_CLICK_REQUEST_JSON_PREFIX_0[] LSH_STATIC_CONFIG_PROGMEM = {
+    0x7BU, 0x22U, 0x70U, 0x22U, 0x3AU, 0x33U, 0x2CU, 0x22U, 0x74U, 0x22U, 0x3AU, 0x31U,
+    0x2CU, 0x22U, 0x69U, 0x22U, 0x3AU, 0x34U, 0x2CU, 0x22U, 0x63U, 0x22U, 0x3AU
+};
+
+const uint8_t NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_0[] LSH_STATIC_CONFIG_PROGMEM = {
+    0xC0U, 0x84U, 0xA1U, 0x70U, 0x03U, 0xA1U, 0x74U, 0x01U, 0xA1U, 0x69U, 0x04U, 0xA1U,
+    0x63U
+};
+
+const uint8_t NETWORK_CLICK_REQUEST_JSON_PREFIX_1[] LSH_STATIC_CONFIG_PROGMEM = {
+    0x7BU, 0x22U, 0x70U, 0x22U, 0x3AU, 0x33U, 0x2CU, 0x22U, 0x74U, 0x22U, 0x3AU, 0x32U,
+    0x2CU, 0x22U, 0x69U, 0x22U, 0x3AU, 0x34U, 0x2CU, 0x22U, 0x63U, 0x22U, 0x3AU
+};
+
+const uint8_t NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_1[] LSH_STATIC_CONFIG_PROGMEM = {
+    0xC0U, 0x84U, 0xA1U, 0x70U, 0x03U, 0xA1U, 0x74U, 0x02U, 0xA1U, 0x69U, 0x04U, 0xA1U,
+    0x63U
+};
+
+const uint8_t NETWORK_CLICK_REQUEST_JSON_PREFIX_2[] LSH_STATIC_CONFIG_PROGMEM = {
+    0x7BU, 0x22U, 0x70U, 0x22U, 0x3AU, 0x33U, 0x2CU, 0x22U, 0x74U, 0x22U, 0x3AU, 0x31U,
+    0x2CU, 0x22U, 0x69U, 0x22U, 0x3AU, 0x31U, 0x31U, 0x2CU, 0x22U, 0x63U, 0x22U, 0x3AU
+};
+
+const uint8_t NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_2[] LSH_STATIC_CONFIG_PROGMEM = {
+    0xC0U, 0x84U, 0xA1U, 0x70U, 0x03U, 0xA1U, 0x74U, 0x01U, 0xA1U, 0x69U, 0x0BU, 0xA1U,
+    0x63U
+};
+// clang-format on
+
+// clang-format off
+const uint8_t DETAILS_JSON_PAYLOAD[] LSH_STATIC_CONFIG_PROGMEM = {
+    0x7BU, 0x22U, 0x70U, 0x22U, 0x3AU, 0x31U, 0x2CU, 0x22U, 0x76U, 0x22U, 0x3AU, 0x33U,
+    0x2CU, 0x22U, 0x6EU, 0x22U, 0x3AU, 0x22U, 0x6DU, 0x61U, 0x78U, 0x69U, 0x6DU, 0x61U,
+    0x6CU, 0x2DU, 0x70U, 0x61U, 0x6EU, 0x65U, 0x6CU, 0x22U, 0x2CU, 0x22U, 0x61U, 0x22U,
+    0x3AU, 0x5BU, 0x31U, 0x2CU, 0x33U, 0x2CU, 0x39U, 0x2CU, 0x32U, 0x35U, 0x30U, 0x2CU,
+    0x31U, 0x32U, 0x2CU, 0x31U, 0x33U, 0x2CU, 0x31U, 0x34U, 0x5DU, 0x2CU, 0x22U, 0x62U,
+    0x22U, 0x3AU, 0x5BU, 0x31U, 0x2CU, 0x34U, 0x2CU, 0x37U, 0x2CU, 0x31U, 0x31U, 0x2CU,
+    0x31U, 0x39U, 0x2CU, 0x32U, 0x30U, 0x2CU, 0x32U, 0x31U, 0x2CU, 0x32U, 0x32U, 0x2CU,
+    0x32U, 0x33U, 0x2CU, 0x32U, 0x34U, 0x5DU, 0x7DU, 0x0AU
+};
+
+const uint8_t DETAILS_MSGPACK_PAYLOAD[] LSH_STATIC_CONFIG_PROGMEM = {
+    0xC0U, 0x85U, 0xA1U, 0x70U, 0x01U, 0xA1U, 0x76U, 0x03U, 0xA1U, 0x6EU, 0xADU, 0x6DU,
+    0x61U, 0x78U, 0x69U, 0x6DU, 0x61U, 0x6CU, 0x2DU, 0x70U, 0x61U, 0x6EU, 0x65U, 0x6CU,
+    0xA1U, 0x61U, 0x97U, 0x01U, 0x03U, 0x09U, 0xCCU, 0xFAU, 0x0CU, 0x0DU, 0x0EU, 0xA1U,
+    0x62U, 0x9AU, 0x01U, 0x04U, 0x07U, 0x0BU, 0x13U, 0x14U, 0x15U, 0x16U, 0x17U, 0x18U,
+    0xC0U
+};
+// clang-format on
+
+constexpr uint16_t LSH_STATIC_CONFIG_UNROLLED_PAYLOAD_LIMIT = 128U;
+
+template <uint16_t ByteIndex, uint16_t PayloadSize> struct GeneratedPayloadByteWriter
+{
+    static auto write(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
+    {
+        return BridgeTransport::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[ByteIndex])) == 1U &&
+               GeneratedPayloadByteWriter<static_cast<uint16_t>(ByteIndex + 1U), PayloadSize>::write(payload);
+    }
+};
+
+template <uint16_t PayloadSize> struct GeneratedPayloadByteWriter<PayloadSize, PayloadSize>
+{
+    static auto write(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
+    {
+        static_cast<void>(payload);
+        return true;
+    }
+};
+
+template <uint16_t PayloadSize> auto writeGeneratedPayloadLoop(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
+{
+    for (uint16_t byteIndex = 0U; byteIndex < PayloadSize; ++byteIndex)
+    {
+        if (BridgeTransport::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex])) != 1U)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <uint16_t PayloadSize> auto writeGeneratedPayload(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
+{
+    static_assert(PayloadSize > 0U, "Generated static payloads must not be empty.");
+    if constexpr (PayloadSize <= LSH_STATIC_CONFIG_UNROLLED_PAYLOAD_LIMIT)
+    {
+        return GeneratedPayloadByteWriter<0U, PayloadSize>::write(payload);
+    }
+    return writeGeneratedPayloadLoop(payload);
+}
+
+template <uint16_t PayloadSize> auto writeGeneratedMsgPackMapPrefix(const uint8_t (&payload)[PayloadSize], bool extraKey) noexcept -> bool
+{
+    // Byte 0 is the frame delimiter, byte 1 the fixmap header.
+    for (uint16_t byteIndex = 0U; byteIndex < PayloadSize; ++byteIndex)
+    {
+        uint8_t byte = LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex]);
+        if (byteIndex == 1U && extraKey)
+        {
+            ++byte;
+        }
+        if (BridgeTransport::write(byte) != 1U)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+Actuator actuator0_ceiling(::lsh::core::PinTag<(CONTROLLINO_R0)>{}, true);
+LSH_ACTUATOR(actuator1_wall, CONTROLLINO_R1);
+LSH_ACTUATOR(actuator2_fan, CONTROLLINO_R2);
+LSH_ACTUATOR(actuator3_garden, CONTROLLINO_R3);
+LSH_ACTUATOR(actuator4_pump_a, CONTROLLINO_R4);
+LSH_ACTUATOR(actuator5_pump_b, CONTROLLINO_R5);
+LSH_ACTUATOR(actuator6_door_strike, CONTROLLINO_R6);
+
+LSH_BUTTON(button0_entry_button, CONTROLLINO_A0);
+LSH_BUTTON(button1_scene_button, CONTROLLINO_A1);
+LSH_BUTTON(button2_off_button, CONTROLLINO_A2);
+LSH_BUTTON(button3_network_only_button, CONTROLLINO_A3);
+LSH_BUTTON(button4_alias_button, CONTROLLINO_A4);
+LSH_BUTTON(button5_pump_button, CONTROLLINO_A5);
+LSH_BUTTON(button6_emergency_button, CONTROLLINO_IN0);
+LSH_BUTTON(button7_touch_pad, CONTROLLINO_A8);
+LSH_MATRIX_BUTTON(button8_matrix_fan);
+LSH_MATRIX_BUTTON(button9_matrix_garden);
+
+LSH_INDICATOR(indicator0_any_led, CONTROLLINO_D0);
+LSH_INDICATOR(indicator1_all_led, CONTROLLINO_D1);
+LSH_INDICATOR(indicator2_majority_led, CONTROLLINO_D2);
+
+LSH_ENCODER(encoder0_living_knob, CONTROLLINO_IN1, 21);
+
+void encoder0_living_knobIsr() noexcept
+{
+    encoder0_living_knob.onPinChange(::lsh::core::PinTag<(CONTROLLINO_IN1)>{}, ::lsh::core::PinTag<(21)>{});
+}
+
+LSH_OCCUPANCY(occupancy0_hall_pir, CONTROLLINO_A6);
+
+const uint8_t oneWireBus0Ids[] LSH_STATIC_CONFIG_PROGMEM = {
+    0x01U, 0x02U
+};
+const uint8_t oneWireBus0Roms[] LSH_STATIC_CONFIG_PROGMEM = {
+    0x28U, 0xFFU, 0x64U, 0x1EU, 0x0FU, 0x16U, 0x03U, 0x90U, 0x28U, 0xAAU, 0x3CU, 0x51U,
+    0x1AU, 0x13U, 0x02U, 0x5AU
+};
+int16_t oneWireBus0Readings[2] = {};
+LSH_ONE_WIRE_BUS(oneWireBus0, CONTROLLINO_A7, 2U, oneWireBus0Ids, oneWireBus0Roms, oneWireBus0Readings);
+
+volatile uint8_t priorityInputsPending = 0U;
+
+void button6_emergency_buttonPriorityIsr() noexcept
+{
+    actuator4_pump_a.driveOffFromIsr();
+    actuator5_pump_b.driveOffFromIsr();
+    actuator6_door_strike.driveOffFromIsr();
+    priorityInputsPending |= 1U;
+}
+
+LSH_TOUCH_KEY(button7_touch_padTouch);
+volatile uint16_t touchSamples[1] = {};
+volatile uint8_t touchStep = TouchSense::SWEEP_IDLE;
+
+void serviceTouchKeys() noexcept
+{
+    const uint8_t step = touchStep;
+    if (step != TouchSense::SWEEP_IDLE && step != 2U)
+    {
+        return;
+    }
+    if (step == 2U)
+    {
+        button7_touch_padTouch.update<32U>(touchSamples[0]);
+    }
+    touchStep = 0U;
+    TouchSense::startSweep(::lsh::core::PinTag<(CONTROLLINO_A8)>{});
+}
+
+LSH_KEY_MATRIX(keyMatrix, 2U, true);
+
+void startKeyMatrix() noexcept
+{
+    static_assert(!KeyMatrixIo::isCompareOutputPin((CONTROLLINO_D3)), "The OC0B pin cannot be a key matrix line.");
+    static_assert(!KeyMatrixIo::isCompareOutputPin((CONTROLLINO_D4)), "The OC0B pin cannot be a key matrix line.");
+    static_assert(!KeyMatrixIo::isCompareOutputPin((CONTROLLINO_D5)), "The OC0B pin cannot be a key matrix line.");
+    static_assert(!KeyMatrixIo::isCompareOutputPin((CONTROLLINO_D6)), "The OC0B pin cannot be a key matrix line.");
+    KeyMatrixIo::pullUpColumn(::lsh::core::PinTag<(CONTROLLINO_D5)>{});
+    KeyMatrixIo::pullUpColumn(::lsh::core::PinTag<(CONTROLLINO_D6)>{});
+    KeyMatrixIo::idleRow(::lsh::core::PinTag<(CONTROLLINO_D3)>{});
+    KeyMatrixIo::idleRow(::lsh::core::PinTag<(CONTROLLINO_D4)>{});
+    KeyMatrixIo::driveRow(::lsh::core::PinTag<(CONTROLLINO_D3)>{});
+    KeyMatrixIo::startTimer();
+}
+}  // namespace
+
+ISR(TIMER5_COMPA_vect)
+{
+    oneWireBus0.onTimer(::lsh::core::PinTag<(CONTROLLINO_A7)>{});
+}
+
+ISR(ADC_vect)
+{
+    const uint8_t step = touchStep;
+    // A conversion outside a running sweep must not start or advance one.
+    if (step >= 2U)
+    {
+        return;
+    }
+    touchStep = static_cast<uint8_t>(step + 1U);
+    switch (step)
+    {
+    case 0U:
+        TouchSense::shareCharge(::lsh::core::PinTag<(CONTROLLINO_A8)>{});
+        break;
+    case 1U:
+        touchSamples[0] = ADC;
+        TouchSense::finishSweep();
+        break;
+    default:
+        break;
+    }
+}
+
+ISR(TIMER0_COMPB_vect)
+{
+    uint8_t columns = 0U;
+    columns |= KeyMatrixIo::columnBit(::lsh::core::PinTag<(CONTROLLINO_D5)>{}, 0U);
+    columns |= KeyMatrixIo::columnBit(::lsh::core::PinTag<(CONTROLLINO_D6)>{}, 1U);
+    switch (keyMatrix.sample(columns))
+    {
+    case 0U:
+        KeyMatrixIo::releaseRow(::lsh::core::PinTag<(CONTROLLINO_D3)>{});
+        KeyMatrixIo::driveRow(::lsh::core::PinTag<(CONTROLLINO_D4)>{});
+        break;
+    case 1U:
+        KeyMatrixIo::releaseRow(::lsh::core::PinTag<(CONTROLLINO_D4)>{});
+        KeyMatrixIo::driveRow(::lsh::core::PinTag<(CONTROLLINO_D3)>{});
+        break;
+    default:
+        break;
+    }
+}
+
+namespace lsh::core::static_config
+{
+auto getActuatorId(uint8_t actuatorIndex) noexcept -> uint8_t
+{
+    if (actuatorIndex == 0U)
+    {
+        return 1U;
+    }
+
+    if (actuatorIndex == 1U)
+    {
+        return 3U;
+    }
+
+    if (actuatorIndex == 2U)
+    {
+        return 9U;
+    }
+
+    if (actuatorIndex == 3U)
+    {
+        return 250U;
+    }
+
+    return actuatorIndex >= 4U && actuatorIndex <= 6U ? static_cast<uint8_t>(actuatorIndex + 8U) : 0U;
+}
+
+auto getClickableId(uint8_t clickableIndex) noexcept -> uint8_t
+{
+    if (clickableIndex == 0U)
+    {
+        return 1U;
+    }
+
+    if (clickableIndex == 1U)
+    {
+        return 4U;
+    }
+
+    if (clickableIndex == 2U)
+    {
+        return 7U;
+    }
+
+    if (clickableIndex == 3U)
+    {
+        return 11U;
+    }
+
+    return clickableIndex >= 4U && clickableIndex <= 9U ? static_cast<uint8_t>(clickableIndex + 15U) : 0U;
+}
+
+auto getActuatorIndexById(uint8_t actuatorId) noexcept -> uint8_t
+{
+    switch (actuatorId)
+    {
+    case 1U:
+        return 0U;
+    case 3U:
+        return 1U;
+    case 9U:
+        return 2U;
+    case 12U:
+        return 4U;
+    case 13U:
+        return 5U;
+    case 14U:
+        return 6U;
+    case 250U:
+        return 3U;
+    default:
+        return UINT8_MAX;
+    }
+}
+
+auto getClickableIndexById(uint8_t clickableId) noexcept -> uint8_t
+{
+    switch (clickableId)
+    {
+    case 1U:
+        return 0U;
+    case 4U:
+        return 1U;
+    case 7U:
+        return 2U;
+    case 11U:
+        return 3U;
+    case 19U:
+        return 4U;
+    case 20U:
+        return 5U;
+    case 21U:
+        return 6U;
+    case 22U:
+        return 7U;
+    case 23U:
+        return 8U;
+    case 24U:
+        return 9U;
+    default:
+        return UINT8_MAX;
+    }
+}
+
+auto getAutoOffActuatorIndex(uint8_t autoOffIndex) noexcept -> uint8_t
+{
+    return autoOffIndex < 2U ? autoOffIndex : UINT8_MAX;
+}
+
+auto getAutoOffIndexByActuatorIndex(uint8_t actuatorIndex) noexcept -> uint8_t
+{
+    return actuatorIndex < 2U ? actuatorIndex : UINT8_MAX;
+}
+
+auto getAutoOffTimer(uint8_t actuatorIndex) noexcept -> uint32_t
+{
+    if (actuatorIndex == 0U)
+    {
+        return 600000UL;
+    }
+
+    return actuatorIndex == 1U ? 45000UL : 0UL;
+}
+
+auto getIndicatorActuatorLinkCount(uint8_t indicatorIndex) noexcept -> uint8_t
+{
+    if (indicatorIndex < 2U)
+    {
+        return 2U;
+    }
+
+    if (indicatorIndex == 2U)
+    {
+        return 3U;
+    }
+
+    return 0U;
+}
+
+auto writeDetailsPayload() noexcept -> bool
+{
+#ifdef CONFIG_MSG_PACK
+    return writeGeneratedPayload(DETAILS_MSGPACK_PAYLOAD);
+#else
+    return writeGeneratedPayload(DETAILS_JSON_PAYLOAD);
+#endif
+}
+
+auto writeNetworkClickRequestPrefix(uint8_t slotIndex, bool timestamped) noexcept -> bool
+{
+#ifdef CONFIG_MSG_PACK
+    switch (slotIndex)
+    {
+    case 0U:
+        return writeGeneratedMsgPackMapPrefix(NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_0, timestamped);
+    case 1U:
+        return writeGeneratedMsgPackMapPrefix(NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_1, timestamped);
+    case 2U:
+        return writeGeneratedMsgPackMapPrefix(NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_2, timestamped);
+    default:
+        return false;
+    }
+#else
+    // JSON appends `m` after the correlation value: same prefix.
+    static_cast<void>(timestamped);
+    switch (slotIndex)
+    {
+    case 0U:
+        return writeGeneratedPayloadLoop(NETWORK_CLICK_REQUEST_JSON_PREFIX_0);
+    case 1U:
+        return writeGeneratedPayloadLoop(NETWORK_CLICK_REQUEST_JSON_PREFIX_1);
+    case 2U:
+        return writeGeneratedPayloadLoop(NETWORK_CLICK_REQUEST_JSON_PREFIX_2);
+    default:
+        return false;
+    }
+#endif
+}
+
+static uint16_t pulseRemaining_ms[CONFIG_PULSE_STORAGE_CAPACITY] = {};
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionSet(bool state) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionSet(bool state, uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionToggle() noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionToggle(uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator1_wallActionSet(bool state) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator1_wallActionSet(bool state, uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator1_wallActionToggle() noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator1_wallActionToggle(uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator2_fanActionSet(bool state) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator2_fanActionSet(bool state, uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator2_fanActionToggle() noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator2_fanActionToggle(uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator3_gardenActionSet(bool state) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator3_gardenActionSet(bool state, uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator3_gardenActionToggle() noexcept -> bool;
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator3_gardenActionToggle(uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] inline auto actuator4_pump_aActionSet(bool state) noexcept -> bool;
+[[nodiscard]] inline auto actuator4_pump_aActionSet(bool state, uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] inline auto actuator4_pump_aActionToggle() noexcept -> bool;
+[[nodiscard]] inline auto actuator4_pump_aActionToggle(uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] inline auto actuator5_pump_bActionSet(bool state) noexcept -> bool;
+[[nodiscard]] inline auto actuator5_pump_bActionSet(bool state, uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] inline auto actuator5_pump_bActionToggle() noexcept -> bool;
+[[nodiscard]] inline auto actuator5_pump_bActionToggle(uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] inline auto actuator6_door_strikeActionSet(bool state) noexcept -> bool;
+[[nodiscard]] inline auto actuator6_door_strikeActionSet(bool state, uint32_t actionNow) noexcept -> bool;
+[[nodiscard]] inline auto actuator6_door_strikeActionToggle() noexcept -> bool;
+[[nodiscard]] inline auto actuator6_door_strikeActionToggle(uint32_t actionNow) noexcept -> bool;
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionSet(bool state) noexcept -> bool
+{
+    return actuator0_ceiling.setStateStatic<0U>(state);
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionSet(bool state, uint32_t actionNow) noexcept -> bool
+{
+    bool anyActuatorChangedState = false;
+    anyActuatorChangedState |= actuator0_ceiling.setStateStatic<0U>(state, actionNow);
+    return anyActuatorChangedState;
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionToggle() noexcept -> bool
+{
+    return actuator0_ceiling.toggleStateStatic<0U>();
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionToggle(uint32_t actionNow) noexcept -> bool
+{
+    return actuator0_ceilingActionSet(!actuator0_ceiling.getState(), actionNow);
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator1_wallActionSet(bool state) noexcept -> bool
+{
+    return actuator1_wall.setStateStatic<1U>(state);
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator1_wallActionSet(bool state, uint32_t actionNow) noexcept -> bool
+{
+    bool anyActuatorChangedState = false;
+    anyActuatorChangedState |= actuator1_wall.setStateStatic<1U>(state, actionNow);
+    return anyActuatorChangedState;
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator1_wallActionToggle() noexcept -> bool
+{
+    return actuator1_wall.toggleStateStatic<1U>();
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator1_wallActionToggle(uint32_t actionNow) noexcept -> bool
+{
+    return actuator1_wallActionSet(!actuator1_wall.getState(), actionNow);
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator2_fanActionSet(bool state) noexcept -> bool
+{
+    return actuator2_fan.setStateStatic<2U>(state);
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator2_fanActionSet(bool state, uint32_t actionNow) noexcept -> bool
+{
+    bool anyActuatorChangedState = false;
+    anyActuatorChangedState |= actuator2_fan.setStateStatic<2U>(state, actionNow);
+    return anyActuatorChangedState;
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator2_fanActionToggle() noexcept -> bool
+{
+    return actuator2_fan.toggleStateStatic<2U>();
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator2_fanActionToggle(uint32_t actionNow) noexcept -> bool
+{
+    return actuator2_fanActionSet(!actuator2_fan.getState(), actionNow);
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator3_gardenActionSet(bool state) noexcept -> bool
+{
+    return actuator3_garden.setStateStatic<3U>(state);
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator3_gardenActionSet(bool state, uint32_t actionNow) noexcept -> bool
+{
+    bool anyActuatorChangedState = false;
+    anyActuatorChangedState |= actuator3_garden.setStateStatic<3U>(state, actionNow);
+    return anyActuatorChangedState;
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator3_gardenActionToggle() noexcept -> bool
+{
+    return actuator3_garden.toggleStateStatic<3U>();
+}
+
+[[nodiscard]] __attribute__((always_inline)) inline auto actuator3_gardenActionToggle(uint32_t actionNow) noexcept -> bool
+{
+    return actuator3_gardenActionSet(!actuator3_garden.getState(), actionNow);
+}
+
+[[nodiscard]] inline auto actuator4_pump_aActionSet(bool state) noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    return actuator4_pump_aActionSet(state, actionNow);
+}
+
+[[nodiscard]] inline auto actuator4_pump_aActionSet(bool state, uint32_t actionNow) noexcept -> bool
+{
+    bool anyActuatorChangedState = false;
+    if (state)
+    {
+        anyActuatorChangedState |= actuator5_pump_bActionSet(false, actionNow);
+    }
+    anyActuatorChangedState |= actuator4_pump_a.setStateStatic<4U>(state, actionNow);
+    return anyActuatorChangedState;
+}
+
+[[nodiscard]] inline auto actuator4_pump_aActionToggle() noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    return actuator4_pump_aActionToggle(actionNow);
+}
+
+[[nodiscard]] inline auto actuator4_pump_aActionToggle(uint32_t actionNow) noexcept -> bool
+{
+    return actuator4_pump_aActionSet(!actuator4_pump_a.getState(), actionNow);
+}
+
+[[nodiscard]] inline auto actuator5_pump_bActionSet(bool state) noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    return actuator5_pump_bActionSet(state, actionNow);
+}
+
+[[nodiscard]] inline auto actuator5_pump_bActionSet(bool state, uint32_t actionNow) noexcept -> bool
+{
+    bool anyActuatorChangedState = false;
+    if (state)
+    {
+        anyActuatorChangedState |= actuator4_pump_aActionSet(false, actionNow);
+    }
+    anyActuatorChangedState |= actuator5_pump_b.setStateStatic<5U>(state, actionNow);
+    return anyActuatorChangedState;
+}
+
+[[nodiscard]] inline auto actuator5_pump_bActionToggle() noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    return actuator5_pump_bActionToggle(actionNow);
+}
+
+[[nodiscard]] inline auto actuator5_pump_bActionToggle(uint32_t actionNow) noexcept -> bool
+{
+    return actuator5_pump_bActionSet(!actuator5_pump_b.getState(), actionNow);
+}
+
+[[nodiscard]] inline auto actuator6_door_strikeActionSet(bool state) noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    return actuator6_door_strikeActionSet(state, actionNow);
+}
+
+[[nodiscard]] inline auto actuator6_door_strikeActionSet(bool state, uint32_t actionNow) noexcept -> bool
+{
+    bool anyActuatorChangedState = false;
+    static_assert(300U >= constants::timings::ACTUATOR_DEBOUNCE_TIME_MS,
+                  "Pulse duration must be greater than or equal to actuator debounce.");
+    if (state)
+    {
+        const bool actuatorWasOn = actuator6_door_strike.getState();
+        const bool pulseWasActive = pulseRemaining_ms[0U] != 0U;
+        const bool pulseStarted = actuator6_door_strike.setStateStatic<6U>(true, actionNow);
+        anyActuatorChangedState |= pulseStarted;
+        if (pulseStarted || actuatorWasOn)
+        {
+            if (!pulseWasActive)
+            {
+                ++hotLoopState::activePulseActuators();
+            }
+            pulseRemaining_ms[0U] = 300U;
+        }
+    }
+    else
+    {
+        if (pulseRemaining_ms[0U] != 0U)
+        {
+            pulseRemaining_ms[0U] = 0U;
+            --hotLoopState::activePulseActuators();
+        }
+        anyActuatorChangedState |= actuator6_door_strike.setStateStatic<6U>(false, actionNow);
+    }
+    return anyActuatorChangedState;
+}
+
+[[nodiscard]] inline auto actuator6_door_strikeActionToggle() noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    return actuator6_door_strikeActionToggle(actionNow);
+}
+
+[[nodiscard]] inline auto actuator6_door_strikeActionToggle(uint32_t actionNow) noexcept -> bool
+{
+    return actuator6_door_strikeActionSet(!actuator6_door_strike.getState(), actionNow);
+}
+
+auto runShortClick(uint8_t clickableIndex) noexcept -> bool
+{
+    switch (clickableIndex)
+    {
+    case 0U:
+    {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+        const uint32_t actionNow = timeKeeper::getTime();
+#else
+        constexpr uint32_t actionNow = 0U;
+#endif
+        bool anyActuatorChangedState = false;
+        anyActuatorChangedState |= actuator0_ceilingActionToggle(actionNow);
+        anyActuatorChangedState |= actuator1_wallActionToggle(actionNow);
+        return anyActuatorChangedState;
+    }
+    case 1U:
+    {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+        const uint32_t actionNow = timeKeeper::getTime();
+#else
+        constexpr uint32_t actionNow = 0U;
+#endif
+        bool anyActuatorChangedState = false;
+        anyActuatorChangedState |= actuator0_ceilingActionToggle(actionNow);
+        anyActuatorChangedState |= actuator1_wallActionToggle(actionNow);
+        return anyActuatorChangedState;
+    }
+    case 4U:
+    {
+        return actuator6_door_strikeActionToggle();
+    }
+    case 5U:
+    {
+        return actuator4_pump_aActionToggle();
+    }
+    case 7U:
+    {
+        return actuator1_wallActionToggle();
+    }
+    case 8U:
+    {
+        return actuator2_fanActionToggle();
+    }
+    case 9U:
+    {
+        return actuator3_gardenActionToggle();
+    }
+    default:
+        return false;
+    }
+}
+
+auto runLongClick(uint8_t clickableIndex) noexcept -> bool
+{
+    switch (clickableIndex)
+    {
+    case 0U:
+    {
+        const uint8_t actuatorsLongOn = static_cast<uint8_t>(actuator2_fan.getState());
+        const bool stateToSet = (static_cast<uint8_t>(actuatorsLongOn << 1U) < 1U);
+        return actuator2_fanActionSet(stateToSet);
+    }
+    case 1U:
+    {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+        const uint32_t actionNow = timeKeeper::getTime();
+#else
+        constexpr uint32_t actionNow = 0U;
+#endif
+        bool anyActuatorChangedState = false;
+        anyActuatorChangedState |= actuator0_ceilingActionSet(false, actionNow);
+        anyActuatorChangedState |= actuator1_wallActionSet(false, actionNow);
+        anyActuatorChangedState |= actuator2_fanActionSet(true, actionNow);
+        anyActuatorChangedState |= actuator3_gardenActionToggle(actionNow);
+        return anyActuatorChangedState;
+    }
+    case 2U:
+    {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+        const uint32_t actionNow = timeKeeper::getTime();
+#else
+        constexpr uint32_t actionNow = 0U;
+#endif
+        bool anyActuatorChangedState = false;
+        anyActuatorChangedState |= actuator0_ceilingActionSet(false, actionNow);
+        anyActuatorChangedState |= actuator1_wallActionSet(false, actionNow);
+        anyActuatorChangedState |= actuator2_fanActionSet(false, actionNow);
+        return anyActuatorChangedState;
+    }
+    case 3U:
+    {
+        return false;
+    }
+    case 4U:
+    {
+        const uint8_t actuatorsLongOn = static_cast<uint8_t>(actuator2_fan.getState());
+        const bool stateToSet = (static_cast<uint8_t>(actuatorsLongOn << 1U) < 1U);
+        return actuator2_fanActionSet(stateToSet);
+    }
+    case 5U:
+    {
+        return actuator5_pump_bActionSet(true);
+    }
+    default:
+        return false;
+    }
+}
+
+auto turnOffAllActuators() noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    bool anyActuatorChangedState = false;
+    anyActuatorChangedState |= actuator0_ceilingActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator1_wallActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator2_fanActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator3_gardenActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator4_pump_aActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator5_pump_bActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator6_door_strikeActionSet(false, actionNow);
+    return anyActuatorChangedState;
+}
+
+auto turnOffUnprotectedActuators() noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    bool anyActuatorChangedState = false;
+    anyActuatorChangedState |= actuator1_wallActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator2_fanActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator3_gardenActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator4_pump_aActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator5_pump_bActionSet(false, actionNow);
+    anyActuatorChangedState |= actuator6_door_strikeActionSet(false, actionNow);
+    return anyActuatorChangedState;
+}
+
+auto runSuperLongClick(uint8_t clickableIndex) noexcept -> bool
+{
+    switch (clickableIndex)
+    {
+    case 0U:
+    {
+        return turnOffUnprotectedActuators();
+    }
+    case 1U:
+    {
+        return turnOffUnprotectedActuators();
+    }
+    case 2U:
+    {
+        return actuator3_gardenActionSet(false);
+    }
+    case 5U:
+    {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+        const uint32_t actionNow = timeKeeper::getTime();
+#else
+        constexpr uint32_t actionNow = 0U;
+#endif
+        bool anyActuatorChangedState = false;
+        anyActuatorChangedState |= actuator4_pump_aActionSet(false, actionNow);
+        anyActuatorChangedState |= actuator5_pump_bActionSet(false, actionNow);
+        return anyActuatorChangedState;
+    }
+    default:
+        return false;
+    }
+}
+
+auto runClick(uint8_t clickableIndex, constants::ClickType clickType) noexcept -> bool
+{
+    switch (clickType)
+    {
+    case constants::ClickType::SHORT:
+        return runShortClick(clickableIndex);
+    case constants::ClickType::LONG:
+        return runLongClick(clickableIndex);
+    case constants::ClickType::SUPER_LONG:
+        return runSuperLongClick(clickableIndex);
+    default:
+        return false;
+    }
+}
+
+auto runNetworkClickFallback(uint8_t clickableIndex, constants::ClickType clickType) noexcept -> bool
+{
+    switch (clickType)
+    {
+    case constants::ClickType::LONG:
+    {
+        switch (clickableIndex)
+        {
+        case 1U:
+            return runLongClick(clickableIndex);
+        default:
+            return false;
+        }
+    }
+    case constants::ClickType::SUPER_LONG:
+    {
+        switch (clickableIndex)
+        {
+        case 1U:
+            return runSuperLongClick(clickableIndex);
+        default:
+            return false;
+        }
+    }
+    default:
+        return false;
+    }
+}
+
+auto getNetworkClickSlotCount(uint8_t clickableIndex) noexcept -> uint8_t
+{
+    if (clickableIndex == 1U)
+    {
+        return 2U;
+    }
+
+    if (clickableIndex == 3U)
+    {
+        return 1U;
+    }
+
+    return 0U;
+}
+
+auto getNetworkClickSlotIndex(uint8_t clickableIndex, constants::ClickType clickType) noexcept -> uint8_t
+{
+    switch (clickType)
+    {
+    case constants::ClickType::LONG:
+    {
+        switch (clickableIndex)
+        {
+        case 1U:
+            return 0U;
+        case 3U:
+            return 2U;
+        default:
+            return UINT8_MAX;
+        }
+    }
+    case constants::ClickType::SUPER_LONG:
+    {
+        switch (clickableIndex)
+        {
+        case 1U:
+            return 1U;
+        default:
+            return UINT8_MAX;
+        }
+    }
+    default:
+        return UINT8_MAX;
+    }
+}
+
+auto getNetworkClickClickableIndex(uint8_t slotIndex) noexcept -> uint8_t
+{
+    if (slotIndex == 0U)
+    {
+        return 1U;
+    }
+
+    if (slotIndex == 1U)
+    {
+        return 1U;
+    }
+
+    if (slotIndex == 2U)
+    {
+        return 3U;
+    }
+
+    return UINT8_MAX;
+}
+
+auto getNetworkClickType(uint8_t slotIndex) noexcept -> constants::ClickType
+{
+    if (slotIndex == 0U)
+    {
+        return constants::ClickType::LONG;
+    }
+
+    if (slotIndex == 1U)
+    {
+        return constants::ClickType::SUPER_LONG;
+    }
+
+    if (slotIndex == 2U)
+    {
+        return constants::ClickType::LONG;
+    }
+
+    return constants::ClickType::NONE;
+}
+
+auto getNetworkClickQueueDepth(uint8_t slotIndex) noexcept -> uint8_t
+{
+    if (slotIndex == 2U)
+    {
+        return 3U;
+    }
+
+    if (slotIndex == 0U)
+    {
+        return 1U;
+    }
+
+    return 0U;
+}
+
+auto isClickableConfigurationValid(uint8_t clickableIndex) noexcept -> bool
+{
+    return (clickableIndex < 6U) || (clickableIndex >= 7U && clickableIndex <= 9U);
+}
+
+auto setActuatorStateById(uint8_t actuatorId, bool state) noexcept -> bool
+{
+    switch (actuatorId)
+    {
+    case 1U:
+    {
+        return actuator0_ceilingActionSet(state);
+    }
+    case 3U:
+    {
+        return actuator1_wallActionSet(state);
+    }
+    case 9U:
+    {
+        return actuator2_fanActionSet(state);
+    }
+    case 250U:
+    {
+        return actuator3_gardenActionSet(state);
+    }
+    case 12U:
+    {
+        return actuator4_pump_aActionSet(state);
+    }
+    case 13U:
+    {
+        return actuator5_pump_bActionSet(state);
+    }
+    case 14U:
+    {
+        return actuator6_door_strikeActionSet(state);
+    }
+    default:
+        return false;
+    }
+}
+
+static uint16_t clickableSliceAge_ms[2] = {};
+static uint8_t clickableScanSlice = 0U;
+
+[[nodiscard]] static auto scanClickableSlice0(uint16_t elapsed_ms) noexcept -> uint8_t
+{
+    using constants::ClickResult;
+    using namespace Debug;
+    uint8_t scanResultFlags = 0U;
+
+    {
+        const auto button0_entry_buttonClickResult =
+            button0_entry_button.clickDetection<constants::clickDetection::makeFlags(true, true, true), 450U, 1200U>(elapsed_ms);
+        switch (button0_entry_buttonClickResult)
+        {
+        case ClickResult::SHORT_CLICK:
+        case ClickResult::SHORT_CLICK_QUICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 1U, FPSTR(dStr::SPACE), FPSTR(dStr::SHORT), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            static_cast<void>(PeerLink::send(2U, 2U, PeerLink::Operation::TOGGLE));
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+            const uint32_t actionNow = timeKeeper::getTime();
+#else
+            constexpr uint32_t actionNow = 0U;
+#endif
+            if (actuator0_ceilingActionToggle(actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator1_wallActionToggle(actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        case ClickResult::LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 1U, FPSTR(dStr::SPACE), FPSTR(dStr::LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            const uint8_t actuatorsLongOn = static_cast<uint8_t>(actuator2_fan.getState());
+            const bool stateToSet = (static_cast<uint8_t>(actuatorsLongOn << 1U) < 1U);
+            if (actuator2_fanActionSet(stateToSet))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        case ClickResult::SUPER_LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 1U, FPSTR(dStr::SPACE), FPSTR(dStr::SUPER_LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+            const uint32_t actionNow = timeKeeper::getTime();
+#else
+            constexpr uint32_t actionNow = 0U;
+#endif
+            if (actuator1_wallActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator2_fanActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator3_gardenActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator4_pump_aActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator5_pump_bActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator6_door_strikeActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    {
+        const auto button1_scene_buttonClickResult =
+            button1_scene_button.clickDetection<constants::clickDetection::makeFlags(true, true, true), 750U, 1200U>(elapsed_ms);
+        switch (button1_scene_buttonClickResult)
+        {
+        case ClickResult::SHORT_CLICK:
+        case ClickResult::SHORT_CLICK_QUICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 4U, FPSTR(dStr::SPACE), FPSTR(dStr::SHORT), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+            const uint32_t actionNow = timeKeeper::getTime();
+#else
+            constexpr uint32_t actionNow = 0U;
+#endif
+            if (actuator0_ceilingActionToggle(actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator1_wallActionToggle(actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        case ClickResult::LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 4U, FPSTR(dStr::SPACE), FPSTR(dStr::LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (BridgeSerial::isConnected())
+            {
+                const auto requestResult = NetworkClicks::request(1U, constants::ClickType::LONG);
+                if (requestResult == NetworkClicks::RequestResult::Accepted)
+                {
+                    scanResultFlags |= CLICK_SCAN_NETWORK_PENDING;
+                }
+                else if (requestResult == NetworkClicks::RequestResult::TransportRejected)
+                {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+                    const uint32_t actionNow = timeKeeper::getTime();
+#else
+                    constexpr uint32_t actionNow = 0U;
+#endif
+                    if (actuator0_ceilingActionSet(false, actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                    if (actuator1_wallActionSet(false, actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                    if (actuator2_fanActionSet(true, actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                    if (actuator3_gardenActionToggle(actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                }
+            }
+            else
+            {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+                const uint32_t actionNow = timeKeeper::getTime();
+#else
+                constexpr uint32_t actionNow = 0U;
+#endif
+                if (actuator0_ceilingActionSet(false, actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+                if (actuator1_wallActionSet(false, actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+                if (actuator2_fanActionSet(true, actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+                if (actuator3_gardenActionToggle(actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+            }
+        }
+        break;
+
+        case ClickResult::SUPER_LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 4U, FPSTR(dStr::SPACE), FPSTR(dStr::SUPER_LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (BridgeSerial::isConnected())
+            {
+                const auto requestResult = NetworkClicks::request(1U, constants::ClickType::SUPER_LONG);
+                if (requestResult == NetworkClicks::RequestResult::Accepted)
+                {
+                    scanResultFlags |= CLICK_SCAN_NETWORK_PENDING;
+                }
+                else if (requestResult == NetworkClicks::RequestResult::TransportRejected)
+                {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+                    const uint32_t actionNow = timeKeeper::getTime();
+#else
+                    constexpr uint32_t actionNow = 0U;
+#endif
+                    if (actuator1_wallActionSet(false, actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                    if (actuator2_fanActionSet(false, actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                    if (actuator3_gardenActionSet(false, actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                    if (actuator4_pump_aActionSet(false, actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                    if (actuator5_pump_bActionSet(false, actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                    if (actuator6_door_strikeActionSet(false, actionNow))
+                    {
+                        scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                    }
+                }
+            }
+            else
+            {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+                const uint32_t actionNow = timeKeeper::getTime();
+#else
+                constexpr uint32_t actionNow = 0U;
+#endif
+                if (actuator1_wallActionSet(false, actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+                if (actuator2_fanActionSet(false, actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+                if (actuator3_gardenActionSet(false, actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+                if (actuator4_pump_aActionSet(false, actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+                if (actuator5_pump_bActionSet(false, actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+                if (actuator6_door_strikeActionSet(false, actionNow))
+                {
+                    scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+                }
+            }
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    {
+        const auto button2_off_buttonClickResult =
+            button2_off_button.clickDetection<constants::clickDetection::makeFlags(false, true, true), 1250U, 1800U>(elapsed_ms);
+        switch (button2_off_buttonClickResult)
+        {
+        case ClickResult::LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 7U, FPSTR(dStr::SPACE), FPSTR(dStr::LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+            const uint32_t actionNow = timeKeeper::getTime();
+#else
+            constexpr uint32_t actionNow = 0U;
+#endif
+            if (actuator0_ceilingActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator1_wallActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator2_fanActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        case ClickResult::SUPER_LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 7U, FPSTR(dStr::SPACE), FPSTR(dStr::SUPER_LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (actuator3_gardenActionSet(false))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    {
+        const auto button3_network_only_buttonClickResult =
+            button3_network_only_button.clickDetection<constants::clickDetection::makeFlags(false, true, false), 450U, 1000U>(elapsed_ms);
+        switch (button3_network_only_buttonClickResult)
+        {
+        case ClickResult::LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 11U, FPSTR(dStr::SPACE), FPSTR(dStr::LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (BridgeSerial::isConnected())
+            {
+                const auto requestResult = NetworkClicks::request(3U, constants::ClickType::LONG);
+                if (requestResult == NetworkClicks::RequestResult::Accepted)
+                {
+                    scanResultFlags |= CLICK_SCAN_NETWORK_PENDING;
+                }
+            }
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    {
+        const auto button4_alias_buttonClickResult =
+            button4_alias_button.clickDetection<constants::clickDetection::makeFlags(true, true, false), 450U, 1000U>(elapsed_ms);
+        switch (button4_alias_buttonClickResult)
+        {
+        case ClickResult::SHORT_CLICK:
+        case ClickResult::SHORT_CLICK_QUICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 19U, FPSTR(dStr::SPACE), FPSTR(dStr::SHORT), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (actuator6_door_strikeActionToggle())
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        case ClickResult::LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 19U, FPSTR(dStr::SPACE), FPSTR(dStr::LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            const uint8_t actuatorsLongOn = static_cast<uint8_t>(actuator2_fan.getState());
+            const bool stateToSet = (static_cast<uint8_t>(actuatorsLongOn << 1U) < 1U);
+            if (actuator2_fanActionSet(stateToSet))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    return scanResultFlags;
+}
+
+[[nodiscard]] static auto scanClickableSlice1(uint16_t elapsed_ms) noexcept -> uint8_t
+{
+    using constants::ClickResult;
+    using namespace Debug;
+    uint8_t scanResultFlags = 0U;
+
+    {
+        const auto button5_pump_buttonClickResult =
+            button5_pump_button.clickDetection<constants::clickDetection::makeFlags(true, true, true), 450U, 1200U>(elapsed_ms);
+        switch (button5_pump_buttonClickResult)
+        {
+        case ClickResult::SHORT_CLICK:
+        case ClickResult::SHORT_CLICK_QUICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 20U, FPSTR(dStr::SPACE), FPSTR(dStr::SHORT), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (actuator4_pump_aActionToggle())
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        case ClickResult::LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 20U, FPSTR(dStr::SPACE), FPSTR(dStr::LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (actuator5_pump_bActionSet(true))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        case ClickResult::SUPER_LONG_CLICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 20U, FPSTR(dStr::SPACE), FPSTR(dStr::SUPER_LONG), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+            const uint32_t actionNow = timeKeeper::getTime();
+#else
+            constexpr uint32_t actionNow = 0U;
+#endif
+            if (actuator4_pump_aActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+            if (actuator5_pump_bActionSet(false, actionNow))
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    {
+        const auto button6_emergency_buttonClickResult =
+            button6_emergency_button.clickDetection<constants::clickDetection::makeFlags(false, false, false), 400U, 1000U>(elapsed_ms);
+        switch (button6_emergency_buttonClickResult)
+        {
+        default:
+            break;
+        }
+    }
+
+    {
+        const auto button7_touch_padClickResult =
+            button7_touch_pad.clickDetection<constants::clickDetection::makeFlags(true, false, false), 400U, 1000U>(button7_touch_padTouch.pressed(), elapsed_ms);
+        switch (button7_touch_padClickResult)
+        {
+        case ClickResult::SHORT_CLICK:
+        case ClickResult::SHORT_CLICK_QUICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 22U, FPSTR(dStr::SPACE), FPSTR(dStr::SHORT), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (actuator1_wallActionToggle())
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    {
+        const auto button8_matrix_fanClickResult =
+            button8_matrix_fan.clickDetection<constants::clickDetection::makeFlags(true, false, false), 400U, 1000U>(keyMatrix.pressed<0U, 1U>(), elapsed_ms);
+        switch (button8_matrix_fanClickResult)
+        {
+        case ClickResult::SHORT_CLICK:
+        case ClickResult::SHORT_CLICK_QUICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 23U, FPSTR(dStr::SPACE), FPSTR(dStr::SHORT), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (actuator2_fanActionToggle())
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    {
+        const auto button9_matrix_gardenClickResult =
+            button9_matrix_garden.clickDetection<constants::clickDetection::makeFlags(true, false, false), 400U, 1000U>(keyMatrix.pressed<1U, 0U>(), elapsed_ms);
+        switch (button9_matrix_gardenClickResult)
+        {
+        case ClickResult::SHORT_CLICK:
+        case ClickResult::SHORT_CLICK_QUICK:
+        {
+            DPL(FPSTR(dStr::CLICKABLE), FPSTR(dStr::SPACE), 24U, FPSTR(dStr::SPACE), FPSTR(dStr::SHORT), FPSTR(dStr::SPACE),
+                FPSTR(dStr::CLICKED));
+            if (actuator3_gardenActionToggle())
+            {
+                scanResultFlags |= CLICK_SCAN_STATE_CHANGED;
+            }
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    return scanResultFlags;
+}
+
+auto scanClickables(uint16_t elapsed_ms) noexcept -> uint8_t
+{
+    serviceTouchKeys();
+    for (uint8_t index = 0U; index < 2U; ++index)
+    {
+        clickableSliceAge_ms[index] = timeUtils::addElapsedTimeSaturated(clickableSliceAge_ms[index], elapsed_ms);
+    }
+    const uint8_t slice = clickableScanSlice;
+    clickableScanSlice = (slice + 1U < 2U) ? static_cast<uint8_t>(slice + 1U) : 0U;
+    const uint16_t sliceElapsed_ms = clickableSliceAge_ms[slice];
+    clickableSliceAge_ms[slice] = 0U;
+    switch (slice)
+    {
+    case 0U:
+        return scanClickableSlice0(sliceElapsed_ms);
+    default:
+        return scanClickableSlice1(sliceElapsed_ms);
+    }
+}
+
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+auto getBounceProfile(uint8_t clickableIndex) noexcept -> const BounceProfile *
+{
+    switch (clickableIndex)
+    {
+    case 0U:
+        return &button0_entry_button.getBounceProfile();
+    case 1U:
+        return &button1_scene_button.getBounceProfile();
+    case 2U:
+        return &button2_off_button.getBounceProfile();
+    case 3U:
+        return &button3_network_only_button.getBounceProfile();
+    case 4U:
+        return &button4_alias_button.getBounceProfile();
+    case 5U:
+        return &button5_pump_button.getBounceProfile();
+    case 6U:
+        return &button6_emergency_button.getBounceProfile();
+    case 7U:
+        return &button7_touch_pad.getBounceProfile();
+    case 8U:
+        return &button8_matrix_fan.getBounceProfile();
+    case 9U:
+        return &button9_matrix_garden.getBounceProfile();
+    default:
+        return nullptr;
+    }
+}
+#endif
+
+auto checkPulseTimers(uint16_t elapsed_ms) noexcept -> bool
+{
+    if (hotLoopState::activePulseActuators() == 0U)
+    {
+        return false;
+    }
+
+    bool anyActuatorChangedState = false;
+    if (pulseRemaining_ms[0U] != 0U)
+    {
+        if (pulseRemaining_ms[0U] <= elapsed_ms)
+        {
+            pulseRemaining_ms[0U] = 0U;
+            --hotLoopState::activePulseActuators();
+            anyActuatorChangedState |= actuator6_door_strikeActionSet(false);
+        }
+        else
+        {
+            pulseRemaining_ms[0U] = static_cast<uint16_t>(pulseRemaining_ms[0U] - elapsed_ms);
+        }
+    }
+    return anyActuatorChangedState;
+}
+
+auto reconcilePriorityInputs() noexcept -> bool
+{
+    if (priorityInputsPending == 0U)
+    {
+        return false;
+    }
+
+    noInterrupts();
+    const uint8_t pending = priorityInputsPending;
+    priorityInputsPending = 0U;
+    interrupts();
+
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    bool anyActuatorChangedState = false;
+    if ((pending & 1U) != 0U)
+    {
+        anyActuatorChangedState |= actuator4_pump_a.reconcileStateStatic<4U>(false, actionNow);
+        anyActuatorChangedState |= actuator5_pump_b.reconcileStateStatic<5U>(false, actionNow);
+        if (pulseRemaining_ms[0U] != 0U)
+        {
+            pulseRemaining_ms[0U] = 0U;
+            --hotLoopState::activePulseActuators();
+        }
+        anyActuatorChangedState |= actuator6_door_strike.reconcileStateStatic<6U>(false, actionNow);
+    }
+    return anyActuatorChangedState;
+}
+
+auto drainEncoders() noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    bool anyActuatorChangedState = false;
+    int8_t detents = 0;
+
+    detents = encoder0_living_knob.takeDetents<2U>();
+    if (detents != 0)
+    {
+        int16_t level0 = detents;
+        level0 += static_cast<int16_t>(actuator0_ceiling.getState());
+        level0 += static_cast<int16_t>(actuator1_wall.getState());
+        level0 += static_cast<int16_t>(actuator2_fan.getState());
+        anyActuatorChangedState |= actuator0_ceilingActionSet(level0 > 0, actionNow);
+        anyActuatorChangedState |= actuator1_wallActionSet(level0 > 1, actionNow);
+        anyActuatorChangedState |= actuator2_fanActionSet(level0 > 2, actionNow);
+        encoder0_living_knob.addNetworkSteps(detents);
+    }
+    if (encoder0_living_knob.networkSteps() != 0)
+    {
+        if (!BridgeSync::allowsMutatingCommands() ||
+            Serializer::serializeEncoderSteps(1U, encoder0_living_knob.networkSteps()))
+        {
+            encoder0_living_knob.clearNetworkSteps();
+        }
+    }
+    return anyActuatorChangedState;
+}
+
+auto scanOccupancy() noexcept -> bool
+{
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+    const uint32_t actionNow = timeKeeper::getTime();
+#else
+    constexpr uint32_t actionNow = 0U;
+#endif
+    bool anyActuatorChangedState = false;
+    if (occupancy0_hall_pir.sampleRisingEdge(::lsh::core::PinTag<(CONTROLLINO_A6)>{}))
+    {
+        anyActuatorChangedState |= actuator1_wallActionSet(true, actionNow);
+    }
+    if (occupancy0_hall_pir.active())
+    {
+        actuator1_wall.restartAutoOffStatic<1U>(actionNow);
+    }
+    return anyActuatorChangedState;
+}
+
+void reportOccupancy() noexcept
+{
+    occupancy0_hall_pir.closeSummaryWindow(
+        !occupancy0_hall_pir.summaryChanged() ||
+        (BridgeSync::allowsMutatingCommands() &&
+         Serializer::serializeOccupancy(1U, occupancy0_hall_pir.occupied())));
+}
+
+void pollOneWire(uint16_t elapsed_ms) noexcept
+{
+    if (oneWireBus0.step(elapsed_ms) && oneWireBus0.freshCount() != 0U &&
+        BridgeSync::allowsMutatingCommands())
+    {
+        static_cast<void>(Serializer::serializeTemperatures(oneWireBus0));
+    }
+}
+
+auto checkAutoOffTimers(uint32_t now_ms) noexcept -> bool
+{
+    bool anyActuatorChangedState = false;
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+    anyActuatorChangedState |= Actuators::checkCompactAutoOffTimer(0U, 0U, actuator0_ceiling, now_ms, 600000UL);
+#else
+    anyActuatorChangedState |= actuator0_ceiling.checkAutoOffTimerForIndex(0U, now_ms, 600000UL);
+#endif
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+    anyActuatorChangedState |= Actuators::checkCompactAutoOffTimer(1U, 1U, actuator1_wall, now_ms, 45000UL);
+#else
+    anyActuatorChangedState |= actuator1_wall.checkAutoOffTimerForIndex(1U, now_ms, 45000UL);
+#endif
+    return anyActuatorChangedState;
+}
+
+auto getActiveTimer(uint8_t timerIndex, uint32_t now_ms, uint8_t &actuatorId, uint32_t &remaining_ms) noexcept -> bool
+{
+    switch (timerIndex)
+    {
+    case 0U:
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+        if (!Actuators::getCompactAutoOffRemaining(0U, actuator0_ceiling, now_ms, 600000UL, remaining_ms))
+#else
+        if (!actuator0_ceiling.getAutoOffRemaining(now_ms, 600000UL, remaining_ms))
+#endif
+        {
+            return false;
+        }
+        actuatorId = 1U;
+        return true;
+    case 1U:
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+        if (!Actuators::getCompactAutoOffRemaining(1U, actuator1_wall, now_ms, 45000UL, remaining_ms))
+#else
+        if (!actuator1_wall.getAutoOffRemaining(now_ms, 45000UL, remaining_ms))
+#endif
+        {
+            return false;
+        }
+        actuatorId = 3U;
+        return true;
+    case 2U:
+        if (pulseRemaining_ms[0U] == 0U)
+        {
+            return false;
+        }
+        remaining_ms = pulseRemaining_ms[0U];
+        actuatorId = 14U;
+        return true;
+    default:
+        return false;
+    }
+}
+
+auto applyPackedActuatorStateByte(uint8_t byteIndex, uint8_t packedByte) noexcept -> bool
+{
+    switch (byteIndex)
+    {
+    case 0U:
+    {
+#if LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP
+        const uint32_t actionNow = timeKeeper::getTime();
+#else
+        constexpr uint32_t actionNow = 0U;
+#endif
+        bool anyActuatorChangedState = false;
+        anyActuatorChangedState |= actuator0_ceilingActionSet((packedByte & 1U) != 0U, actionNow);
+        anyActuatorChangedState |= actuator1_wallActionSet((packedByte & 2U) != 0U, actionNow);
+        anyActuatorChangedState |= actuator2_fanActionSet((packedByte & 4U) != 0U, actionNow);
+        anyActuatorChangedState |= actuator3_gardenActionSet((packedByte & 8U) != 0U, actionNow);
+        anyActuatorChangedState |= actuator4_pump_aActionSet((packedByte & 16U) != 0U, actionNow);
+        anyActuatorChangedState |= actuator5_pump_bActionSet((packedByte & 32U) != 0U, actionNow);
+        anyActuatorChangedState |= actuator6_door_strikeActionSet((packedByte & 64U) != 0U, actionNow);
+        return anyActuatorChangedState;
+    }
+    default:
+        return false;
+    }
+}
+
+auto actuatorTopologyFingerprint() noexcept -> uint32_t
+{
+    return 3076084856UL;
+}
+
+auto computeIndicatorState(uint8_t indicatorIndex) noexcept -> bool
+{
+    switch (indicatorIndex)
+    {
+    case 0U:
+    {
+        return actuator0_ceiling.getState() || actuator1_wall.getState();
+    }
+    case 1U:
+    {
+        return actuator0_ceiling.getState() && actuator1_wall.getState();
+    }
+    case 2U:
+    {
+        const uint8_t totalControlledActuatorsOn =
+            static_cast<uint8_t>(actuator0_ceiling.getState()) + static_cast<uint8_t>(actuator1_wall.getState()) + static_cast<uint8_t>(actuator2_fan.getState());
+        return static_cast<uint8_t>(totalControlledActuatorsOn << 1U) > 3U;
+    }
+    default:
+        return false;
+    }
+}
+
+void refreshIndicators() noexcept
+{
+    indicator0_any_led.applyComputedState(actuator0_ceiling.getState() || actuator1_wall.getState());
+    indicator1_all_led.applyComputedState(actuator0_ceiling.getState() && actuator1_wall.getState());
+    const uint8_t indicator2_majority_ledActuatorsOn =
+        static_cast<uint8_t>(actuator0_ceiling.getState()) + static_cast<uint8_t>(actuator1_wall.getState()) + static_cast<uint8_t>(actuator2_fan.getState());
+    indicator2_majority_led.applyComputedState(static_cast<uint8_t>(indicator2_majority_ledActuatorsOn << 1U) > 3U);
+}
+}  // namespace lsh::core::static_config
+
+void Configurator::configure()
+{
+    using namespace Debug;
+
+    DP_CONTEXT();
+
+    disableRtc();
+
+    disableEth();
+
+    Actuators::packedActuatorStates[0U] = 1U;
+
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    actuator0_ceiling.setIndex(0U);
+    Actuators::actuators[0U] = &actuator0_ceiling;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    actuator1_wall.setIndex(1U);
+    Actuators::actuators[1U] = &actuator1_wall;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    actuator2_fan.setIndex(2U);
+    Actuators::actuators[2U] = &actuator2_fan;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    actuator3_garden.setIndex(3U);
+    Actuators::actuators[3U] = &actuator3_garden;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    actuator4_pump_a.setIndex(4U);
+    Actuators::actuators[4U] = &actuator4_pump_a;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    actuator5_pump_b.setIndex(5U);
+    Actuators::actuators[5U] = &actuator5_pump_b;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    actuator6_door_strike.setIndex(6U);
+    Actuators::actuators[6U] = &actuator6_door_strike;
+#endif
+
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button0_entry_button.setIndex(0U);
+    Clickables::clickables[0U] = &button0_entry_button;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button1_scene_button.setIndex(1U);
+    Clickables::clickables[1U] = &button1_scene_button;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button2_off_button.setIndex(2U);
+    Clickables::clickables[2U] = &button2_off_button;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button3_network_only_button.setIndex(3U);
+    Clickables::clickables[3U] = &button3_network_only_button;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button4_alias_button.setIndex(4U);
+    Clickables::clickables[4U] = &button4_alias_button;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button5_pump_button.setIndex(5U);
+    Clickables::clickables[5U] = &button5_pump_button;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button6_emergency_button.setIndex(6U);
+    Clickables::clickables[6U] = &button6_emergency_button;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button7_touch_pad.setIndex(7U);
+    Clickables::clickables[7U] = &button7_touch_pad;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button8_matrix_fan.setIndex(8U);
+    Clickables::clickables[8U] = &button8_matrix_fan;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    button9_matrix_garden.setIndex(9U);
+    Clickables::clickables[9U] = &button9_matrix_garden;
+#endif
+
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    indicator0_any_led.setIndex(0U);
+    Indicators::indicators[0U] = &indicator0_any_led;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    indicator1_all_led.setIndex(1U);
+    Indicators::indicators[1U] = &indicator1_all_led;
+#endif
+#if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
+    indicator2_majority_led.setIndex(2U);
+    Indicators::indicators[2U] = &indicator2_majority_led;
+#endif
+
+    actuator0_ceiling.setProtected(true);
+
+#ifdef NOT_AN_INTERRUPT
+    static_assert(digitalPinToInterrupt(CONTROLLINO_IN0) != NOT_AN_INTERRUPT,
+                  "Priority input emergency_button needs a pin with an external interrupt.");
+#endif
+    attachInterrupt(digitalPinToInterrupt(CONTROLLINO_IN0), button6_emergency_buttonPriorityIsr, RISING);
+
+#ifdef NOT_AN_INTERRUPT
+    static_assert(digitalPinToInterrupt(CONTROLLINO_IN1) != NOT_AN_INTERRUPT,
+                  "Encoder living_knob needs two pins with external interrupts.");
+#endif
+    attachInterrupt(digitalPinToInterrupt(CONTROLLINO_IN1), encoder0_living_knobIsr, CHANGE);
+#ifdef NOT_AN_INTERRUPT
+    static_assert(digitalPinToInterrupt(21) != NOT_AN_INTERRUPT,
+                  "Encoder living_knob needs two pins with external interrupts.");
+#endif
+    attachInterrupt(digitalPinToInterrupt(21), encoder0_living_knobIsr, CHANGE);
+
+    startKeyMatrix();
+}
+
+#undef LSH_STATIC_CONFIG_READ_BYTE
+#undef LSH_STATIC_CONFIG_PROGMEM
+
+#endif  // LSH_GENERATED_CUSTOM_MAXIMAL_PANEL_STATIC_CONFIG_HPP_IMPLEMENTATION
+
+#else
+#error "maximal_panel_static_config.hpp must be included through a static-config pass macro."
+#endif
@@ -0,0 +1,22 @@
+/**
+ * @file    lsh_all_options_config.hpp
+ * @brief   Generated lsh-core static configuration. Edit the TOML source instead.
+ */
+
+// Generated by tools/generate_lsh_static_config.py from lsh_devices.toml. Do not edit by hand.
+
+#ifndef LSH_GENERATED_LSH_ALL_OPTIONS_CONFIG_HPP
+#define LSH_GENERATED_LSH_ALL_OPTIONS_CONFIG_HPP
+
+#if defined(LSH_BUILD_ALL_OPTIONS_MAXIMAL)
+#include "custom/maximal_panel_config.hpp"
+#elif defined(LSH_BUILD_NO_NETWORK_DENSE)
+#include "all_options_configs/no_network_dense_config.hpp"
+#elif defined(LSH_BUILD_EMPTY_PROFILE)
+#include "all_options_configs/empty_profile_config.hpp"
+#else
+// Available profiles: LSH_BUILD_ALL_OPTIONS_MAXIMAL, LSH_BUILD_NO_NETWORK_DENSE, LSH_BUILD_EMPTY_PROFILE.
+#error "No lsh-core device profile selected. Define exactly one generated LSH_BUILD_* macro."
+#endif
+
+#endif  // LSH_GENERATED_LSH_ALL_OPTIONS_CONFIG_HPP
@@ -0,0 +1,21 @@
+/**
+ * @file    lsh_all_options_static_router.hpp
+ * @brief   Generated lsh-core static configuration. Edit the TOML source instead.
+ */
+
+// Generated by tools/generate_lsh_static_config.py from lsh_devices.toml. Do not edit by hand.
+
+// Intentionally no include guard: lsh-core includes this router twice
+// with different pass macros. A conventional guard would make the
+// implementation pass disappear after the resource pass.
+
+#if defined(LSH_BUILD_ALL_OPTIONS_MAXIMAL)
+#include "custom/maximal_panel_static_config.hpp"
+#elif defined(LSH_BUILD_NO_NETWORK_DENSE)
+#include "all_options_configs/no_network_dense_static_config.hpp"
+#elif defined(LSH_BUILD_EMPTY_PROFILE)
+#include "all_options_configs/empty_profile_static_config.hpp"
+#else
+// Available profiles: LSH_BUILD_ALL_OPTIONS_MAXIMAL, LSH_BUILD_NO_NETWORK_DENSE, LSH_BUILD_EMPTY_PROFILE.
+#error "No lsh-core static profile selected. Define exactly one generated LSH_BUILD_* macro."
+#endif
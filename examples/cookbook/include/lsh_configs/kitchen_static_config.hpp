@@ -21,6 +21,16 @@
 #define LSH_STATIC_CONFIG_INDICATOR_ACTUATOR_LINKS 6
 #define LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS 1
 #define LSH_STATIC_CONFIG_PULSE_ACTUATORS 1
+#define LSH_STATIC_CONFIG_PRIORITY_INPUTS 0
+#define LSH_STATIC_CONFIG_TOUCH_KEYS 0
+#define LSH_STATIC_CONFIG_MATRIX_KEYS 0
+#define LSH_STATIC_CONFIG_ENCODERS 0
+#define LSH_STATIC_CONFIG_NETWORK_ENCODERS 0
+#define LSH_STATIC_CONFIG_OCCUPANCY_INPUTS 0
+#define LSH_STATIC_CONFIG_NETWORK_OCCUPANCY 0
+#define LSH_STATIC_CONFIG_TEMPERATURE_SENSORS 0
+#define LSH_STATIC_CONFIG_ONE_WIRE_BUSES 0
+#define LSH_STATIC_CONFIG_PEER_ADDRESS 0
 #define LSH_STATIC_CONFIG_ACTIVE_NETWORK_CLICKS 1
 #define LSH_STATIC_CONFIG_DISABLE_NETWORK_CLICKS 0
 
@@ -32,11 +42,13 @@
 #define LSH_GENERATED_LSH_CONFIGS_KITCHEN_STATIC_CONFIG_HPP_IMPLEMENTATION
 
 #include "communication/bridge_serial.hpp"
+#include "communication/bridge_transport.hpp"
 #include "config/static_config.hpp"
 #include "core/network_clicks.hpp"
 #include "device/actuator_manager.hpp"
 #include "device/clickable_manager.hpp"
 #include "device/indicator_manager.hpp"
+#include "internal/hot_loop_state.hpp"
 #include "lsh_user_macros.hpp"
 #include "util/constants/click_detection.hpp"
 #include "util/constants/click_results.hpp"
@@ -47,7 +59,7 @@
 
 #if defined(__AVR__)
 #include <avr/pgmspace.h>
-#define LSH_STATIC_CONFIG_PROGMEM PROGMEM
+#define LSH_STATIC_CONFIG_PROGMEM LSH_HOT_PROGMEM
 #define LSH_STATIC_CONFIG_READ_BYTE(address) pgm_read_byte(address)
 #else
 #define LSH_STATIC_CONFIG_PROGMEM
@@ -56,6 +68,18 @@
 
 namespace
 {
+// clang-format off
+const uint8_t NETWORK_CLICK_REQUEST_JSON_PREFIX_0[] LSH_STATIC_CONFIG_PROGMEM = {
+    0x7BU, 0x22U, 0x70U, 0x22U, 0x3AU, 0x33U, 0x2CU, 0x22U, 0x74U, 0x22U, 0x3AU, 0x31U,
+    0x2CU, 0x22U, 0x69U, 0x22U, 0x3AU, 0x33U, 0x2CU, 0x22U, 0x63U, 0x22U, 0x3AU
+};
+
+const uint8_t NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_0[] LSH_STATIC_CONFIG_PROGMEM = {
+    0xC0U, 0x84U, 0xA1U, 0x70U, 0x03U, 0xA1U, 0x74U, 0x01U, 0xA1U, 0x69U, 0x03U, 0xA1U,
+    0x63U
+};
+// clang-format on
+
 // clang-format off
 const uint8_t DETAILS_JSON_PAYLOAD[] LSH_STATIC_CONFIG_PROGMEM = {
     0x7BU, 0x22U, 0x70U, 0x22U, 0x3AU, 0x31U, 0x2CU, 0x22U, 0x76U, 0x22U, 0x3AU, 0x33U,
@@ -80,7 +104,7 @@ template <uint16_t ByteIndex, uint16_t PayloadSize> struct GeneratedPayloadByteW
 {
     static auto write(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
     {
-        return CONFIG_COM_SERIAL->HardwareSerial::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[ByteIndex])) == 1U &&
+        return BridgeTransport::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[ByteIndex])) == 1U &&
                GeneratedPayloadByteWriter<static_cast<uint16_t>(ByteIndex + 1U), PayloadSize>::write(payload);
     }
 };
@@ -98,7 +122,7 @@ template <uint16_t PayloadSize> auto writeGeneratedPayloadLoop(const uint8_t (&p
 {
     for (uint16_t byteIndex = 0U; byteIndex < PayloadSize; ++byteIndex)
     {
-        if (CONFIG_COM_SERIAL->HardwareSerial::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex])) != 1U)
+        if (BridgeTransport::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex])) != 1U)
         {
             return false;
         }
@@ -116,6 +140,24 @@ template <uint16_t PayloadSize> auto writeGeneratedPayload(const uint8_t (&paylo
     return writeGeneratedPayloadLoop(payload);
 }
 
+template <uint16_t PayloadSize> auto writeGeneratedMsgPackMapPrefix(const uint8_t (&payload)[PayloadSize], bool extraKey) noexcept -> bool
+{
+    // Byte 0 is the frame delimiter, byte 1 the fixmap header.
+    for (uint16_t byteIndex = 0U; byteIndex < PayloadSize; ++byteIndex)
+    {
+        uint8_t byte = LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex]);
+        if (byteIndex == 1U && extraKey)
+        {
+            ++byte;
+        }
+        if (BridgeTransport::write(byte) != 1U)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 LSH_ACTUATOR(actuator0_ceiling, CONTROLLINO_R0);
 LSH_ACTUATOR(actuator1_worktop, CONTROLLINO_R1);
 Actuator actuator2_ambient(::lsh::core::PinTag<(CONTROLLINO_R2)>{}, true);
@@ -201,8 +243,30 @@ auto writeDetailsPayload() noexcept -> bool
 #endif
 }
 
+auto writeNetworkClickRequestPrefix(uint8_t slotIndex, bool timestamped) noexcept -> bool
+{
+#ifdef CONFIG_MSG_PACK
+    switch (slotIndex)
+    {
+    case 0U:
+        return writeGeneratedMsgPackMapPrefix(NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_0, timestamped);
+    default:
+        return false;
+    }
+#else
+    // JSON appends `m` after the correlation value: same prefix.
+    static_cast<void>(timestamped);
+    switch (slotIndex)
+    {
+    case 0U:
+        return writeGeneratedPayloadLoop(NETWORK_CLICK_REQUEST_JSON_PREFIX_0);
+    default:
+        return false;
+    }
+#endif
+}
+
 static uint16_t pulseRemaining_ms[CONFIG_PULSE_STORAGE_CAPACITY] = {};
-static uint8_t activePulseActuators = 0U;
 
 [[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionSet(bool state) noexcept -> bool;
 [[nodiscard]] __attribute__((always_inline)) inline auto actuator0_ceilingActionSet(bool state, uint32_t actionNow) noexcept -> bool;
@@ -324,7 +388,7 @@ static uint8_t activePulseActuators = 0U;
         {
             if (!pulseWasActive)
             {
-                ++activePulseActuators;
+                ++hotLoopState::activePulseActuators();
             }
             pulseRemaining_ms[0U] = 300U;
         }
@@ -334,7 +398,7 @@ static uint8_t activePulseActuators = 0U;
         if (pulseRemaining_ms[0U] != 0U)
         {
             pulseRemaining_ms[0U] = 0U;
-            --activePulseActuators;
+            --hotLoopState::activePulseActuators();
         }
         anyActuatorChangedState |= actuator3_door_strike.setStateStatic<3U>(false, actionNow);
     }
@@ -689,6 +753,12 @@ auto getNetworkClickType(uint8_t slotIndex) noexcept -> constants::ClickType
     return constants::ClickType::NONE;
 }
 
+auto getNetworkClickQueueDepth(uint8_t slotIndex) noexcept -> uint8_t
+{
+    static_cast<void>(slotIndex);
+    return 0U;
+}
+
 auto isClickableConfigurationValid(uint8_t clickableIndex) noexcept -> bool
 {
     return clickableIndex < 5U;
@@ -1034,9 +1104,30 @@ auto scanClickables(uint16_t elapsed_ms) noexcept -> uint8_t
     return scanResultFlags;
 }
 
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+auto getBounceProfile(uint8_t clickableIndex) noexcept -> const BounceProfile *
+{
+    switch (clickableIndex)
+    {
+    case 0U:
+        return &button0_door.getBounceProfile();
+    case 1U:
+        return &button1_worktop.getBounceProfile();
+    case 2U:
+        return &button2_strike.getBounceProfile();
+    case 3U:
+        return &button3_blind_up.getBounceProfile();
+    case 4U:
+        return &button4_blind_down.getBounceProfile();
+    default:
+        return nullptr;
+    }
+}
+#endif
+
 auto checkPulseTimers(uint16_t elapsed_ms) noexcept -> bool
 {
-    if (activePulseActuators == 0U)
+    if (hotLoopState::activePulseActuators() == 0U)
     {
         return false;
     }
@@ -1047,7 +1138,7 @@ auto checkPulseTimers(uint16_t elapsed_ms) noexcept -> bool
         if (pulseRemaining_ms[0U] <= elapsed_ms)
         {
             pulseRemaining_ms[0U] = 0U;
-            --activePulseActuators;
+            --hotLoopState::activePulseActuators();
             anyActuatorChangedState |= actuator3_door_strikeActionSet(false);
         }
         else
@@ -1058,6 +1149,30 @@ auto checkPulseTimers(uint16_t elapsed_ms) noexcept -> bool
     return anyActuatorChangedState;
 }
 
+auto reconcilePriorityInputs() noexcept -> bool
+{
+    return false;
+}
+
+auto drainEncoders() noexcept -> bool
+{
+    return false;
+}
+
+auto scanOccupancy() noexcept -> bool
+{
+    return false;
+}
+
+void reportOccupancy() noexcept
+{
+}
+
+void pollOneWire(uint16_t elapsed_ms) noexcept
+{
+    static_cast<void>(elapsed_ms);
+}
+
 auto checkAutoOffTimers(uint32_t now_ms) noexcept -> bool
 {
     bool anyActuatorChangedState = false;
@@ -1069,6 +1184,34 @@ auto checkAutoOffTimers(uint32_t now_ms) noexcept -> bool
     return anyActuatorChangedState;
 }
 
+auto getActiveTimer(uint8_t timerIndex, uint32_t now_ms, uint8_t &actuatorId, uint32_t &remaining_ms) noexcept -> bool
+{
+    switch (timerIndex)
+    {
+    case 0U:
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+        if (!Actuators::getCompactAutoOffRemaining(0U, actuator1_worktop, now_ms, 2700000UL, remaining_ms))
+#else
+        if (!actuator1_worktop.getAutoOffRemaining(now_ms, 2700000UL, remaining_ms))
+#endif
+        {
+            return false;
+        }
+        actuatorId = 2U;
+        return true;
+    case 1U:
+        if (pulseRemaining_ms[0U] == 0U)
+        {
+            return false;
+        }
+        remaining_ms = pulseRemaining_ms[0U];
+        actuatorId = 4U;
+        return true;
+    default:
+        return false;
+    }
+}
+
 auto applyPackedActuatorStateByte(uint8_t byteIndex, uint8_t packedByte) noexcept -> bool
 {
     switch (byteIndex)
@@ -1095,6 +1238,11 @@ auto applyPackedActuatorStateByte(uint8_t byteIndex, uint8_t packedByte) noexcep
     }
 }
 
+auto actuatorTopologyFingerprint() noexcept -> uint32_t
+{
+    return 711793834UL;
+}
+
 auto computeIndicatorState(uint8_t indicatorIndex) noexcept -> bool
 {
     switch (indicatorIndex)
@@ -21,6 +21,16 @@
 #define LSH_STATIC_CONFIG_INDICATOR_ACTUATOR_LINKS 1
 #define LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS 6
 #define LSH_STATIC_CONFIG_PULSE_ACTUATORS 0
+#define LSH_STATIC_CONFIG_PRIORITY_INPUTS 0
+#define LSH_STATIC_CONFIG_TOUCH_KEYS 0
+#define LSH_STATIC_CONFIG_MATRIX_KEYS 0
+#define LSH_STATIC_CONFIG_ENCODERS 0
+#define LSH_STATIC_CONFIG_NETWORK_ENCODERS 0
+#define LSH_STATIC_CONFIG_OCCUPANCY_INPUTS 0
+#define LSH_STATIC_CONFIG_NETWORK_OCCUPANCY 0
+#define LSH_STATIC_CONFIG_TEMPERATURE_SENSORS 0
+#define LSH_STATIC_CONFIG_ONE_WIRE_BUSES 0
+#define LSH_STATIC_CONFIG_PEER_ADDRESS 0
 #define LSH_STATIC_CONFIG_ACTIVE_NETWORK_CLICKS 0
 #define LSH_STATIC_CONFIG_DISABLE_NETWORK_CLICKS 1
 
@@ -32,11 +42,13 @@
 #define LSH_GENERATED_LSH_CONFIGS_J1_STATIC_CONFIG_HPP_IMPLEMENTATION
 
 #include "communication/bridge_serial.hpp"
+#include "communication/bridge_transport.hpp"
 #include "config/static_config.hpp"
 #include "core/network_clicks.hpp"
 #include "device/actuator_manager.hpp"
 #include "device/clickable_manager.hpp"
 #include "device/indicator_manager.hpp"
+#include "internal/hot_loop_state.hpp"
 #include "lsh_user_macros.hpp"
 #include "util/constants/click_detection.hpp"
 #include "util/constants/click_results.hpp"
@@ -47,7 +59,7 @@
 
 #if defined(__AVR__)
 #include <avr/pgmspace.h>
-#define LSH_STATIC_CONFIG_PROGMEM PROGMEM
+#define LSH_STATIC_CONFIG_PROGMEM LSH_HOT_PROGMEM
 #define LSH_STATIC_CONFIG_READ_BYTE(address) pgm_read_byte(address)
 #else
 #define LSH_STATIC_CONFIG_PROGMEM
@@ -81,7 +93,7 @@ template <uint16_t ByteIndex, uint16_t PayloadSize> struct GeneratedPayloadByteW
 {
     static auto write(const uint8_t (&payload)[PayloadSize]) noexcept -> bool
     {
-        return CONFIG_COM_SERIAL->HardwareSerial::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[ByteIndex])) == 1U &&
+        return BridgeTransport::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[ByteIndex])) == 1U &&
                GeneratedPayloadByteWriter<static_cast<uint16_t>(ByteIndex + 1U), PayloadSize>::write(payload);
     }
 };
@@ -99,7 +111,7 @@ template <uint16_t PayloadSize> auto writeGeneratedPayloadLoop(const uint8_t (&p
 {
     for (uint16_t byteIndex = 0U; byteIndex < PayloadSize; ++byteIndex)
     {
-        if (CONFIG_COM_SERIAL->HardwareSerial::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex])) != 1U)
+        if (BridgeTransport::write(LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex])) != 1U)
         {
             return false;
         }
@@ -242,6 +254,13 @@ auto writeDetailsPayload() noexcept -> bool
 #endif
 }
 
+auto writeNetworkClickRequestPrefix(uint8_t slotIndex, bool timestamped) noexcept -> bool
+{
+    static_cast<void>(slotIndex);
+    static_cast<void>(timestamped);
+    return false;
+}
+
 [[nodiscard]] __attribute__((always_inline)) inline auto actuator0_rel0ActionSet(bool state) noexcept -> bool;
 [[nodiscard]] __attribute__((always_inline)) inline auto actuator0_rel0ActionSet(bool state, uint32_t actionNow) noexcept -> bool;
 [[nodiscard]] __attribute__((always_inline)) inline auto actuator0_rel0ActionToggle() noexcept -> bool;
@@ -722,6 +741,12 @@ auto getNetworkClickType(uint8_t slotIndex) noexcept -> constants::ClickType
     return constants::ClickType::NONE;
 }
 
+auto getNetworkClickQueueDepth(uint8_t slotIndex) noexcept -> uint8_t
+{
+    static_cast<void>(slotIndex);
+    return 0U;
+}
+
 auto isClickableConfigurationValid(uint8_t clickableIndex) noexcept -> bool
 {
     return clickableIndex < 10U;
@@ -1198,12 +1223,67 @@ auto scanClickables(uint16_t elapsed_ms) noexcept -> uint8_t
     return scanResultFlags;
 }
 
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+auto getBounceProfile(uint8_t clickableIndex) noexcept -> const BounceProfile *
+{
+    switch (clickableIndex)
+    {
+    case 0U:
+        return &button0_btn0.getBounceProfile();
+    case 1U:
+        return &button1_btn1.getBounceProfile();
+    case 2U:
+        return &button2_btn2.getBounceProfile();
+    case 3U:
+        return &button3_btn3.getBounceProfile();
+    case 4U:
+        return &button4_btn4.getBounceProfile();
+    case 5U:
+        return &button5_btn5.getBounceProfile();
+    case 6U:
+        return &button6_btn6.getBounceProfile();
+    case 7U:
+        return &button7_btn7.getBounceProfile();
+    case 8U:
+        return &button8_btn9.getBounceProfile();
+    case 9U:
+        return &button9_btn10.getBounceProfile();
+    default:
+        return nullptr;
+    }
+}
+#endif
+
 auto checkPulseTimers(uint16_t elapsed_ms) noexcept -> bool
 {
     static_cast<void>(elapsed_ms);
     return false;
 }
 
+auto reconcilePriorityInputs() noexcept -> bool
+{
+    return false;
+}
+
+auto drainEncoders() noexcept -> bool
+{
+    return false;
+}
+
+auto scanOccupancy() noexcept -> bool
+{
+    return false;
+}
+
+void reportOccupancy() noexcept
+{
+}
+
+void pollOneWire(uint16_t elapsed_ms) noexcept
+{
+    static_cast<void>(elapsed_ms);
+}
+
 auto checkAutoOffTimers(uint32_t now_ms) noexcept -> bool
 {
     bool anyActuatorChangedState = false;
@@ -1240,6 +1320,81 @@ auto checkAutoOffTimers(uint32_t now_ms) noexcept -> bool
     return anyActuatorChangedState;
 }
 
+auto getActiveTimer(uint8_t timerIndex, uint32_t now_ms, uint8_t &actuatorId, uint32_t &remaining_ms) noexcept -> bool
+{
+    switch (timerIndex)
+    {
+    case 0U:
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+        if (!Actuators::getCompactAutoOffRemaining(0U, actuator0_rel0, now_ms, 600000UL, remaining_ms))
+#else
+        if (!actuator0_rel0.getAutoOffRemaining(now_ms, 600000UL, remaining_ms))
+#endif
+        {
+            return false;
+        }
+        actuatorId = 1U;
+        return true;
+    case 1U:
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+        if (!Actuators::getCompactAutoOffRemaining(1U, actuator1_rel1, now_ms, 3600000UL, remaining_ms))
+#else
+        if (!actuator1_rel1.getAutoOffRemaining(now_ms, 3600000UL, remaining_ms))
+#endif
+        {
+            return false;
+        }
+        actuatorId = 2U;
+        return true;
+    case 2U:
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+        if (!Actuators::getCompactAutoOffRemaining(2U, actuator2_rel2, now_ms, 3600000UL, remaining_ms))
+#else
+        if (!actuator2_rel2.getAutoOffRemaining(now_ms, 3600000UL, remaining_ms))
+#endif
+        {
+            return false;
+        }
+        actuatorId = 3U;
+        return true;
+    case 3U:
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+        if (!Actuators::getCompactAutoOffRemaining(3U, actuator3_rel3, now_ms, 900000UL, remaining_ms))
+#else
+        if (!actuator3_rel3.getAutoOffRemaining(now_ms, 900000UL, remaining_ms))
+#endif
+        {
+            return false;
+        }
+        actuatorId = 4U;
+        return true;
+    case 4U:
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+        if (!Actuators::getCompactAutoOffRemaining(4U, actuator7_rel7, now_ms, 3600000UL, remaining_ms))
+#else
+        if (!actuator7_rel7.getAutoOffRemaining(now_ms, 3600000UL, remaining_ms))
+#endif
+        {
+            return false;
+        }
+        actuatorId = 8U;
+        return true;
+    case 5U:
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES
+        if (!Actuators::getCompactAutoOffRemaining(5U, actuator8_rel9, now_ms, 1800000UL, remaining_ms))
+#else
+        if (!actuator8_rel9.getAutoOffRemaining(now_ms, 1800000UL, remaining_ms))
+#endif
+        {
+            return false;
+        }
+        actuatorId = 10U;
+        return true;
+    default:
+        return false;
+    }
+}
+
 auto applyPackedActuatorStateByte(uint8_t byteIndex, uint8_t packedByte) noexcept -> bool
 {
     switch (byteIndex)
@@ -1271,6 +1426,11 @@ auto applyPackedActuatorStateByte(uint8_t byteIndex, uint8_t packedByte) noexcep
     }
 }
 
+auto actuatorTopologyFingerprint() noexcept -> uint32_t
+{
+    return 3307751622UL;
+}
+
 auto computeIndicatorState(uint8_t indicatorIndex) noexcept -> bool
 {
     switch (indicatorIndex)
@@ -29,6 +29,17 @@
 #include "internal/pin_tag.hpp"
 #include "internal/user_config_bridge.hpp"
 #include "peripherals/input/clickable.hpp"
+#if LSH_STATIC_CONFIG_MATRIX_KEYS > 0
+#include "peripherals/input/key_matrix.hpp"
+#endif
+#include "peripherals/input/occupancy_input.hpp"
+#if LSH_STATIC_CONFIG_ONE_WIRE_BUSES > 0
+#include "peripherals/input/one_wire_bus.hpp"
+#endif
+#include "peripherals/input/rotary_encoder.hpp"
+#if LSH_STATIC_CONFIG_TOUCH_KEYS > 0
+#include "peripherals/input/touch_key.hpp"
+#endif
 #include "peripherals/output/actuator.hpp"
 #include "peripherals/output/indicator.hpp"
 #include "util/debug/debug.hpp"
@@ -47,6 +58,12 @@
  */
 #define LSH_BUTTON(var_name, pin) Clickable var_name(::lsh::core::PinTag<(pin)>{})
 
+/**
+ * @brief Defines a Clickable object fed by a key matrix instead of a pin.
+ * @param var_name The name of the variable to declare (e.g., btn0).
+ */
+#define LSH_MATRIX_BUTTON(var_name) Clickable var_name(SampledInputTag{})
+
 /**
  * @brief Defines an IndicatorLight. Does not require an ID.
  * @param var_name The name of the variable to declare (e.g., light0).
@@ -54,4 +71,45 @@
  */
 #define LSH_INDICATOR(var_name, pin) Indicator var_name(::lsh::core::PinTag<(pin)>{})
 
+/**
+ * @brief Defines a RotaryEncoder object bound to two compile-time pins.
+ * @param var_name The name of the variable to declare (e.g., enc0).
+ * @param pin_a The hardware pin of the A channel.
+ * @param pin_b The hardware pin of the B channel.
+ */
+#define LSH_ENCODER(var_name, pin_a, pin_b) RotaryEncoder var_name(::lsh::core::PinTag<(pin_a)>{}, ::lsh::core::PinTag<(pin_b)>{})
+
+/**
+ * @brief Defines an OccupancyInput object bound to one compile-time pin.
+ * @param var_name The name of the variable to declare (e.g., pir0).
+ * @param pin The hardware pin of the sensor output.
+ */
+#define LSH_OCCUPANCY(var_name, pin) OccupancyInput var_name(::lsh::core::PinTag<(pin)>{})
+
+/**
+ * @brief Defines a OneWireBus object bound to one compile-time pin.
+ * @param var_name The name of the variable to declare (e.g., oneWireBus0).
+ * @param pin The hardware pin of the bus data line.
+ * @param count The number of sensors on the bus.
+ * @param ids The flash table of sensor IDs.
+ * @param roms The flash table of ROM codes, or nullptr for one sensor.
+ * @param readings The raw reading storage of the bus.
+ */
+#define LSH_ONE_WIRE_BUS(var_name, pin, count, ids, roms, readings) \
+    OneWireBus var_name(::lsh::core::PinTag<(pin)>{}, count, ids, roms, readings)
+
+/**
+ * @brief Defines the TouchKey detector of one touch button.
+ * @param var_name The name of the variable to declare (e.g., btn0Touch).
+ */
+#define LSH_TOUCH_KEY(var_name) TouchKey var_name
+
+/**
+ * @brief Defines the KeyMatrix scanned by the generated Timer0 compare-B handler.
+ * @param var_name The name of the variable to declare (e.g., keyMatrix).
+ * @param rows The number of driven rows.
+ * @param diodes True when every key has its own diode.
+ */
+#define LSH_KEY_MATRIX(var_name, rows, diodes) KeyMatrix<(rows), (diodes)> var_name
+
 #endif  // LSH_CORE_LSH_USER_MACROS_HPP
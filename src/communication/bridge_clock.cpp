@@ -0,0 +1,214 @@
+/**
+ * @file    bridge_clock.cpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Implements the offset and drift estimate used to timestamp outgoing bridge events.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "communication/bridge_clock.hpp"
+
+#include "communication/constants/config.hpp"
+
+namespace BridgeClock
+{
+#ifdef CONFIG_BRIDGE_TIME_SYNC
+namespace
+{
+constexpr int32_t MAX_DRIFT_PPM = 5000;                             //!< Larger samples mean the bridge clock stepped.
+constexpr int32_t MAX_DRIFT_ERROR_MS = 2000000;                     //!< Bound that keeps `error_ms * 1000` inside int32_t.
+constexpr int32_t MAX_EXTRAPOLATION_S = INT32_MAX / MAX_DRIFT_PPM;  //!< Bound that keeps `seconds * ppm` inside int32_t.
+
+bool synced = false;                //!< True once the current session accepted at least one TIME_SYNC.
+bool driftValid = false;            //!< True once the drift estimate holds at least one accepted sample.
+uint32_t anchorLocal_ms = 0U;       //!< Local time of the latest TIME_SYNC, origin of every mapping.
+uint32_t anchorBridge_ms = 0U;      //!< Bridge time carried by the latest TIME_SYNC.
+uint32_t driftRefLocal_ms = 0U;     //!< Local time of the reference used for the next drift sample.
+uint32_t driftRefBridge_ms = 0U;    //!< Bridge time of the reference used for the next drift sample.
+int32_t drift_ppm = 0;              //!< Filtered bridge-minus-local drift in parts per million.
+uint32_t stateChangeLocal_ms = 0U;  //!< Local time of the latest actuator state change.
+
+/**
+ * @brief Fold one drift sample measured between two far-apart TIME_SYNC references.
+ * @details Runs entirely in 32-bit arithmetic: AVR would otherwise pull in the
+ *          64-bit division helpers for a path that only runs on TIME_SYNC.
+ *
+ * @param bridgeTime_ms Bridge time carried by the current TIME_SYNC.
+ * @param localTime_ms Local time at which the current TIME_SYNC was received.
+ */
+void updateDrift(uint32_t bridgeTime_ms, uint32_t localTime_ms)
+{
+    using constants::bridgeSerial::TIME_SYNC_MIN_DRIFT_SPAN_MS;
+
+    const uint32_t localSpan_ms = localTime_ms - driftRefLocal_ms;
+    if (localSpan_ms < TIME_SYNC_MIN_DRIFT_SPAN_MS)
+    {
+        return;
+    }
+
+    const int32_t error_ms = static_cast<int32_t>((bridgeTime_ms - driftRefBridge_ms) - localSpan_ms);
+    driftRefLocal_ms = localTime_ms;
+    driftRefBridge_ms = bridgeTime_ms;
+    if (error_ms > MAX_DRIFT_ERROR_MS || error_ms < -MAX_DRIFT_ERROR_MS)
+    {
+        return;
+    }
+
+    const int32_t sample_ppm = (error_ms * 1000) / static_cast<int32_t>(localSpan_ms / 1000U);
+    if (sample_ppm > MAX_DRIFT_PPM || sample_ppm < -MAX_DRIFT_PPM)
+    {
+        return;
+    }
+
+    if (!driftValid)
+    {
+        drift_ppm = sample_ppm;
+        driftValid = true;
+        return;
+    }
+    // First-order low-pass: one noisy reference moves the estimate by a quarter.
+    drift_ppm += (sample_ppm - drift_ppm) / 4;
+}
+}  // namespace
+
+/**
+ * @brief Forget every time reference and the drift estimate.
+ * @details A bridge BOOT may come from a bridge whose clock restarted, so the
+ *          previous mapping cannot be trusted anymore. Outgoing events stop
+ *          carrying timestamps until the next `TIME_SYNC`.
+ */
+void reset()
+{
+    synced = false;
+    driftValid = false;
+    drift_ppm = 0;
+}
+
+/**
+ * @brief Anchor one bridge time reference to the local receive time.
+ * @details Every reference moves the offset anchor. The drift estimate uses a
+ *          separate reference pair that only advances once the two samples are
+ *          at least `TIME_SYNC_MIN_DRIFT_SPAN_MS` apart, so a bridge that syncs
+ *          often still produces meaningful ppm samples. The one-way serial
+ *          latency of the TIME_SYNC frame is folded into the offset.
+ *
+ * @param bridgeTime_ms Bridge time carried by `TIME_SYNC`.
+ * @param localTime_ms Cached controller time at which the frame was dispatched.
+ */
+void onTimeSync(uint32_t bridgeTime_ms, uint32_t localTime_ms)
+{
+    if (!synced)
+    {
+        driftRefLocal_ms = localTime_ms;
+        driftRefBridge_ms = bridgeTime_ms;
+        synced = true;
+    }
+    else
+    {
+        updateDrift(bridgeTime_ms, localTime_ms);
+    }
+    anchorLocal_ms = localTime_ms;
+    anchorBridge_ms = bridgeTime_ms;
+}
+
+/**
+ * @brief Remember when the actuator state last changed.
+ * @details `ACTUATORS_STATE` may leave the controller well after the change
+ *          that triggered it, so the payload carries this time instead of the
+ *          transmit time.
+ *
+ * @param localTime_ms Cached controller time of the change.
+ */
+void noteStateChange(uint32_t localTime_ms)
+{
+    stateChangeLocal_ms = localTime_ms;
+}
+
+/**
+ * @brief Return whether outgoing events may carry a bridge timestamp.
+ *
+ * @return true once the current session accepted at least one `TIME_SYNC`.
+ * @return false otherwise.
+ */
+auto isSynced() -> bool
+{
+    return synced;
+}
+
+/**
+ * @brief Map one local timestamp to the bridge time base.
+ * @details Offset plus drift correction relative to the latest anchor. Local
+ *          times slightly older than the anchor are handled through the signed
+ *          difference. Extrapolation is bounded to roughly five days, far
+ *          beyond any sane TIME_SYNC interval.
+ *
+ * @param localTime_ms Controller time to map.
+ * @return uint32_t Bridge time, wrapping modulo 2^32 like the bridge clock.
+ */
+auto toBridgeTime(uint32_t localTime_ms) -> uint32_t
+{
+    const int32_t sinceAnchor_ms = static_cast<int32_t>(localTime_ms - anchorLocal_ms);
+    int32_t sinceAnchor_s = sinceAnchor_ms / 1000;
+    if (sinceAnchor_s > MAX_EXTRAPOLATION_S)
+    {
+        sinceAnchor_s = MAX_EXTRAPOLATION_S;
+    }
+    else if (sinceAnchor_s < -MAX_EXTRAPOLATION_S)
+    {
+        sinceAnchor_s = -MAX_EXTRAPOLATION_S;
+    }
+    const int32_t correction_ms = (sinceAnchor_s * drift_ppm) / 1000;
+    return anchorBridge_ms + static_cast<uint32_t>(sinceAnchor_ms) + static_cast<uint32_t>(correction_ms);
+}
+
+/**
+ * @brief Bridge time of the latest actuator state change.
+ */
+auto stateChangeBridgeTime() -> uint32_t
+{
+    return toBridgeTime(stateChangeLocal_ms);
+}
+#else
+void reset()
+{
+}
+
+void onTimeSync(uint32_t bridgeTime_ms, uint32_t localTime_ms)
+{
+    static_cast<void>(bridgeTime_ms);
+    static_cast<void>(localTime_ms);
+}
+
+void noteStateChange(uint32_t localTime_ms)
+{
+    static_cast<void>(localTime_ms);
+}
+
+auto isSynced() -> bool
+{
+    return false;
+}
+
+auto toBridgeTime(uint32_t localTime_ms) -> uint32_t
+{
+    return localTime_ms;
+}
+
+auto stateChangeBridgeTime() -> uint32_t
+{
+    return 0U;
+}
+#endif  // CONFIG_BRIDGE_TIME_SYNC
+}  // namespace BridgeClock
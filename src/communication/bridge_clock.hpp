@@ -0,0 +1,47 @@
+/**
+ * @file    bridge_clock.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Maps the controller millisecond counter to the bridge time base.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_COMMUNICATION_BRIDGE_CLOCK_HPP
+#define LSH_CORE_COMMUNICATION_BRIDGE_CLOCK_HPP
+
+#include <stdint.h>
+
+/**
+ * @brief Offset and drift estimate between the controller clock and the bridge clock.
+ *
+ * @details Active only with `CONFIG_BRIDGE_TIME_SYNC`; otherwise every call is a
+ * no-op and `isSynced()` stays false. The bridge sends `TIME_SYNC` with its own
+ * millisecond time; the controller anchors that value to its cached loop time
+ * and, once two references are far enough apart, estimates the crystal drift in
+ * ppm. Outgoing events then carry `m`, the event
+ * time mapped into the bridge time base, so consumers no longer fold serial
+ * queueing and loop jitter into their measurements.
+ */
+namespace BridgeClock
+{
+void reset();                                                        // Forget every time reference, for example after a bridge BOOT.
+void onTimeSync(uint32_t bridgeTime_ms, uint32_t localTime_ms);      // Anchor one bridge time reference to the local receive time.
+void noteStateChange(uint32_t localTime_ms);                         // Remember when the actuator state last changed.
+[[nodiscard]] auto isSynced() -> bool;                               // Return true once at least one TIME_SYNC has been accepted.
+[[nodiscard]] auto toBridgeTime(uint32_t localTime_ms) -> uint32_t;  // Map one local timestamp to the bridge time base.
+[[nodiscard]] auto stateChangeBridgeTime() -> uint32_t;              // Bridge time of the latest actuator state change.
+}  // namespace BridgeClock
+
+#endif  // LSH_CORE_COMMUNICATION_BRIDGE_CLOCK_HPP
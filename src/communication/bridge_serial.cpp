@@ -20,7 +20,9 @@
 
 #include "communication/bridge_serial.hpp"
 
+#include "communication/bridge_transport.hpp"
 #include "communication/deserializer.hpp"
+#include "communication/link_health.hpp"
 #include "communication/msgpack_serial_framing.hpp"
 #include "communication/constants/config.hpp"
 #include "communication/constants/protocol.hpp"
@@ -60,13 +62,14 @@ bool discardUntilNewline = false;                                     //!< True
 
 /**
  * @brief Initialize the serial port used to talk with `lsh-bridge`.
- * @details The controller and the bridge share one hardware serial link.
- *          This helper applies the configured baud rate once during startup so
- *          every later send/receive path can assume the port is already ready.
+ * @details The controller and the bridge share one hardware serial link, or
+ *          the MCP2515 CAN link when `CONFIG_BRIDGE_CAN` is set. This helper
+ *          configures it once during startup so every later send/receive path
+ *          can assume the transport is already ready.
  */
 void init()
 {
-    CONFIG_COM_SERIAL->HardwareSerial::begin(constants::bridgeSerial::COM_SERIAL_BAUD, SERIAL_8N1);
+    BridgeTransport::begin();
 }
 
 /**
@@ -90,9 +93,9 @@ auto receiveAndDispatch(uint16_t maxBytesToConsume) -> ReceiveResult
     const uint32_t nowRealTime_ms = timeKeeper::getRealTime();
     msgPackFrameReceiver.resetIfIdle(nowRealTime_ms, constants::bridgeSerial::COM_SERIAL_MSGPACK_FRAME_IDLE_TIMEOUT_MS);
 
-    while (CONFIG_COM_SERIAL->HardwareSerial::available() && receiveResult.consumedBytes < maxBytesToConsume)
+    while (BridgeTransport::available() && receiveResult.consumedBytes < maxBytesToConsume)
     {
-        const int rawByte = CONFIG_COM_SERIAL->HardwareSerial::read();
+        const int rawByte = BridgeTransport::read();
         if (rawByte < 0)
         {
             break;
@@ -103,6 +106,9 @@ auto receiveAndDispatch(uint16_t maxBytesToConsume) -> ReceiveResult
         if (consumeResult == MsgPackFrameConsumeResult::FrameDiscarded)
         {
             DPL(F("Discarded malformed framed MsgPack bridge payload."));
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+            LinkHealth::noteRxError();
+#endif
             return receiveResult;
         }
 
@@ -118,6 +124,9 @@ auto receiveAndDispatch(uint16_t maxBytesToConsume) -> ReceiveResult
         if (deserializationError != DeserializationError::Ok)
         {
             DPL(deserializationError.f_str());
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+            LinkHealth::noteRxError();
+#endif
             return receiveResult;
         }
 
@@ -131,9 +140,9 @@ auto receiveAndDispatch(uint16_t maxBytesToConsume) -> ReceiveResult
     return receiveResult;
 
 #else
-    while (CONFIG_COM_SERIAL->HardwareSerial::available() && receiveResult.consumedBytes < maxBytesToConsume)
+    while (BridgeTransport::available() && receiveResult.consumedBytes < maxBytesToConsume)
     {
-        const int rawByte = CONFIG_COM_SERIAL->HardwareSerial::read();
+        const int rawByte = BridgeTransport::read();
         if (rawByte < 0)
         {
             break;
@@ -174,6 +183,9 @@ auto receiveAndDispatch(uint16_t maxBytesToConsume) -> ReceiveResult
                 else
                 {
                     DPL(deserializationError.f_str());
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+                    LinkHealth::noteRxError();
+#endif
                     return receiveResult;
                 }
             }
@@ -191,6 +203,9 @@ auto receiveAndDispatch(uint16_t maxBytesToConsume) -> ReceiveResult
             // newline terminator, otherwise the payload tail could be misread as a
             // fresh command on the next iterations.
             DPL("Buffer overflow!");
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+            LinkHealth::noteRxError();
+#endif
             bufferedBytesCount = 0U;
             discardUntilNewline = true;
         }
@@ -20,6 +20,7 @@
 
 #include "communication/bridge_sync.hpp"
 
+#include "communication/bridge_clock.hpp"
 #include "communication/constants/config.hpp"
 #include "communication/serializer.hpp"
 #include "util/saturating_time.hpp"
@@ -75,6 +76,7 @@ void begin()
     syncState = State::AwaitBridgeDetails;
     awaitingStateAge_ms = 0U;
     bootRetryAge_ms = TIMER_READY;
+    BridgeClock::reset();
     (void)sendBoot();
 }
 
@@ -90,6 +92,7 @@ void restartFromBridgeBoot()
     syncState = State::AwaitBridgeDetails;
     awaitingStateAge_ms = 0U;
     bootRetryAge_ms = 0U;
+    BridgeClock::reset();  // A rebooted bridge may run a restarted clock.
 }
 
 /**
@@ -0,0 +1,97 @@
+/**
+ * @file    bridge_transport.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Selects the byte transport that carries the bridge protocol.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_COMMUNICATION_BRIDGE_TRANSPORT_HPP
+#define LSH_CORE_COMMUNICATION_BRIDGE_TRANSPORT_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "communication/constants/config.hpp"
+#include "internal/user_config_bridge.hpp"
+#ifdef CONFIG_BRIDGE_CAN
+#include "communication/can_bridge_link.hpp"
+#endif
+
+/**
+ * @brief Every bridge byte goes through here.
+ *
+ * @details The default build forwards to the non-virtual `HardwareSerial`
+ *          calls on `CONFIG_COM_SERIAL`, exactly what the call sites did
+ *          before, so the wrappers inline away. `CONFIG_BRIDGE_CAN` swaps in
+ *          the MCP2515 link without touching the serializer, the receiver or
+ *          the generated payload writers.
+ */
+namespace BridgeTransport
+{
+#ifdef CONFIG_BRIDGE_CAN
+inline void begin()
+{
+    CanBridgeLink::begin();
+}
+
+[[nodiscard]] inline auto available() -> int
+{
+    return CanBridgeLink::available();
+}
+
+[[nodiscard]] inline auto read() -> int
+{
+    return CanBridgeLink::read();
+}
+
+[[nodiscard]] inline auto write(uint8_t byte) -> size_t
+{
+    return CanBridgeLink::write(byte);
+}
+
+inline void flush()
+{
+    CanBridgeLink::flush();
+}
+#else
+inline void begin()
+{
+    CONFIG_COM_SERIAL->HardwareSerial::begin(constants::bridgeSerial::COM_SERIAL_BAUD, SERIAL_8N1);
+}
+
+[[nodiscard]] inline auto available() -> int
+{
+    return CONFIG_COM_SERIAL->HardwareSerial::available();
+}
+
+[[nodiscard]] inline auto read() -> int
+{
+    return CONFIG_COM_SERIAL->HardwareSerial::read();
+}
+
+[[nodiscard]] inline auto write(uint8_t byte) -> size_t
+{
+    return CONFIG_COM_SERIAL->HardwareSerial::write(byte);
+}
+
+inline void flush()
+{
+    CONFIG_COM_SERIAL->HardwareSerial::flush();
+}
+#endif  // CONFIG_BRIDGE_CAN
+}  // namespace BridgeTransport
+
+#endif  // LSH_CORE_COMMUNICATION_BRIDGE_TRANSPORT_HPP
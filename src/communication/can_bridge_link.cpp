@@ -0,0 +1,542 @@
+/**
+ * @file    can_bridge_link.cpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Implements the MCP2515 CAN transport used instead of the bridge UART.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "communication/can_bridge_link.hpp"
+
+#ifdef CONFIG_BRIDGE_CAN
+#include <Arduino.h>
+#include <SPI.h>
+
+#include "communication/can_framing.hpp"
+#include "communication/constants/config.hpp"
+#include "communication/link_health.hpp"
+#include "communication/msgpack_serial_framing.hpp"
+
+namespace CanBridgeLink
+{
+namespace
+{
+using namespace lsh::core::transport;
+using constants::bridgeSerial::RAW_INPUT_BUFFER_SIZE;
+using constants::canBus::CAN_CRYSTAL_MHZ;
+using constants::canBus::CAN_BITRATE_KBPS;
+using constants::canBus::CAN_CS_PIN;
+using constants::canBus::CAN_INT_PIN;
+using constants::canBus::CAN_NODE_ID;
+using constants::canBus::CAN_RX_QUEUE_FRAMES;
+using constants::canBus::CAN_TX_TIMEOUT_US;
+
+// MCP2515 SPI instructions.
+constexpr uint8_t MCP_RESET = 0xC0U;
+constexpr uint8_t MCP_WRITE = 0x02U;
+constexpr uint8_t MCP_READ = 0x03U;
+constexpr uint8_t MCP_BIT_MODIFY = 0x05U;
+constexpr uint8_t MCP_LOAD_TX0 = 0x40U;
+constexpr uint8_t MCP_RTS_TX0 = 0x81U;
+constexpr uint8_t MCP_READ_RX0 = 0x90U;
+constexpr uint8_t MCP_READ_RX1 = 0x94U;
+constexpr uint8_t MCP_READ_STATUS = 0xA0U;
+
+// MCP2515 registers and bits.
+constexpr uint8_t REG_RXF0 = 0x00U;
+constexpr uint8_t REG_RXF3 = 0x10U;
+constexpr uint8_t REG_CANSTAT = 0x0EU;
+constexpr uint8_t REG_CANCTRL = 0x0FU;
+constexpr uint8_t REG_RXM0 = 0x20U;
+constexpr uint8_t REG_CNF3 = 0x28U;  // CNF3, CNF2, CNF1 and CANINTE are consecutive.
+constexpr uint8_t REG_TXB0CTRL = 0x30U;
+constexpr uint8_t REG_RXB0CTRL = 0x60U;
+constexpr uint8_t REG_RXB1CTRL = 0x70U;
+constexpr uint8_t MODE_MASK = 0xE0U;
+constexpr uint8_t MODE_NORMAL = 0x00U;
+constexpr uint8_t TXB_TXREQ = 0x08U;
+constexpr uint8_t RXB0_BUKT = 0x04U;
+constexpr uint8_t CANINTE_RX_BOTH = 0x03U;
+constexpr uint8_t STATUS_RX0IF = 0x01U;
+constexpr uint8_t STATUS_RX1IF = 0x02U;
+constexpr uint8_t STATUS_TX0REQ = 0x04U;
+constexpr uint8_t SIDL_IDE = 0x08U;
+constexpr uint8_t RX_QUEUE_MASK = static_cast<uint8_t>(CAN_RX_QUEUE_FRAMES - 1U);
+
+#ifdef NOT_AN_INTERRUPT
+static_assert(digitalPinToInterrupt(CAN_INT_PIN) != NOT_AN_INTERRUPT, "CONFIG_CAN_INT_PIN must be an external interrupt pin.");
+#endif
+
+// Bit timing: Fosc / (2 * bitrate) time-quantum ticks per bit, split into the
+// largest of 16, 10 or 8 quanta that keeps the baud-rate prescaler in range.
+constexpr uint16_t BIT_TICKS = static_cast<uint16_t>((static_cast<uint32_t>(CAN_CRYSTAL_MHZ) * 500U) / CAN_BITRATE_KBPS);
+static_assert((static_cast<uint32_t>(CAN_CRYSTAL_MHZ) * 500U) % CAN_BITRATE_KBPS == 0U,
+              "CONFIG_CAN_BITRATE_KBPS must divide the MCP2515 crystal into whole time quanta.");
+
+[[nodiscard]] constexpr auto fitsQuanta(uint8_t quanta) -> bool
+{
+    return BIT_TICKS % quanta == 0U && BIT_TICKS / quanta >= 1U && BIT_TICKS / quanta <= 64U;
+}
+
+constexpr uint8_t QUANTA_PER_BIT = fitsQuanta(16U) ? 16U : (fitsQuanta(10U) ? 10U : (fitsQuanta(8U) ? 8U : 0U));
+static_assert(QUANTA_PER_BIT != 0U, "CONFIG_CAN_BITRATE_KBPS is not reachable with CONFIG_CAN_CRYSTAL_MHZ.");
+constexpr uint8_t PROP_SEG = QUANTA_PER_BIT == 16U ? 5U : (QUANTA_PER_BIT == 10U ? 3U : 2U);
+constexpr uint8_t PHASE_SEG1 = QUANTA_PER_BIT == 16U ? 6U : 3U;
+constexpr uint8_t PHASE_SEG2 = static_cast<uint8_t>(QUANTA_PER_BIT - 1U - PROP_SEG - PHASE_SEG1);
+static_assert(PHASE_SEG2 >= 2U && PHASE_SEG2 <= PHASE_SEG1 + PROP_SEG, "Invalid MCP2515 segment split.");
+constexpr uint8_t CNF1_VALUE = static_cast<uint8_t>(BIT_TICKS / QUANTA_PER_BIT - 1U);  // SJW = 1 TQ.
+constexpr uint8_t CNF2_VALUE = static_cast<uint8_t>(0x80U | ((PHASE_SEG1 - 1U) << 3U) | (PROP_SEG - 1U));
+constexpr uint8_t CNF3_VALUE = static_cast<uint8_t>(PHASE_SEG2 - 1U);
+
+// Inbound frames are addressed to this node in the bridge-to-controller
+// direction; the mask ignores the priority bits.
+constexpr uint16_t RX_FILTER_ID = canIdentifier(0U, CAN_NODE_ID, false);
+constexpr uint8_t RX_FILTER_SIDH = static_cast<uint8_t>(RX_FILTER_ID >> 3U);
+constexpr uint8_t RX_FILTER_SIDL = static_cast<uint8_t>((RX_FILTER_ID & 0x07U) << 5U);
+constexpr uint8_t RX_MASK_SIDH = 0x1FU;
+constexpr uint8_t RX_MASK_SIDL = 0xE0U;
+
+/**
+ * @brief Replay state of one reassembled inbound payload.
+ */
+enum class ReplayPhase : uint8_t
+{
+    Idle,     //!< Nothing to replay, `available()` may poll the controller.
+    Opening,  //!< Next byte is the opening delimiter.
+    Body,     //!< Next byte comes from the payload, escaped when needed.
+};
+
+/**
+ * @brief One received data frame, as stored by the INT handler.
+ */
+struct RxFrame
+{
+    uint8_t length;   //!< Data bytes, `1..8`.
+    uint8_t data[8];  //!< Segment header followed by payload bytes.
+};
+
+RxFrame rxQueue[CAN_RX_QUEUE_FRAMES] = {};      //!< Frames moved out of the MCP2515 by the INT handler.
+volatile uint8_t rxQueueHead = 0U;              //!< Next slot written by the INT handler.
+volatile uint8_t rxQueueTail = 0U;              //!< Next slot consumed by the loop.
+uint8_t rxPayload[RAW_INPUT_BUFFER_SIZE] = {};  //!< Payload being reassembled or replayed.
+uint16_t rxLength = 0U;                         //!< Bytes stored in `rxPayload`.
+uint16_t replayIndex = 0U;                      //!< Next payload byte to replay.
+uint8_t rxSequence = 0U;                        //!< Expected segment sequence of the next inbound frame.
+bool rxAssembling = false;                      //!< True between a START and an END segment.
+bool replayEscapeSent = false;                  //!< True after the escape marker of `rxPayload[replayIndex]` was replayed.
+ReplayPhase replayPhase = ReplayPhase::Idle;    //!< Current replay step.
+
+uint8_t txFrame[8] = {};                       //!< Staged outbound frame, byte 0 reserved for the segment header.
+uint8_t txFill = 0U;                           //!< Payload bytes staged in `txFrame`.
+uint8_t txSequence = 0U;                       //!< Segment sequence of the staged frame.
+uint16_t txPayloadBytes = 0U;                  //!< Unescaped bytes of the current payload so far.
+uint16_t txIdentifier = 0U;                    //!< Identifier shared by every frame of the current payload.
+bool txInFrame = false;                        //!< True after an opening delimiter.
+bool txEscape = false;                         //!< True after an escape marker.
+bool txDropping = false;                       //!< True after a frame could not be queued, until the next delimiter.
+
+void select()
+{
+    SPI.beginTransaction(SPISettings(8000000UL, MSBFIRST, SPI_MODE0));
+    digitalWrite(CAN_CS_PIN, LOW);
+}
+
+void deselect()
+{
+    digitalWrite(CAN_CS_PIN, HIGH);
+    SPI.endTransaction();
+}
+
+void writeRegisters(uint8_t address, const uint8_t *values, uint8_t count)
+{
+    select();
+    SPI.transfer(MCP_WRITE);
+    SPI.transfer(address);
+    for (uint8_t index = 0U; index < count; ++index)
+    {
+        SPI.transfer(values[index]);
+    }
+    deselect();
+}
+
+[[nodiscard]] auto readRegister(uint8_t address) -> uint8_t
+{
+    select();
+    SPI.transfer(MCP_READ);
+    SPI.transfer(address);
+    const uint8_t value = SPI.transfer(0U);
+    deselect();
+    return value;
+}
+
+void modifyRegister(uint8_t address, uint8_t mask, uint8_t value)
+{
+    select();
+    SPI.transfer(MCP_BIT_MODIFY);
+    SPI.transfer(address);
+    SPI.transfer(mask);
+    SPI.transfer(value);
+    deselect();
+}
+
+[[nodiscard]] auto readStatus() -> uint8_t
+{
+    select();
+    SPI.transfer(MCP_READ_STATUS);
+    const uint8_t status = SPI.transfer(0U);
+    deselect();
+    return status;
+}
+
+/**
+ * @brief Wait, bounded by `CONFIG_CAN_TX_TIMEOUT_US`, until TXB0 is free.
+ *
+ * @details On timeout the pending request is aborted, so a missing ACK or a
+ *          bus-off controller cannot wedge every later payload.
+ */
+[[nodiscard]] auto waitTransmitBuffer() -> bool
+{
+    const uint32_t start_us = micros();
+    while ((readStatus() & STATUS_TX0REQ) != 0U)
+    {
+        if (static_cast<uint32_t>(micros() - start_us) >= CAN_TX_TIMEOUT_US)
+        {
+            modifyRegister(REG_TXB0CTRL, TXB_TXREQ, 0U);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Queue the staged frame on TXB0.
+ *
+ * @details Only one transmit buffer is used: the MCP2515 picks between its
+ *          buffers by priority, which could reorder segments of one payload.
+ *
+ * @param endFlag `CAN_SEGMENT_END` for the last frame of a payload, else `0`.
+ */
+[[nodiscard]] auto sendStagedFrame(uint8_t endFlag) -> bool
+{
+    if (!waitTransmitBuffer())
+    {
+        return false;
+    }
+    const uint8_t startFlag = txSequence == 0U ? CAN_SEGMENT_START : 0U;
+    txFrame[0] = static_cast<uint8_t>(startFlag | endFlag | (txSequence & CAN_SEGMENT_SEQUENCE_MASK));
+    select();
+    SPI.transfer(MCP_LOAD_TX0);
+    SPI.transfer(static_cast<uint8_t>(txIdentifier >> 3U));
+    SPI.transfer(static_cast<uint8_t>((txIdentifier & 0x07U) << 5U));
+    SPI.transfer(0U);
+    SPI.transfer(0U);
+    SPI.transfer(static_cast<uint8_t>(txFill + 1U));
+    for (uint8_t index = 0U; index <= txFill; ++index)
+    {
+        SPI.transfer(txFrame[index]);
+    }
+    deselect();
+    select();
+    SPI.transfer(MCP_RTS_TX0);
+    deselect();
+    ++txSequence;
+    txFill = 0U;
+    return true;
+}
+
+/**
+ * @brief Stage one unescaped payload byte, sending the previous full frame first.
+ *
+ * @details A full frame waits for the next byte so the last frame of the
+ *          payload can still receive the END flag at the closing delimiter.
+ */
+[[nodiscard]] auto stagePayloadByte(uint8_t byte) -> bool
+{
+    if (txFill == CAN_SEGMENT_PAYLOAD_BYTES && !sendStagedFrame(0U))
+    {
+        return false;
+    }
+    txFrame[txFill + 1U] = byte;
+    ++txFill;
+    // Every payload starts with `[fixmap][0xA1]['p'][command]`, so the
+    // arbitration class is known before the first frame leaves.
+    if (txPayloadBytes == 3U && txFrame[2] == 0xA1U && txFrame[3] == static_cast<uint8_t>('p'))
+    {
+        txIdentifier = canIdentifier(canPriorityFor(byte), CAN_NODE_ID, true);
+    }
+    ++txPayloadBytes;
+    return true;
+}
+
+/**
+ * @brief Fold one inbound segment into the reassembly buffer.
+ *
+ * @return true when the segment completed a payload.
+ */
+[[nodiscard]] auto acceptSegment(const uint8_t *data, uint8_t length) -> bool
+{
+    const uint8_t header = data[0];
+    if ((header & CAN_SEGMENT_START) != 0U)
+    {
+        rxAssembling = true;
+        rxLength = 0U;
+        rxSequence = 0U;
+    }
+    if (!rxAssembling || (header & CAN_SEGMENT_SEQUENCE_MASK) != rxSequence ||
+        rxLength + static_cast<uint16_t>(length - 1U) > RAW_INPUT_BUFFER_SIZE)
+    {
+        if (rxAssembling)
+        {
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+            LinkHealth::noteRxError();
+#endif
+        }
+        rxAssembling = false;
+        return false;
+    }
+    for (uint8_t index = 1U; index < length; ++index)
+    {
+        rxPayload[rxLength++] = data[index];
+    }
+    rxSequence = static_cast<uint8_t>((rxSequence + 1U) & CAN_SEGMENT_SEQUENCE_MASK);
+    if ((header & CAN_SEGMENT_END) == 0U)
+    {
+        return false;
+    }
+    rxAssembling = false;
+    return rxLength != 0U;
+}
+
+/**
+ * @brief Move received frames from the MCP2515 into `rxQueue`.
+ *
+ * @details Runs from the INT handler, or from the loop with interrupts
+ *          disabled, so the two never read the same receive buffer. A full
+ *          queue leaves frames in the controller with INT still asserted;
+ *          `available()` retries once the loop has consumed some of them.
+ */
+void drainController()
+{
+    while (digitalRead(CAN_INT_PIN) == LOW && static_cast<uint8_t>(rxQueueHead - rxQueueTail) < CAN_RX_QUEUE_FRAMES)
+    {
+        const uint8_t status = readStatus();
+        uint8_t instruction = 0U;
+        if ((status & STATUS_RX0IF) != 0U)
+        {
+            instruction = MCP_READ_RX0;
+        }
+        else if ((status & STATUS_RX1IF) != 0U)
+        {
+            instruction = MCP_READ_RX1;
+        }
+        else
+        {
+            return;
+        }
+
+        // READ RX BUFFER clears the matching interrupt flag when CS rises.
+        RxFrame &frame = rxQueue[rxQueueHead & RX_QUEUE_MASK];
+        uint8_t header[5] = {};
+        select();
+        SPI.transfer(instruction);
+        for (uint8_t &byte : header)
+        {
+            byte = SPI.transfer(0U);
+        }
+        frame.length = header[4] & 0x0FU;
+        for (uint8_t index = 0U; index < frame.length && index < sizeof(frame.data); ++index)
+        {
+            frame.data[index] = SPI.transfer(0U);
+        }
+        deselect();
+
+        if ((header[1] & SIDL_IDE) == 0U && frame.length != 0U && frame.length <= sizeof(frame.data))
+        {
+            ++rxQueueHead;
+        }
+    }
+}
+
+void onControllerInterrupt()
+{
+    drainController();
+}
+
+/**
+ * @brief Reassemble queued frames until a payload is ready to replay.
+ *
+ * @details Called only while no payload is being replayed, so `rxPayload`
+ *          is free. Frames that arrive meanwhile wait in `rxQueue`.
+ */
+void takeFrames()
+{
+    while (rxQueueTail != rxQueueHead)
+    {
+        noInterrupts();
+        const RxFrame frame = rxQueue[rxQueueTail & RX_QUEUE_MASK];
+        ++rxQueueTail;
+        interrupts();
+        if (acceptSegment(frame.data, frame.length))
+        {
+            replayPhase = ReplayPhase::Opening;
+            replayIndex = 0U;
+            replayEscapeSent = false;
+            return;
+        }
+    }
+}
+}  // namespace
+
+void begin()
+{
+    pinMode(CAN_CS_PIN, OUTPUT);
+    digitalWrite(CAN_CS_PIN, HIGH);
+    pinMode(CAN_INT_PIN, INPUT_PULLUP);
+    SPI.begin();
+
+    select();
+    SPI.transfer(MCP_RESET);
+    deselect();
+    delay(10U);  // Oscillator start-up after the reset, setup only.
+
+    // Reset leaves the controller in configuration mode.
+    const uint8_t mask[4] = {RX_MASK_SIDH, RX_MASK_SIDL, 0U, 0U};
+    const uint8_t filters[12] = {RX_FILTER_SIDH, RX_FILTER_SIDL, 0U, 0U, RX_FILTER_SIDH, RX_FILTER_SIDL, 0U, 0U,
+                                 RX_FILTER_SIDH, RX_FILTER_SIDL, 0U, 0U};
+    writeRegisters(REG_RXM0, mask, sizeof(mask));
+    writeRegisters(static_cast<uint8_t>(REG_RXM0 + 4U), mask, sizeof(mask));
+    writeRegisters(REG_RXF0, filters, sizeof(filters));
+    writeRegisters(REG_RXF3, filters, sizeof(filters));
+    const uint8_t rxb0Control = RXB0_BUKT;
+    const uint8_t rxb1Control = 0U;
+    writeRegisters(REG_RXB0CTRL, &rxb0Control, 1U);
+    writeRegisters(REG_RXB1CTRL, &rxb1Control, 1U);
+    const uint8_t timing[4] = {CNF3_VALUE, CNF2_VALUE, CNF1_VALUE, CANINTE_RX_BOTH};
+    writeRegisters(REG_CNF3, timing, sizeof(timing));
+
+    // Loop transactions mask INT, so the handler never interleaves with them.
+    SPI.usingInterrupt(digitalPinToInterrupt(CAN_INT_PIN));
+    attachInterrupt(digitalPinToInterrupt(CAN_INT_PIN), onControllerInterrupt, FALLING);
+
+    modifyRegister(REG_CANCTRL, MODE_MASK, MODE_NORMAL);
+    for (uint8_t attempt = 0U; attempt < UINT8_MAX && (readRegister(REG_CANSTAT) & MODE_MASK) != MODE_NORMAL; ++attempt)
+    {
+        delayMicroseconds(10U);
+    }
+}
+
+auto available() -> int
+{
+    // A full queue made the handler leave INT asserted, so no new edge comes.
+    if (digitalRead(CAN_INT_PIN) == LOW)
+    {
+        noInterrupts();
+        drainController();
+        interrupts();
+    }
+    if (replayPhase == ReplayPhase::Idle)
+    {
+        takeFrames();
+    }
+    return replayPhase == ReplayPhase::Idle ? 0 : 1;
+}
+
+auto read() -> int
+{
+    switch (replayPhase)
+    {
+    case ReplayPhase::Opening:
+        replayPhase = ReplayPhase::Body;
+        return MSGPACK_FRAME_END;
+    case ReplayPhase::Body:
+        break;
+    default:
+        return -1;
+    }
+
+    if (replayIndex == rxLength)
+    {
+        replayPhase = ReplayPhase::Idle;
+        return MSGPACK_FRAME_END;
+    }
+    const uint8_t byte = rxPayload[replayIndex];
+    if (byte != MSGPACK_FRAME_END && byte != MSGPACK_FRAME_ESCAPE)
+    {
+        ++replayIndex;
+        return byte;
+    }
+    if (!replayEscapeSent)
+    {
+        replayEscapeSent = true;
+        return MSGPACK_FRAME_ESCAPE;
+    }
+    replayEscapeSent = false;
+    ++replayIndex;
+    return byte == MSGPACK_FRAME_END ? MSGPACK_FRAME_ESCAPED_END : MSGPACK_FRAME_ESCAPED_ESCAPE;
+}
+
+auto write(uint8_t byte) -> size_t
+{
+    if (byte == MSGPACK_FRAME_END)
+    {
+        if (txInFrame && !txDropping && txPayloadBytes != 0U)
+        {
+            const bool sent = sendStagedFrame(CAN_SEGMENT_END);
+            txInFrame = false;
+            return sent ? 1U : 0U;
+        }
+        // Opening delimiter, or the close of a dropped payload.
+        txInFrame = true;
+        txDropping = false;
+        txEscape = false;
+        txFill = 0U;
+        txSequence = 0U;
+        txPayloadBytes = 0U;
+        txIdentifier = canIdentifier(CAN_PRIORITY_CONTROL, CAN_NODE_ID, true);
+        return 1U;
+    }
+    if (txDropping)
+    {
+        return 0U;
+    }
+    if (!txInFrame)
+    {
+        return 1U;
+    }
+    if (byte == MSGPACK_FRAME_ESCAPE)
+    {
+        txEscape = true;
+        return 1U;
+    }
+    if (txEscape)
+    {
+        txEscape = false;
+        byte = byte == MSGPACK_FRAME_ESCAPED_END ? MSGPACK_FRAME_END : MSGPACK_FRAME_ESCAPE;
+    }
+    if (!stagePayloadByte(byte))
+    {
+        txDropping = true;
+        return 0U;
+    }
+    return 1U;
+}
+
+void flush()
+{
+    static_cast<void>(waitTransmitBuffer());
+}
+}  // namespace CanBridgeLink
+
+#endif  // CONFIG_BRIDGE_CAN
@@ -0,0 +1,47 @@
+/**
+ * @file    can_bridge_link.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Declares the MCP2515 CAN transport used instead of the bridge UART.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_COMMUNICATION_CAN_BRIDGE_LINK_HPP
+#define LSH_CORE_COMMUNICATION_CAN_BRIDGE_LINK_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Byte-stream view of an MCP2515 CAN controller on the SPI bus.
+ *
+ * @details Compiled only with `CONFIG_BRIDGE_CAN`. The rest of the firmware
+ * keeps producing and consuming the SLIP-like MsgPack stream of the serial
+ * link; this module translates at the edge. Outbound bytes are deframed and
+ * segmented into CAN frames whose identifier carries the payload priority,
+ * see `can_framing.hpp`. Inbound frames addressed to this node are moved into
+ * a software queue by the INT handler, then reassembled and replayed as one
+ * framed payload, so `BridgeSerial` parses them unchanged.
+ */
+namespace CanBridgeLink
+{
+void begin();                                        // Reset and configure the MCP2515, then enter normal mode.
+[[nodiscard]] auto available() -> int;               // Return non-zero while a reassembled payload is being replayed.
+[[nodiscard]] auto read() -> int;                    // Return the next replayed stream byte, or -1.
+[[nodiscard]] auto write(uint8_t byte) -> size_t;    // Feed one framed stream byte, 0 when a frame could not be queued.
+void flush();                                        // Wait, bounded, until the last queued frame left.
+}  // namespace CanBridgeLink
+
+#endif  // LSH_CORE_COMMUNICATION_CAN_BRIDGE_LINK_HPP
@@ -0,0 +1,103 @@
+/**
+ * @file    can_framing.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Defines the CAN identifier and segmentation layout of bridge payloads.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_COMMUNICATION_CAN_FRAMING_HPP
+#define LSH_CORE_COMMUNICATION_CAN_FRAMING_HPP
+
+#include <stdint.h>
+
+#include "communication/constants/protocol.hpp"
+
+/**
+ * @brief Wire layout of bridge payloads on the CAN transport.
+ *
+ * @details On CAN one MsgPack payload travels unescaped, split over 8-byte
+ *          frames that all share one standard 11-bit identifier:
+ *
+ *          `[priority:3][node:7][toBridge:1]`
+ *
+ *          Lower identifiers win arbitration, so the priority class sits in
+ *          the top bits and a click from any controller pre-empts a pending
+ *          `DEVICE_DETAILS` from another. Byte 0 of every frame is a segment
+ *          header `[start:1][end:1][sequence:6]` and bytes 1..7 carry payload.
+ *          The CRC, ACK and automatic retransmission of the CAN controller replace
+ *          the SLIP-like delimiters and escapes of the serial link.
+ */
+namespace lsh::core::transport
+{
+constexpr uint8_t CAN_PRIORITY_CLICK = 0U;    //!< Network click transactions.
+constexpr uint8_t CAN_PRIORITY_STATE = 1U;    //!< Actuator state and local input events.
+constexpr uint8_t CAN_PRIORITY_CONTROL = 2U;  //!< Handshake, liveness and requests.
+constexpr uint8_t CAN_PRIORITY_BULK = 3U;     //!< Details and telemetry.
+
+constexpr uint8_t CAN_SEGMENT_START = 0x80U;          //!< Segment header flag of the first frame of a payload.
+constexpr uint8_t CAN_SEGMENT_END = 0x40U;            //!< Segment header flag of the last frame of a payload.
+constexpr uint8_t CAN_SEGMENT_SEQUENCE_MASK = 0x3FU;  //!< Frame index inside the payload, wrapping at 64.
+constexpr uint8_t CAN_SEGMENT_PAYLOAD_BYTES = 7U;     //!< Payload bytes carried after the segment header.
+
+/**
+ * @brief Map one protocol command to its CAN arbitration class.
+ */
+[[nodiscard]] constexpr auto canPriorityFor(uint8_t command) noexcept -> uint8_t
+{
+    using lsh::core::protocol::Command;
+    switch (static_cast<Command>(command))
+    {
+    case Command::NETWORK_CLICK_REQUEST:
+    case Command::NETWORK_CLICK_ACK:
+    case Command::FAILOVER:
+    case Command::FAILOVER_CLICK:
+    case Command::NETWORK_CLICK_CONFIRM:
+        return CAN_PRIORITY_CLICK;
+    case Command::ACTUATORS_STATE:
+    case Command::SET_STATE:
+    case Command::SET_SINGLE_ACTUATOR:
+    case Command::ENCODER_STEPS:
+    case Command::OCCUPANCY:
+        return CAN_PRIORITY_STATE;
+    case Command::DEVICE_DETAILS:
+    case Command::RTT_HISTOGRAM:
+    case Command::TIMERS_STATE:
+    case Command::BOUNCE_PROFILE:
+    case Command::TEMPERATURES:
+        return CAN_PRIORITY_BULK;
+    default:
+        return CAN_PRIORITY_CONTROL;
+    }
+}
+
+/**
+ * @brief Build the 11-bit identifier of one payload.
+ *
+ * @param priority arbitration class, `CAN_PRIORITY_*`.
+ * @param node controller node address, `1..127`.
+ * @param toBridge true for controller-to-bridge traffic.
+ */
+[[nodiscard]] constexpr auto canIdentifier(uint8_t priority, uint8_t node, bool toBridge) noexcept -> uint16_t
+{
+    return static_cast<uint16_t>((static_cast<uint16_t>(priority & 0x07U) << 8U) | (static_cast<uint16_t>(node & 0x7FU) << 1U) |
+                                 (toBridge ? 1U : 0U));
+}
+
+static_assert(canIdentifier(CAN_PRIORITY_CLICK, 127U, true) < canIdentifier(CAN_PRIORITY_BULK, 1U, false),
+              "Any click must win arbitration against any bulk frame.");
+}  // namespace lsh::core::transport
+
+#endif  // LSH_CORE_COMMUNICATION_CAN_FRAMING_HPP
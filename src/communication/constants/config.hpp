@@ -73,6 +73,51 @@ static_assert(CONFIG_BRIDGE_AWAIT_STATE_TIMEOUT_MS <= UINT16_MAX, "CONFIG_BRIDGE
 static constexpr const uint16_t BRIDGE_AWAIT_STATE_TIMEOUT_MS = CONFIG_BRIDGE_AWAIT_STATE_TIMEOUT_MS;
 #endif  // CONFIG_BRIDGE_AWAIT_STATE_TIMEOUT_MS
 
+#ifdef CONFIG_BRIDGE_TIME_SYNC
+#ifndef CONFIG_TIME_SYNC_MIN_DRIFT_SPAN_MS
+static constexpr const uint32_t TIME_SYNC_MIN_DRIFT_SPAN_MS =
+    60000U;  //!< Minimum local time between two TIME_SYNC references before they update the drift estimate.
+#else
+static_assert(CONFIG_TIME_SYNC_MIN_DRIFT_SPAN_MS >= 1000, "CONFIG_TIME_SYNC_MIN_DRIFT_SPAN_MS must be at least 1000 ms.");
+static_assert(CONFIG_TIME_SYNC_MIN_DRIFT_SPAN_MS <= 3600000, "CONFIG_TIME_SYNC_MIN_DRIFT_SPAN_MS must not exceed one hour.");
+static constexpr const uint32_t TIME_SYNC_MIN_DRIFT_SPAN_MS = CONFIG_TIME_SYNC_MIN_DRIFT_SPAN_MS;
+#endif  // CONFIG_TIME_SYNC_MIN_DRIFT_SPAN_MS
+#endif  // CONFIG_BRIDGE_TIME_SYNC
+
+#ifdef CONFIG_BRIDGE_ECHO_PROBE
+#ifndef CONFIG_ECHO_PROBE_INTERVAL_MS
+static constexpr const uint16_t ECHO_PROBE_INTERVAL_MS = 30000U;  //!< Default time between two echo probes once the bridge is synced.
+#else
+static_assert(CONFIG_ECHO_PROBE_INTERVAL_MS > 0, "CONFIG_ECHO_PROBE_INTERVAL_MS must be greater than zero.");
+static_assert(CONFIG_ECHO_PROBE_INTERVAL_MS < UINT16_MAX,
+              "CONFIG_ECHO_PROBE_INTERVAL_MS must be below UINT16_MAX so saturated timers can pass it.");
+static constexpr const uint16_t ECHO_PROBE_INTERVAL_MS = CONFIG_ECHO_PROBE_INTERVAL_MS;
+#endif  // CONFIG_ECHO_PROBE_INTERVAL_MS
+
+#ifndef CONFIG_ECHO_PROBE_TIMEOUT_MS
+static constexpr const uint16_t ECHO_PROBE_TIMEOUT_MS = 2000U;  //!< Default time after which an unanswered echo probe counts as lost.
+#else
+static_assert(CONFIG_ECHO_PROBE_TIMEOUT_MS > 0, "CONFIG_ECHO_PROBE_TIMEOUT_MS must be greater than zero.");
+static_assert(CONFIG_ECHO_PROBE_TIMEOUT_MS < UINT16_MAX,
+              "CONFIG_ECHO_PROBE_TIMEOUT_MS must be below UINT16_MAX so saturated timers can pass it.");
+static constexpr const uint16_t ECHO_PROBE_TIMEOUT_MS = CONFIG_ECHO_PROBE_TIMEOUT_MS;
+#endif  // CONFIG_ECHO_PROBE_TIMEOUT_MS
+static_assert(ECHO_PROBE_TIMEOUT_MS < ECHO_PROBE_INTERVAL_MS,
+              "CONFIG_ECHO_PROBE_TIMEOUT_MS must be shorter than CONFIG_ECHO_PROBE_INTERVAL_MS.");
+#endif  // CONFIG_BRIDGE_ECHO_PROBE
+
+#ifdef CONFIG_STATE_HANDOVER
+#ifndef CONFIG_STATE_HANDOVER_WINDOW_MS
+static constexpr const uint16_t STATE_HANDOVER_WINDOW_MS =
+    30000U;  //!< Default time after UPDATE_READY within which a reset still restores the saved actuator state.
+#else
+static_assert(CONFIG_STATE_HANDOVER_WINDOW_MS > 0, "CONFIG_STATE_HANDOVER_WINDOW_MS must be greater than zero.");
+static_assert(CONFIG_STATE_HANDOVER_WINDOW_MS < UINT16_MAX,
+              "CONFIG_STATE_HANDOVER_WINDOW_MS must be below UINT16_MAX so saturated timers can pass it.");
+static constexpr const uint16_t STATE_HANDOVER_WINDOW_MS = CONFIG_STATE_HANDOVER_WINDOW_MS;
+#endif  // CONFIG_STATE_HANDOVER_WINDOW_MS
+#endif  // CONFIG_STATE_HANDOVER
+
 #ifndef CONFIG_COM_SERIAL_BAUD
 static constexpr const uint32_t COM_SERIAL_BAUD = 250000U;  //!< Default baud rate of the controller-to-bridge serial link.
 #else
@@ -135,6 +180,8 @@ constexpr uint16_t PACKED_STATE_BYTES =
                 {"p":12,"s":[90,3]} -> min: JSON_ARRAY_SIZE(ceil(CONFIG_MAX_ACTUATORS / 8)) + JSON_OBJECT_SIZE(2) + 4
                                       because `SET_STATE` uses packed state bytes, not one JSON element per actuator.
                 {"p":17,"t":2,"i":255,"c":255} -> min: JSON_OBJECT_SIZE(4)
+                {"p":18,"m":4294967295} -> min: JSON_OBJECT_SIZE(2), shorter than the click commands on both codecs
+                {"p":19,"c":255} -> min: JSON_OBJECT_SIZE(2), shorter than the click commands on both codecs
                 {"p":13,"i":5,"s":0} -> min: 30, recommended: 48
                                                      -> (JSON_OBJECT_SIZE(3) + number of strings + string characters number)
                                                      -> (24 + 3 + 3 = 30)
@@ -229,6 +276,88 @@ static constexpr const uint16_t COM_SERIAL_MAX_RX_BYTES_PER_LOOP =
 static_assert(COM_SERIAL_MAX_RX_BYTES_PER_LOOP > 0U, "CONFIG_COM_SERIAL_MAX_RX_BYTES_PER_LOOP must be greater than zero.");
 
 }  // namespace bridgeSerial
+
+#if LSH_STATIC_CONFIG_PEER_ADDRESS > 0
+namespace peerSerial
+{
+#ifndef CONFIG_PEER_SERIAL_BAUD
+static constexpr const uint32_t PEER_SERIAL_BAUD = 115200U;  //!< Default baud rate of the controller-to-controller peer link.
+#else
+static constexpr const uint32_t PEER_SERIAL_BAUD = CONFIG_PEER_SERIAL_BAUD;  //!< Baud rate of the controller-to-controller peer link.
+#endif  // CONFIG_PEER_SERIAL_BAUD
+
+#ifndef CONFIG_PEER_SERIAL_MAX_RX_BYTES_PER_LOOP
+static constexpr const uint8_t PEER_SERIAL_MAX_RX_BYTES_PER_LOOP =
+    20U;  //!< Upper bound for raw peer bytes consumed in one loop iteration, four peer frames.
+#else
+static_assert(CONFIG_PEER_SERIAL_MAX_RX_BYTES_PER_LOOP > 0, "CONFIG_PEER_SERIAL_MAX_RX_BYTES_PER_LOOP must be greater than zero.");
+static_assert(CONFIG_PEER_SERIAL_MAX_RX_BYTES_PER_LOOP <= UINT8_MAX, "CONFIG_PEER_SERIAL_MAX_RX_BYTES_PER_LOOP must fit in uint8_t.");
+static constexpr const uint8_t PEER_SERIAL_MAX_RX_BYTES_PER_LOOP = CONFIG_PEER_SERIAL_MAX_RX_BYTES_PER_LOOP;
+#endif  // CONFIG_PEER_SERIAL_MAX_RX_BYTES_PER_LOOP
+}  // namespace peerSerial
+#endif  // LSH_STATIC_CONFIG_PEER_ADDRESS > 0
+
+#ifdef CONFIG_BRIDGE_CAN
+#ifndef CONFIG_MSG_PACK
+#error "CONFIG_BRIDGE_CAN carries the MsgPack codec only; enable CONFIG_MSG_PACK."
+#endif
+/**
+ * @brief Constants that configure the MCP2515 CAN transport towards `lsh-bridge`.
+ */
+namespace canBus
+{
+#ifndef CONFIG_CAN_CS_PIN
+#error "CONFIG_CAN_CS_PIN must name the MCP2515 chip-select pin."
+#endif
+#ifndef CONFIG_CAN_INT_PIN
+#error "CONFIG_CAN_INT_PIN must name the MCP2515 interrupt pin."
+#endif
+static_assert(CONFIG_CAN_CS_PIN >= 0 && CONFIG_CAN_CS_PIN <= UINT8_MAX, "CONFIG_CAN_CS_PIN must fit in uint8_t.");
+static_assert(CONFIG_CAN_INT_PIN >= 0 && CONFIG_CAN_INT_PIN <= UINT8_MAX, "CONFIG_CAN_INT_PIN must fit in uint8_t.");
+static constexpr const uint8_t CAN_CS_PIN = CONFIG_CAN_CS_PIN;    //!< MCP2515 chip-select pin.
+static constexpr const uint8_t CAN_INT_PIN = CONFIG_CAN_INT_PIN;  //!< MCP2515 active-low interrupt pin.
+
+#ifndef CONFIG_CAN_NODE_ID
+static constexpr const uint8_t CAN_NODE_ID = 1U;  //!< Default node address of this controller on the CAN bus.
+#else
+static_assert(CONFIG_CAN_NODE_ID >= 1 && CONFIG_CAN_NODE_ID <= 127, "CONFIG_CAN_NODE_ID must be in 1..127.");
+static constexpr const uint8_t CAN_NODE_ID = CONFIG_CAN_NODE_ID;  //!< Node address of this controller on the CAN bus.
+#endif  // CONFIG_CAN_NODE_ID
+
+#ifndef CONFIG_CAN_BITRATE_KBPS
+static constexpr const uint16_t CAN_BITRATE_KBPS = 250U;  //!< Default CAN bit rate, in kbit/s.
+#else
+static_assert(CONFIG_CAN_BITRATE_KBPS > 0 && CONFIG_CAN_BITRATE_KBPS <= 1000, "CONFIG_CAN_BITRATE_KBPS must be in 1..1000.");
+static constexpr const uint16_t CAN_BITRATE_KBPS = CONFIG_CAN_BITRATE_KBPS;  //!< CAN bit rate, in kbit/s.
+#endif  // CONFIG_CAN_BITRATE_KBPS
+
+#ifndef CONFIG_CAN_CRYSTAL_MHZ
+static constexpr const uint8_t CAN_CRYSTAL_MHZ = 8U;  //!< Default MCP2515 crystal, the common module value.
+#else
+static_assert(CONFIG_CAN_CRYSTAL_MHZ > 0 && CONFIG_CAN_CRYSTAL_MHZ <= 40, "CONFIG_CAN_CRYSTAL_MHZ must be in 1..40.");
+static constexpr const uint8_t CAN_CRYSTAL_MHZ = CONFIG_CAN_CRYSTAL_MHZ;  //!< MCP2515 crystal frequency, in MHz.
+#endif  // CONFIG_CAN_CRYSTAL_MHZ
+
+#ifndef CONFIG_CAN_TX_TIMEOUT_US
+static constexpr const uint16_t CAN_TX_TIMEOUT_US = 3000U;  //!< Default wait for the transmit buffer before a frame is dropped.
+#else
+static_assert(CONFIG_CAN_TX_TIMEOUT_US > 0, "CONFIG_CAN_TX_TIMEOUT_US must be greater than zero.");
+static_assert(CONFIG_CAN_TX_TIMEOUT_US <= UINT16_MAX, "CONFIG_CAN_TX_TIMEOUT_US must fit in uint16_t.");
+static constexpr const uint16_t CAN_TX_TIMEOUT_US = CONFIG_CAN_TX_TIMEOUT_US;  //!< Wait for the transmit buffer before a frame is dropped.
+#endif  // CONFIG_CAN_TX_TIMEOUT_US
+
+#ifndef CONFIG_CAN_RX_QUEUE_FRAMES
+// Room for two full inbound payloads, at 7 payload bytes per frame.
+static constexpr const uint8_t CAN_RX_QUEUE_FRAMES = static_cast<uint8_t>(
+    etl::bit_ceil(2U * ((bridgeSerial::RAW_INPUT_BUFFER_SIZE + 6U) / 7U)));  //!< Default inbound frames buffered by the INT handler.
+static_assert(CAN_RX_QUEUE_FRAMES <= 128U, "The default CAN receive queue must fit in 128 frames.");
+#else
+static_assert(CONFIG_CAN_RX_QUEUE_FRAMES >= 2 && CONFIG_CAN_RX_QUEUE_FRAMES <= 128, "CONFIG_CAN_RX_QUEUE_FRAMES must be in 2..128.");
+static_assert((CONFIG_CAN_RX_QUEUE_FRAMES & (CONFIG_CAN_RX_QUEUE_FRAMES - 1)) == 0, "CONFIG_CAN_RX_QUEUE_FRAMES must be a power of two.");
+static constexpr const uint8_t CAN_RX_QUEUE_FRAMES = CONFIG_CAN_RX_QUEUE_FRAMES;  //!< Inbound frames buffered by the INT handler.
+#endif  // CONFIG_CAN_RX_QUEUE_FRAMES
+}  // namespace canBus
+#endif  // CONFIG_BRIDGE_CAN
 }  // namespace constants
 
 #endif  // LSH_CORE_COMMUNICATION_CONSTANTS_CONFIG_HPP
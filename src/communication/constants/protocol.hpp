@@ -28,7 +28,7 @@ namespace lsh::core
 {
     namespace protocol
     {
-        inline constexpr uint32_t SPEC_REVISION = 2026043001U; //!< Code-only revision, never transmitted on wire.
+        inline constexpr uint32_t SPEC_REVISION = 2026101809U; //!< Code-only revision, never transmitted on wire.
         inline constexpr uint8_t WIRE_PROTOCOL_MAJOR = 3U; //!< Handshake-only protocol major, transmitted only in DEVICE_DETAILS.
 
         // === JSON KEYS ===
@@ -41,6 +41,15 @@ namespace lsh::core
         inline constexpr char KEY_ID[] = "i";
         inline constexpr char KEY_STATE[] = "s";
         inline constexpr char KEY_TYPE[] = "t";
+        inline constexpr char KEY_TIMESTAMP[] = "m";
+        inline constexpr char KEY_HISTOGRAM[] = "h";
+        inline constexpr char KEY_HEALTH[] = "d";
+        inline constexpr char KEY_STEPS[] = "r";
+        inline constexpr char KEY_AUTO_OFF[] = "o";
+        inline constexpr char KEY_PULSE[] = "u";
+        inline constexpr char KEY_BOUNCES[] = "x";
+        inline constexpr char KEY_WINDOW[] = "w";
+        inline constexpr char KEY_READINGS[] = "e";
 
         /**
          * @brief Valid command types for the 'p' (payload) key.
@@ -51,7 +60,11 @@ namespace lsh::core
             ACTUATORS_STATE = 2, //!< Bitpacked actuator state payload.
             NETWORK_CLICK_REQUEST = 3, //!< Network click request with correlation ID.
             BOOT = 4, //!< Controller boot notification and re-sync trigger. Does not carry version metadata.
-            PING_ = 5, //!< Ping or heartbeat payload.
+            PING_ = 5, //!< Ping or heartbeat payload, optionally carrying a health summary.
+            ECHO_PROBE = 6, //!< Round-trip probe with correlation ID, answered by ECHO_REPLY.
+            RTT_HISTOGRAM = 7, //!< Round-trip histogram collected from echo probes.
+            ENCODER_STEPS = 8, //!< Net rotary encoder detents since the previous report.
+            UPDATE_READY = 9, //!< Controller saved its actuator state and is ready to be reset into the bootloader.
             REQUEST_DETAILS = 10, //!< Request device details.
             REQUEST_STATE = 11, //!< Request current state.
             SET_STATE = 12, //!< Set all actuators.
@@ -60,6 +73,16 @@ namespace lsh::core
             FAILOVER = 15, //!< General failover signal.
             FAILOVER_CLICK = 16, //!< Failover for a specific click with correlation ID.
             NETWORK_CLICK_CONFIRM = 17, //!< Confirm a network click after ACK using the same correlation ID.
+            TIME_SYNC = 18, //!< Bridge time reference used by the controller to timestamp outgoing events.
+            ECHO_REPLY = 19, //!< Echo of an ECHO_PROBE with the same correlation ID.
+            REQUEST_RTT_HISTOGRAM = 20, //!< Request the round-trip histogram.
+            PREPARE_UPDATE = 21, //!< Ask the controller to save its actuator state before a firmware update.
+            TIMERS_STATE = 22, //!< Running auto-off and pulse countdowns with their remaining time.
+            REQUEST_TIMERS = 23, //!< Request the running auto-off and pulse countdowns.
+            BOUNCE_PROFILE = 24, //!< Raw-edge bounce statistics of one button.
+            REQUEST_BOUNCE_PROFILE = 25, //!< Request the bounce statistics of one button.
+            OCCUPANCY = 26, //!< Rate-limited occupancy summary of one occupancy input.
+            TEMPERATURES = 27, //!< Batched 1-Wire temperature readings of one bus cycle.
             SYSTEM_REBOOT = 254, //!< Bridge system reboot command.
             SYSTEM_RESET = 255, //!< Bridge system reset command.
         };
@@ -31,6 +31,7 @@ namespace constants::payloads
     {
         BOOT,
         PING_,
+        UPDATE_READY,
     };
 
     // --- BOOT ---
@@ -45,6 +46,12 @@ namespace constants::payloads
     inline constexpr etl::array<uint8_t, 4> MSGPACK_RAW_PING_BYTES = {0x81, 0xA1, 0x70, 0x05};
     inline constexpr etl::array<uint8_t, 6> MSGPACK_SERIAL_PING_BYTES = {0xC0, 0x81, 0xA1, 0x70, 0x05, 0xC0};
 
+    // --- UPDATE_READY ---
+    inline constexpr etl::array<uint8_t, 7> JSON_RAW_UPDATE_READY_BYTES = {'{', '"', 'p', '"', ':', '9', '}'};
+    inline constexpr etl::array<uint8_t, 8> JSON_SERIAL_UPDATE_READY_BYTES = {'{', '"', 'p', '"', ':', '9', '}', '\n'};
+    inline constexpr etl::array<uint8_t, 4> MSGPACK_RAW_UPDATE_READY_BYTES = {0x81, 0xA1, 0x70, 0x09};
+    inline constexpr etl::array<uint8_t, 6> MSGPACK_SERIAL_UPDATE_READY_BYTES = {0xC0, 0x81, 0xA1, 0x70, 0x09, 0xC0};
+
 } // namespace constants::payloads
 
 #endif // LSH_CORE_COMMUNICATION_CONSTANTS_STATIC_PAYLOADS_HPP
@@ -20,15 +20,19 @@
 
 #include "communication/deserializer.hpp"
 
+#include "communication/bridge_clock.hpp"
 #include "communication/bridge_sync.hpp"
 #include "communication/constants/protocol.hpp"
+#include "communication/echo_probe.hpp"
 #include "communication/serializer.hpp"
 #include "config/static_config.hpp"
 #include "core/network_clicks.hpp"
+#include "core/state_handover.hpp"
 #include "device/actuator_manager.hpp"
 #include "device/clickable_manager.hpp"
 #include "peripherals/output/actuator.hpp"
 #include "util/debug/debug.hpp"
+#include "util/time_keeper.hpp"
 
 namespace Deserializer
 {
@@ -361,6 +365,62 @@ auto deserializeAndDispatch(const JsonDocument &doc) -> DispatchResult
     case Command::PING_:
         break;
 
+    case Command::TIME_SYNC:
+#ifdef CONFIG_BRIDGE_TIME_SYNC
+        // Time references are harmless before the handshake completes, and
+        // accepting them early lets the first ACTUATORS_STATE already carry `m`.
+        if (doc[KEY_TIMESTAMP].is<uint32_t>())
+        {
+            BridgeClock::onTimeSync(doc[KEY_TIMESTAMP].as<uint32_t>(), timeKeeper::getTime());
+        }
+#endif
+        break;
+
+    case Command::ECHO_REPLY:
+#ifdef CONFIG_BRIDGE_ECHO_PROBE
+    {
+        uint8_t correlationId = 0U;
+        if (tryGetUint8Scalar(doc[KEY_CORRELATION_ID], correlationId))
+        {
+            EchoProbe::onEchoReply(correlationId);
+        }
+    }
+#endif
+        break;
+
+    case Command::REQUEST_RTT_HISTOGRAM:
+#ifdef CONFIG_BRIDGE_ECHO_PROBE
+        (void)Serializer::serializeRttHistogram();
+#endif
+        break;
+
+    case Command::REQUEST_TIMERS:
+        (void)Serializer::serializeTimersState();
+        break;
+
+    case Command::REQUEST_BOUNCE_PROFILE:
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+    {
+        uint8_t clickableId = 0U;
+        if (tryGetUint8Scalar(doc[KEY_ID], clickableId))
+        {
+            (void)Serializer::serializeBounceProfile(lsh::core::static_config::getClickableIndexById(clickableId));
+        }
+    }
+#endif
+        break;
+
+    case Command::PREPARE_UPDATE:
+#ifdef CONFIG_STATE_HANDOVER
+        // Only a synced bridge may announce a reset: its state view is the one
+        // the snapshot must match after the update.
+        if (BridgeSync::allowsMutatingCommands())
+        {
+            (void)StateHandover::prepare();
+        }
+#endif
+        break;
+
     default:
         DPL("Unknown or missing command ID: ", static_cast<uint8_t>(cmd));
         break;
@@ -0,0 +1,148 @@
+/**
+ * @file    echo_probe.cpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Implements the opt-in bridge round-trip probe and its on-device histogram.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "communication/echo_probe.hpp"
+
+#ifdef CONFIG_BRIDGE_ECHO_PROBE
+#include "communication/bridge_sync.hpp"
+#include "communication/constants/config.hpp"
+#include "communication/serializer.hpp"
+#include "util/saturating_time.hpp"
+
+namespace EchoProbe
+{
+namespace
+{
+constexpr uint8_t LOST_SLOT = RTT_BUCKETS;  //!< Histogram slot that counts probes which never got an answer.
+
+uint16_t histogram[HISTOGRAM_SLOTS] = {};  //!< Saturating counters, never cleared while the controller runs.
+uint16_t probeAge_ms = 0U;                 //!< Saturated age of the probe in flight, or since the last probe.
+uint8_t inFlightCorrelationId = 0U;        //!< Correlation ID of the probe in flight, `0` when none is pending.
+uint8_t nextCorrelationId = 1U;            //!< Next correlation ID, cycling through `1..255`.
+
+/**
+ * @brief Increment one histogram counter without wrapping.
+ *
+ * @param slotIndex counter to increment.
+ */
+void countInSlot(uint8_t slotIndex)
+{
+    if (histogram[slotIndex] != UINT16_MAX)
+    {
+        ++histogram[slotIndex];
+    }
+}
+
+/**
+ * @brief Map one round-trip time to its power-of-two bucket.
+ *
+ * @param rtt_ms measured round trip.
+ * @return uint8_t `0` below 2 ms, otherwise `floor(log2(rtt_ms))`, capped at the last bucket.
+ */
+[[nodiscard]] auto bucketFor(uint16_t rtt_ms) -> uint8_t
+{
+    uint8_t bucket = 0U;
+    rtt_ms = static_cast<uint16_t>(rtt_ms >> 1U);
+    while (rtt_ms != 0U && bucket < static_cast<uint8_t>(RTT_BUCKETS - 1U))
+    {
+        rtt_ms = static_cast<uint16_t>(rtt_ms >> 1U);
+        ++bucket;
+    }
+    return bucket;
+}
+}  // namespace
+
+/**
+ * @brief Send the next probe or expire the one in flight.
+ * @details Runs from the same elapsed-time gate as `BridgeSync::tick()`. The
+ *          age of the probe in flight therefore equals the cached-time delta
+ *          between the send and the loop pass that dispatches the reply, so the
+ *          round trip needs no 32-bit timestamp. Probes are only sent while
+ *          the bridge is synced; a handshake restart drops the probe in flight
+ *          without counting it as lost.
+ *
+ * @param elapsed_ms Milliseconds elapsed since the previous bridge housekeeping pass.
+ */
+void tick(uint16_t elapsed_ms)
+{
+    using constants::bridgeSerial::ECHO_PROBE_INTERVAL_MS;
+    using constants::bridgeSerial::ECHO_PROBE_TIMEOUT_MS;
+
+    if (!BridgeSync::allowsMutatingCommands())
+    {
+        inFlightCorrelationId = 0U;
+        probeAge_ms = 0U;
+        return;
+    }
+
+    probeAge_ms = timeUtils::addElapsedTimeSaturated(probeAge_ms, elapsed_ms);
+    if (inFlightCorrelationId != 0U)
+    {
+        if (probeAge_ms >= ECHO_PROBE_TIMEOUT_MS)
+        {
+            countInSlot(LOST_SLOT);
+            inFlightCorrelationId = 0U;
+        }
+        return;
+    }
+
+    if (probeAge_ms < ECHO_PROBE_INTERVAL_MS)
+    {
+        return;
+    }
+
+    if (Serializer::serializeEchoProbe(nextCorrelationId))
+    {
+        inFlightCorrelationId = nextCorrelationId;
+        probeAge_ms = 0U;
+        nextCorrelationId = (nextCorrelationId == UINT8_MAX) ? 1U : static_cast<uint8_t>(nextCorrelationId + 1U);
+    }
+}
+
+/**
+ * @brief Record the round trip of the probe in flight.
+ * @details Late replies whose probe already expired, duplicated replies and
+ *          replies with a foreign correlation ID are ignored.
+ *
+ * @param correlationId correlation ID echoed by the bridge.
+ */
+void onEchoReply(uint8_t correlationId)
+{
+    if (correlationId == 0U || correlationId != inFlightCorrelationId)
+    {
+        return;
+    }
+
+    countInSlot(bucketFor(probeAge_ms));
+    inFlightCorrelationId = 0U;
+}
+
+/**
+ * @brief Return one saturating histogram counter.
+ *
+ * @param slotIndex `0..RTT_BUCKETS - 1` for round-trip buckets, `RTT_BUCKETS` for lost probes.
+ * @return uint16_t counter value, `0` for out-of-range slots.
+ */
+auto histogramSlot(uint8_t slotIndex) -> uint16_t
+{
+    return (slotIndex < HISTOGRAM_SLOTS) ? histogram[slotIndex] : 0U;
+}
+}  // namespace EchoProbe
+#endif  // CONFIG_BRIDGE_ECHO_PROBE
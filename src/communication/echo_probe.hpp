@@ -0,0 +1,46 @@
+/**
+ * @file    echo_probe.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Declares the opt-in bridge round-trip probe and its on-device histogram.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_COMMUNICATION_ECHO_PROBE_HPP
+#define LSH_CORE_COMMUNICATION_ECHO_PROBE_HPP
+
+#include <stdint.h>
+
+/**
+ * @brief Low duty-cycle `ECHO_PROBE` sender and log-bucket round-trip histogram.
+ *
+ * @details Compiled only with `CONFIG_BRIDGE_ECHO_PROBE`. While the bridge is
+ * synced the controller sends one tagged probe every `ECHO_PROBE_INTERVAL_MS`
+ * and keeps at most one probe in flight. The matching `ECHO_REPLY` lands in a
+ * power-of-two bucket; probes left unanswered for `ECHO_PROBE_TIMEOUT_MS` land
+ * in a separate lost counter. The bridge reads the counters with
+ * `REQUEST_RTT_HISTOGRAM`.
+ */
+namespace EchoProbe
+{
+constexpr uint8_t RTT_BUCKETS = 12U;                   //!< Round-trip buckets: `<2 ms`, `[2^k, 2^(k+1))` ms, last one open-ended.
+constexpr uint8_t HISTOGRAM_SLOTS = RTT_BUCKETS + 1U;  //!< Round-trip buckets plus the final lost-probe counter.
+
+void tick(uint16_t elapsed_ms);                                   // Send the next probe or expire the one in flight.
+void onEchoReply(uint8_t correlationId);                          // Record the round trip of the probe in flight.
+[[nodiscard]] auto histogramSlot(uint8_t slotIndex) -> uint16_t;  // Return one saturating histogram counter.
+}  // namespace EchoProbe
+
+#endif  // LSH_CORE_COMMUNICATION_ECHO_PROBE_HPP
@@ -0,0 +1,108 @@
+/**
+ * @file    link_health.cpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Implements the link health counters carried by the heartbeat.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "communication/link_health.hpp"
+
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+namespace LinkHealth
+{
+namespace
+{
+uint16_t maxLoop_ms = 0U;    //!< Longest loop pass since the previous heartbeat, already saturated by the caller.
+uint16_t rxErrorCount = 0U;  //!< Discarded inbound frames, wrapping modulo 2^16.
+uint16_t txDropCount = 0U;   //!< Dropped outbound payloads, wrapping modulo 2^16.
+}  // namespace
+
+/**
+ * @brief Fold one loop pass into the maximum since the previous heartbeat.
+ * @details The main loop already computes one saturated 16-bit delta between
+ *          two cached timestamps, which is the duration of the previous pass.
+ *          Reusing it costs one compare per elapsed millisecond and no extra
+ *          timer reads.
+ *
+ * @param elapsed_ms Milliseconds elapsed since the previous loop pass.
+ */
+void noteLoopTime(uint16_t elapsed_ms)
+{
+    if (elapsed_ms > maxLoop_ms)
+    {
+        maxLoop_ms = elapsed_ms;
+    }
+}
+
+/**
+ * @brief Count one discarded inbound frame.
+ * @details Covers malformed MsgPack frames, undecodable payloads and JSON lines
+ *          dropped after a receive-buffer overflow.
+ */
+void noteRxError()
+{
+    ++rxErrorCount;
+}
+
+/**
+ * @brief Count one outbound payload the controller had to drop.
+ * @details Bridge payload writers stop at the first byte the transport refuses,
+ *          so every aborted payload is counted exactly once. Only the CAN
+ *          transport refuses bytes, after its transmit timeout; the stock AVR
+ *          `HardwareSerial` blocks until the TX buffer has room, so a serial
+ *          bridge never lands here. The peer link counts the frames it drops
+ *          whole because the peer TX buffer is full.
+ */
+void noteTxDrop()
+{
+    ++txDropCount;
+}
+
+/**
+ * @brief Start a new maximum-loop window after a heartbeat left.
+ * @details The error counters keep running: a consumer that misses one
+ *          heartbeat still gets the right totals from the next one.
+ */
+void onHeartbeatSent()
+{
+    maxLoop_ms = 0U;
+}
+
+/**
+ * @brief Longest loop pass since the previous heartbeat.
+ */
+auto maxLoopTime() -> uint16_t
+{
+    return maxLoop_ms;
+}
+
+/**
+ * @brief Free-running count of discarded inbound frames.
+ */
+auto rxErrors() -> uint16_t
+{
+    return rxErrorCount;
+}
+
+/**
+ * @brief Free-running count of outbound payloads cut short by the serial driver.
+ */
+auto txDrops() -> uint16_t
+{
+    return txDropCount;
+}
+}  // namespace LinkHealth
+#endif  // CONFIG_BRIDGE_HEALTH_PING
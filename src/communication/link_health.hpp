@@ -0,0 +1,47 @@
+/**
+ * @file    link_health.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Declares the link health counters carried by the heartbeat.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_COMMUNICATION_LINK_HEALTH_HPP
+#define LSH_CORE_COMMUNICATION_LINK_HEALTH_HPP
+
+#include <stdint.h>
+
+/**
+ * @brief Health summary appended to every heartbeat `PING`.
+ *
+ * @details Compiled only with `CONFIG_BRIDGE_HEALTH_PING`. The controller keeps
+ * the longest loop pass since the previous heartbeat plus two free-running
+ * counters of discarded inbound frames and dropped outbound payloads. The serializer
+ * appends them, together with the open network click transactions, as `d` to
+ * the heartbeat it already sends, so the bridge gets continuous health data
+ * without extra frames or polling.
+ */
+namespace LinkHealth
+{
+void noteLoopTime(uint16_t elapsed_ms);        // Fold one loop pass into the maximum since the previous heartbeat.
+void noteRxError();                            // Count one discarded inbound frame.
+void noteTxDrop();                             // Count one outbound payload the controller had to drop.
+void onHeartbeatSent();                        // Start a new maximum-loop window after a heartbeat left.
+[[nodiscard]] auto maxLoopTime() -> uint16_t;  // Longest loop pass since the previous heartbeat.
+[[nodiscard]] auto rxErrors() -> uint16_t;     // Free-running count of discarded inbound frames.
+[[nodiscard]] auto txDrops() -> uint16_t;      // Free-running count of dropped outbound payloads.
+}  // namespace LinkHealth
+
+#endif  // LSH_CORE_COMMUNICATION_LINK_HEALTH_HPP
@@ -0,0 +1,173 @@
+/**
+ * @file    peer_link.cpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Implements the direct controller-to-controller link used by peer click actions.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "communication/peer_link.hpp"
+
+#include "internal/user_config_bridge.hpp"
+
+#if LSH_STATIC_CONFIG_PEER_ADDRESS > 0
+#include "communication/constants/config.hpp"
+#include "communication/link_health.hpp"
+#include "config/static_config.hpp"
+#include "device/actuator_manager.hpp"
+
+namespace PeerLink
+{
+namespace
+{
+constexpr uint8_t FRAME_SYNC = 0xA7U;  //!< First byte of every peer frame.
+constexpr uint8_t FRAME_SIZE = 5U;     //!< Sync, address, actuator ID, operation, check.
+
+uint8_t frame[FRAME_SIZE - 1U] = {};  //!< Bytes received after the sync byte of the frame in progress.
+uint8_t frameLength = 0U;             //!< Bytes already stored in `frame`, `0` while hunting for a sync byte.
+
+/**
+ * @brief Compute the check byte of one frame: the inverted 8-bit sum of the
+ *        sync byte and the three payload bytes.
+ */
+[[nodiscard]] constexpr auto frameCheck(uint8_t address, uint8_t actuatorId, uint8_t operation) -> uint8_t
+{
+    return static_cast<uint8_t>(~static_cast<uint8_t>(FRAME_SYNC + address + actuatorId + operation));
+}
+
+/**
+ * @brief Apply one validated frame addressed to this controller.
+ *
+ * @return true if the actuator changed state.
+ */
+[[nodiscard]] auto applyFrame(uint8_t actuatorId, uint8_t operation) -> bool
+{
+    uint8_t actuatorIndex = 0U;
+    if (!Actuators::tryGetIndex(actuatorId, actuatorIndex))
+    {
+        return false;
+    }
+
+    bool state = false;
+    switch (static_cast<Operation>(operation))
+    {
+    case Operation::OFF:
+        break;
+    case Operation::ON:
+        state = true;
+        break;
+    case Operation::TOGGLE:
+    {
+        const uint8_t bitMask = static_cast<uint8_t>(1U << (actuatorIndex & 0x07U));
+        state = (Actuators::packedActuatorStates[actuatorIndex >> 3U] & bitMask) == 0U;
+        break;
+    }
+    default:
+        return false;
+    }
+    return lsh::core::static_config::setActuatorStateById(actuatorId, state);
+}
+}  // namespace
+
+/**
+ * @brief Initialize the peer UART.
+ */
+void init()
+{
+    CONFIG_PEER_SERIAL->HardwareSerial::begin(constants::peerSerial::PEER_SERIAL_BAUD, SERIAL_8N1);
+}
+
+/**
+ * @brief Queue one peer frame, never blocking.
+ * @details A button press must not stall the scan loop behind a slow or
+ *          unplugged peer, so the frame is dropped whole when the TX buffer
+ *          cannot take it. There is no acknowledgement: the bridge still
+ *          reports the target's real state, and the user can press again.
+ *
+ * @param address peer address of the target controller.
+ * @param actuatorId actuator ID on the target controller.
+ * @param operation what the target controller does with the actuator.
+ * @return true if the frame was queued.
+ */
+auto send(uint8_t address, uint8_t actuatorId, Operation operation) -> bool
+{
+    if (CONFIG_PEER_SERIAL->HardwareSerial::availableForWrite() < static_cast<int>(FRAME_SIZE))
+    {
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+        LinkHealth::noteTxDrop();
+#endif
+        return false;
+    }
+    const auto operationByte = static_cast<uint8_t>(operation);
+    CONFIG_PEER_SERIAL->HardwareSerial::write(FRAME_SYNC);
+    CONFIG_PEER_SERIAL->HardwareSerial::write(address);
+    CONFIG_PEER_SERIAL->HardwareSerial::write(actuatorId);
+    CONFIG_PEER_SERIAL->HardwareSerial::write(operationByte);
+    CONFIG_PEER_SERIAL->HardwareSerial::write(frameCheck(address, actuatorId, operationByte));
+    return true;
+}
+
+/**
+ * @brief Apply the peer frames already received for this controller.
+ * @details Runs on every loop pass, like the priority inputs, so a peer click
+ *          lands within one loop pass of its last byte. Reading is bounded by
+ *          `PEER_SERIAL_MAX_RX_BYTES_PER_LOOP`. A frame with a bad check byte
+ *          is dropped and the parser hunts for the next sync byte; frames for
+ *          other addresses are consumed silently.
+ *
+ * @return true if at least one actuator changed state.
+ */
+auto receive() -> bool
+{
+    bool anyActuatorChangedState = false;
+    uint8_t consumedBytes = 0U;
+    while (consumedBytes < constants::peerSerial::PEER_SERIAL_MAX_RX_BYTES_PER_LOOP &&
+           CONFIG_PEER_SERIAL->HardwareSerial::available() > 0)
+    {
+        const int rawByte = CONFIG_PEER_SERIAL->HardwareSerial::read();
+        if (rawByte < 0)
+        {
+            break;
+        }
+        ++consumedBytes;
+        const auto byte = static_cast<uint8_t>(rawByte);
+
+        if (frameLength == 0U)
+        {
+            if (byte == FRAME_SYNC)
+            {
+                frameLength = 1U;
+            }
+            continue;
+        }
+
+        frame[frameLength - 1U] = byte;
+        ++frameLength;
+        if (frameLength < FRAME_SIZE)
+        {
+            continue;
+        }
+
+        frameLength = 0U;
+        if (frame[3] != frameCheck(frame[0], frame[1], frame[2]) || frame[0] != LSH_STATIC_CONFIG_PEER_ADDRESS)
+        {
+            continue;
+        }
+        anyActuatorChangedState |= applyFrame(frame[1], frame[2]);
+    }
+    return anyActuatorChangedState;
+}
+}  // namespace PeerLink
+#endif  // LSH_STATIC_CONFIG_PEER_ADDRESS > 0
@@ -0,0 +1,50 @@
+/**
+ * @file    peer_link.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Declares the direct controller-to-controller link used by peer click actions.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_COMMUNICATION_PEER_LINK_HPP
+#define LSH_CORE_COMMUNICATION_PEER_LINK_HPP
+
+#include <stdint.h>
+
+/**
+ * @brief Fixed-size actuator commands exchanged directly between controllers.
+ *
+ * @details Compiled only when the static profile declares a peer link, i.e.
+ * `LSH_STATIC_CONFIG_PEER_ADDRESS > 0`. A button on one controller can switch
+ * an actuator on another one without going through the bridge: the generated
+ * short-click path writes one 5-byte frame per target to a second UART,
+ * `[0xA7, address, actuatorId, operation, check]`, and the receiving
+ * controller applies frames addressed to it on every loop pass.
+ */
+namespace PeerLink
+{
+enum class Operation : uint8_t
+{
+    OFF = 0U,
+    ON = 1U,
+    TOGGLE = 2U,
+};
+
+void init();                                                                                // Initialize the peer UART.
+[[nodiscard]] auto send(uint8_t address, uint8_t actuatorId, Operation operation) -> bool;  // Queue one frame, never blocking.
+[[nodiscard]] auto receive() -> bool;                                                       // Apply frames addressed to us.
+}  // namespace PeerLink
+
+#endif  // LSH_CORE_COMMUNICATION_PEER_LINK_HPP
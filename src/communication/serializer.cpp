@@ -24,21 +24,39 @@
 
 #include "communication/constants/config.hpp"
 #include "communication/constants/protocol.hpp"
+#include "communication/bridge_clock.hpp"
 #include "communication/bridge_serial.hpp"
+#include "communication/bridge_transport.hpp"
+#include "communication/echo_probe.hpp"
+#include "communication/link_health.hpp"
 #include "communication/msgpack_serial_framing.hpp"
 #include "config/static_config.hpp"
 #include "device/actuator_manager.hpp"
 #include "device/clickable_manager.hpp"
+#include "internal/hot_loop_state.hpp"
 #include "internal/user_config_bridge.hpp"
 #include "peripherals/input/clickable.hpp"
+#if LSH_STATIC_CONFIG_ONE_WIRE_BUSES > 0
+#include "peripherals/input/one_wire_bus.hpp"
+#endif
 #include "peripherals/output/actuator.hpp"
 #include "util/debug/debug.hpp"
+#include "util/time_keeper.hpp"
 
 namespace
 {
 [[nodiscard]] auto writeSerialByte(uint8_t byte) -> bool
 {
-    return CONFIG_COM_SERIAL->HardwareSerial::write(byte) == 1U;
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+    if (BridgeTransport::write(byte) == 1U)
+    {
+        return true;
+    }
+    LinkHealth::noteTxDrop();
+    return false;
+#else
+    return BridgeTransport::write(byte) == 1U;
+#endif
 }
 
 template <size_t Index, size_t PayloadLength> struct LiteralByteWriter
@@ -81,12 +99,35 @@ template <size_t Size> [[nodiscard]] auto writeLiteral(const char (&literal)[Siz
 {
     if constexpr (constants::bridgeSerial::COM_SERIAL_FLUSH_AFTER_SEND)
     {
-        CONFIG_COM_SERIAL->HardwareSerial::flush();
+        BridgeTransport::flush();
     }
     BridgeSerial::updateLastSentTime();
     return true;
 }
 
+/**
+ * @brief Return whether dynamic payloads must carry the optional `m` bridge timestamp.
+ * @details Without `CONFIG_BRIDGE_TIME_SYNC` this folds to a constant and the
+ *          timestamp branches disappear from every payload writer.
+ */
+#ifdef CONFIG_BRIDGE_TIME_SYNC
+[[nodiscard]] auto isTimestamped() -> bool
+{
+    return BridgeClock::isSynced();
+}
+#else
+[[nodiscard]] constexpr auto isTimestamped() -> bool
+{
+    return false;
+}
+#endif
+
+static_assert(LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS + LSH_STATIC_CONFIG_PULSE_ACTUATORS <= UINT8_MAX,
+              "Auto-off and pulse timer slots must fit in uint8_t.");
+constexpr uint8_t AUTO_OFF_TIMERS = LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS;  //!< Generated timer indexes below this one are auto-off entries.
+constexpr uint8_t TIMER_SLOTS = static_cast<uint8_t>(LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS +
+                                                     LSH_STATIC_CONFIG_PULSE_ACTUATORS);  //!< Auto-off entries, then pulse slots.
+
 [[nodiscard]] auto writeStaticPayload(constants::payloads::StaticType payloadType) -> bool
 {
     using constants::payloads::StaticType;
@@ -99,6 +140,11 @@ template <size_t Size> [[nodiscard]] auto writeLiteral(const char (&literal)[Siz
     case StaticType::PING_:
         return writeSerialByte(0xC0U) && writeSerialByte(0x81U) && writeSerialByte(0xA1U) && writeSerialByte(0x70U) &&
                writeSerialByte(0x05U) && writeSerialByte(0xC0U);
+#ifdef CONFIG_STATE_HANDOVER
+    case StaticType::UPDATE_READY:
+        return writeSerialByte(0xC0U) && writeSerialByte(0x81U) && writeSerialByte(0xA1U) && writeSerialByte(0x70U) &&
+               writeSerialByte(0x09U) && writeSerialByte(0xC0U);
+#endif
     default:
         return false;
     }
@@ -109,6 +155,10 @@ template <size_t Size> [[nodiscard]] auto writeLiteral(const char (&literal)[Siz
         return writeLiteral("{\"p\":4}\n");
     case StaticType::PING_:
         return writeLiteral("{\"p\":5}\n");
+#ifdef CONFIG_STATE_HANDOVER
+    case StaticType::UPDATE_READY:
+        return writeLiteral("{\"p\":9}\n");
+#endif
     default:
         return false;
     }
@@ -141,6 +191,22 @@ template <size_t Size> [[nodiscard]] auto writeLiteral(const char (&literal)[Siz
     return writeMsgPackFrameByte(0xCCU) && writeMsgPackFrameByte(value);
 }
 
+[[nodiscard]] auto writeMsgPackUint32(uint32_t value) -> bool
+{
+    if (value <= 0xFFU)
+    {
+        return writeMsgPackUint(static_cast<uint8_t>(value));
+    }
+    if (value <= 0xFFFFU)
+    {
+        return writeMsgPackFrameByte(0xCDU) && writeMsgPackFrameByte(static_cast<uint8_t>(value >> 8U)) &&
+               writeMsgPackFrameByte(static_cast<uint8_t>(value));
+    }
+    return writeMsgPackFrameByte(0xCEU) && writeMsgPackFrameByte(static_cast<uint8_t>(value >> 24U)) &&
+           writeMsgPackFrameByte(static_cast<uint8_t>(value >> 16U)) && writeMsgPackFrameByte(static_cast<uint8_t>(value >> 8U)) &&
+           writeMsgPackFrameByte(static_cast<uint8_t>(value));
+}
+
 [[nodiscard]] auto writeMsgPackKey(char key) -> bool
 {
     return writeMsgPackFrameByte(0xA1U) && writeMsgPackFrameByte(static_cast<uint8_t>(key));
@@ -186,22 +252,252 @@ template <uint8_t ByteCount> struct MsgPackPackedStateWriter<ByteCount, ByteCoun
 {
     using lsh::core::protocol::Command;
     constexpr uint8_t byteCount = CONFIG_PACKED_ACTUATOR_STATE_BYTES;
-    if (!beginMsgPackFrame() || !writeMsgPackFrameByte(0x82U) || !writeMsgPackKey('p') ||
+    const bool timestamped = isTimestamped();
+    if (!beginMsgPackFrame() || !writeMsgPackFrameByte(timestamped ? 0x83U : 0x82U) || !writeMsgPackKey('p') ||
         !writeMsgPackUint(static_cast<uint8_t>(Command::ACTUATORS_STATE)) || !writeMsgPackKey('s') || !writeMsgPackArrayHeader(byteCount))
     {
         return false;
     }
 
-    return MsgPackPackedStateWriter<0U, byteCount>::write() && endMsgPackFrame();
+    if (!MsgPackPackedStateWriter<0U, byteCount>::write())
+    {
+        return false;
+    }
+    if (timestamped && (!writeMsgPackKey('m') || !writeMsgPackUint32(BridgeClock::stateChangeBridgeTime())))
+    {
+        return false;
+    }
+    return endMsgPackFrame();
 }
 
 #if CONFIG_USE_NETWORK_CLICKS
 [[nodiscard]] auto writeMsgPackNetworkClickPayload(uint8_t command, uint8_t protocolClickType, uint8_t clickableId, uint8_t correlationId)
     -> bool
 {
-    return beginMsgPackFrame() && writeMsgPackFrameByte(0x84U) && writeMsgPackKey('p') && writeMsgPackUint(command) &&
-           writeMsgPackKey('t') && writeMsgPackUint(protocolClickType) && writeMsgPackKey('i') && writeMsgPackUint(clickableId) &&
-           writeMsgPackKey('c') && writeMsgPackUint(correlationId) && endMsgPackFrame();
+    const bool timestamped = isTimestamped();
+    if (!beginMsgPackFrame() || !writeMsgPackFrameByte(timestamped ? 0x85U : 0x84U) || !writeMsgPackKey('p') ||
+        !writeMsgPackUint(command) || !writeMsgPackKey('t') || !writeMsgPackUint(protocolClickType) || !writeMsgPackKey('i') ||
+        !writeMsgPackUint(clickableId) || !writeMsgPackKey('c') || !writeMsgPackUint(correlationId))
+    {
+        return false;
+    }
+    if (timestamped && (!writeMsgPackKey('m') || !writeMsgPackUint32(BridgeClock::toBridgeTime(timeKeeper::getTime()))))
+    {
+        return false;
+    }
+    return endMsgPackFrame();
+}
+#endif
+
+#if LSH_STATIC_CONFIG_NETWORK_OCCUPANCY > 0
+[[nodiscard]] auto writeMsgPackOccupancyPayload(uint8_t occupancyId, bool occupied) -> bool
+{
+    using lsh::core::protocol::Command;
+    const bool timestamped = isTimestamped();
+    if (!beginMsgPackFrame() || !writeMsgPackFrameByte(timestamped ? 0x84U : 0x83U) || !writeMsgPackKey('p') ||
+        !writeMsgPackUint(static_cast<uint8_t>(Command::OCCUPANCY)) || !writeMsgPackKey('i') || !writeMsgPackUint(occupancyId) ||
+        !writeMsgPackKey('s') || !writeMsgPackUint(occupied ? 1U : 0U))
+    {
+        return false;
+    }
+    if (timestamped && (!writeMsgPackKey('m') || !writeMsgPackUint32(BridgeClock::toBridgeTime(timeKeeper::getTime()))))
+    {
+        return false;
+    }
+    return endMsgPackFrame();
+}
+#endif
+
+#if LSH_STATIC_CONFIG_NETWORK_ENCODERS > 0
+[[nodiscard]] auto writeMsgPackEncoderStepsPayload(uint8_t encoderId, int8_t steps) -> bool
+{
+    using lsh::core::protocol::Command;
+    const bool timestamped = isTimestamped();
+    if (!beginMsgPackFrame() || !writeMsgPackFrameByte(timestamped ? 0x83U : 0x82U) || !writeMsgPackKey('p') ||
+        !writeMsgPackUint(static_cast<uint8_t>(Command::ENCODER_STEPS)) || !writeMsgPackKey('i') || !writeMsgPackUint(encoderId) ||
+        !writeMsgPackKey('r'))
+    {
+        return false;
+    }
+
+    // Non-negative steps use the unsigned encodings, -32..-1 the negative fixint, the rest int8.
+    const uint8_t stepsByte = static_cast<uint8_t>(steps);
+    const bool stepsWritten = (steps >= 0)     ? writeMsgPackUint(stepsByte)
+                              : (steps >= -32) ? writeMsgPackFrameByte(stepsByte)
+                                               : (writeMsgPackFrameByte(0xD0U) && writeMsgPackFrameByte(stepsByte));
+    if (!stepsWritten)
+    {
+        return false;
+    }
+    if (timestamped && (!writeMsgPackKey('m') || !writeMsgPackUint32(BridgeClock::toBridgeTime(timeKeeper::getTime()))))
+    {
+        return false;
+    }
+    return endMsgPackFrame();
+}
+#endif
+
+#if LSH_STATIC_CONFIG_ONE_WIRE_BUSES > 0
+[[nodiscard]] auto writeMsgPackInt16(int16_t value) -> bool
+{
+    // Non-negative values use the unsigned encodings, -32..-1 the negative fixint, the rest int16.
+    if (value >= 0)
+    {
+        return writeMsgPackUint32(static_cast<uint32_t>(value));
+    }
+    const uint16_t bits = static_cast<uint16_t>(value);
+    if (value >= -32)
+    {
+        return writeMsgPackFrameByte(static_cast<uint8_t>(bits));
+    }
+    return writeMsgPackFrameByte(0xD1U) && writeMsgPackFrameByte(static_cast<uint8_t>(bits >> 8U)) &&
+           writeMsgPackFrameByte(static_cast<uint8_t>(bits));
+}
+
+[[nodiscard]] auto writeMsgPackTemperaturesPayload(const OneWireBus &bus) -> bool
+{
+    using lsh::core::protocol::Command;
+    const bool timestamped = isTimestamped();
+    if (!beginMsgPackFrame() || !writeMsgPackFrameByte(timestamped ? 0x84U : 0x83U) || !writeMsgPackKey('p') ||
+        !writeMsgPackUint(static_cast<uint8_t>(Command::TEMPERATURES)) || !writeMsgPackKey('e') ||
+        !writeMsgPackArrayHeader(bus.freshCount()))
+    {
+        return false;
+    }
+
+    for (uint8_t index = 0U; index < bus.count(); ++index)
+    {
+        if (bus.isFresh(index) &&
+            (!writeMsgPackArrayHeader(2U) || !writeMsgPackUint(bus.sensorId(index)) || !writeMsgPackInt16(bus.reading(index))))
+        {
+            return false;
+        }
+    }
+    if (!writeMsgPackKey('w') || !writeMsgPackUint32(bus.worstSlot()))
+    {
+        return false;
+    }
+    if (timestamped && (!writeMsgPackKey('m') || !writeMsgPackUint32(BridgeClock::toBridgeTime(timeKeeper::getTime()))))
+    {
+        return false;
+    }
+    return endMsgPackFrame();
+}
+#endif
+
+#ifdef CONFIG_BRIDGE_ECHO_PROBE
+[[nodiscard]] auto writeMsgPackEchoProbePayload(uint8_t correlationId) -> bool
+{
+    using lsh::core::protocol::Command;
+    return beginMsgPackFrame() && writeMsgPackFrameByte(0x82U) && writeMsgPackKey('p') &&
+           writeMsgPackUint(static_cast<uint8_t>(Command::ECHO_PROBE)) && writeMsgPackKey('c') && writeMsgPackUint(correlationId) &&
+           endMsgPackFrame();
+}
+
+[[nodiscard]] auto writeMsgPackRttHistogramPayload() -> bool
+{
+    using lsh::core::protocol::Command;
+    if (!beginMsgPackFrame() || !writeMsgPackFrameByte(0x82U) || !writeMsgPackKey('p') ||
+        !writeMsgPackUint(static_cast<uint8_t>(Command::RTT_HISTOGRAM)) || !writeMsgPackKey('h') ||
+        !writeMsgPackArrayHeader(EchoProbe::HISTOGRAM_SLOTS))
+    {
+        return false;
+    }
+
+    for (uint8_t slotIndex = 0U; slotIndex < EchoProbe::HISTOGRAM_SLOTS; ++slotIndex)
+    {
+        if (!writeMsgPackUint32(EchoProbe::histogramSlot(slotIndex)))
+        {
+            return false;
+        }
+    }
+    return endMsgPackFrame();
+}
+#endif
+
+/**
+ * @brief Count the countdowns running in one generated timer index range.
+ *
+ * @param firstTimer first generated timer index.
+ * @param endTimer one past the last generated timer index.
+ * @param now_ms cached time shared by the count and the write pass.
+ * @return uint8_t number of active timers in the range.
+ */
+[[nodiscard]] auto countActiveTimers(uint8_t firstTimer, uint8_t endTimer, uint32_t now_ms) -> uint8_t
+{
+    uint8_t activeTimers = 0U;
+    uint8_t actuatorId = 0U;
+    uint32_t remaining_ms = 0U;
+    for (uint8_t timerIndex = firstTimer; timerIndex < endTimer; ++timerIndex)
+    {
+        if (lsh::core::static_config::getActiveTimer(timerIndex, now_ms, actuatorId, remaining_ms))
+        {
+            ++activeTimers;
+        }
+    }
+    return activeTimers;
+}
+
+[[nodiscard]] auto writeMsgPackTimerList(uint8_t firstTimer, uint8_t endTimer, uint32_t now_ms) -> bool
+{
+    if (!writeMsgPackArrayHeader(countActiveTimers(firstTimer, endTimer, now_ms)))
+    {
+        return false;
+    }
+
+    uint8_t actuatorId = 0U;
+    uint32_t remaining_ms = 0U;
+    for (uint8_t timerIndex = firstTimer; timerIndex < endTimer; ++timerIndex)
+    {
+        if (lsh::core::static_config::getActiveTimer(timerIndex, now_ms, actuatorId, remaining_ms) &&
+            (!writeMsgPackArrayHeader(2U) || !writeMsgPackUint(actuatorId) || !writeMsgPackUint32(remaining_ms)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+[[nodiscard]] auto writeMsgPackTimersStatePayload(uint32_t now_ms) -> bool
+{
+    using lsh::core::protocol::Command;
+    return beginMsgPackFrame() && writeMsgPackFrameByte(0x83U) && writeMsgPackKey('p') &&
+           writeMsgPackUint(static_cast<uint8_t>(Command::TIMERS_STATE)) && writeMsgPackKey('o') &&
+           writeMsgPackTimerList(0U, AUTO_OFF_TIMERS, now_ms) && writeMsgPackKey('u') &&
+           writeMsgPackTimerList(AUTO_OFF_TIMERS, TIMER_SLOTS, now_ms) && endMsgPackFrame();
+}
+
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+[[nodiscard]] auto writeMsgPackBounceProfilePayload(uint8_t clickableId, const BounceProfile &profile) -> bool
+{
+    using lsh::core::protocol::Command;
+    if (!beginMsgPackFrame() || !writeMsgPackFrameByte(0x85U) || !writeMsgPackKey('p') ||
+        !writeMsgPackUint(static_cast<uint8_t>(Command::BOUNCE_PROFILE)) || !writeMsgPackKey('i') || !writeMsgPackUint(clickableId) ||
+        !writeMsgPackKey('h') || !writeMsgPackArrayHeader(BounceProfile::BUCKETS))
+    {
+        return false;
+    }
+
+    for (uint8_t bucket = 0U; bucket < BounceProfile::BUCKETS; ++bucket)
+    {
+        if (!writeMsgPackUint32(profile.edgeCount(bucket)))
+        {
+            return false;
+        }
+    }
+    return writeMsgPackKey('x') && writeMsgPackUint32(profile.bounces()) && writeMsgPackKey('w') &&
+           writeMsgPackUint(profile.maxWindow()) && endMsgPackFrame();
+}
+#endif
+
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+[[nodiscard]] auto writeMsgPackHealthPingPayload() -> bool
+{
+    using lsh::core::protocol::Command;
+    return beginMsgPackFrame() && writeMsgPackFrameByte(0x82U) && writeMsgPackKey('p') &&
+           writeMsgPackUint(static_cast<uint8_t>(Command::PING_)) && writeMsgPackKey('d') && writeMsgPackArrayHeader(4U) &&
+           writeMsgPackUint32(LinkHealth::maxLoopTime()) && writeMsgPackUint32(LinkHealth::rxErrors()) &&
+           writeMsgPackUint32(LinkHealth::txDrops()) && writeMsgPackUint(hotLoopState::activeNetworkClicks()) && endMsgPackFrame();
 }
 #endif
 #else
@@ -225,6 +521,32 @@ template <uint8_t ByteCount> struct MsgPackPackedStateWriter<ByteCount, ByteCoun
     return writeSerialByte(static_cast<uint8_t>('0' + value));
 }
 
+[[nodiscard]] auto writeUint32Decimal(uint32_t value) -> bool
+{
+    if (value <= 0xFFU)
+    {
+        return writeUint8Decimal(static_cast<uint8_t>(value));
+    }
+
+    char digits[10];
+    uint8_t length = 0U;
+    do
+    {
+        const uint32_t quotient = value / 10U;
+        digits[length++] = static_cast<char>('0' + static_cast<uint8_t>(value - (quotient * 10U)));
+        value = quotient;
+    } while (value != 0U);
+
+    while (length != 0U)
+    {
+        if (!writeSerialByte(static_cast<uint8_t>(digits[--length])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <uint8_t ByteIndex, uint8_t ByteCount> struct JsonPackedStateWriter
 {
     [[nodiscard]] static auto write() -> bool
@@ -254,16 +576,188 @@ template <uint8_t ByteCount> struct JsonPackedStateWriter<ByteCount, ByteCount>
     }
 
     constexpr uint8_t byteCount = CONFIG_PACKED_ACTUATOR_STATE_BYTES;
-    return JsonPackedStateWriter<0U, byteCount>::write() && writeLiteral("]}\n");
+    if (!JsonPackedStateWriter<0U, byteCount>::write())
+    {
+        return false;
+    }
+    if (isTimestamped())
+    {
+        return writeLiteral("],\"m\":") && writeUint32Decimal(BridgeClock::stateChangeBridgeTime()) && writeLiteral("}\n");
+    }
+    return writeLiteral("]}\n");
 }
 
 #if CONFIG_USE_NETWORK_CLICKS
 [[nodiscard]] auto writeJsonNetworkClickPayload(uint8_t command, uint8_t protocolClickType, uint8_t clickableId, uint8_t correlationId)
     -> bool
 {
-    return writeLiteral("{\"p\":") && writeUint8Decimal(command) && writeLiteral(",\"t\":") && writeUint8Decimal(protocolClickType) &&
-           writeLiteral(",\"i\":") && writeUint8Decimal(clickableId) && writeLiteral(",\"c\":") && writeUint8Decimal(correlationId) &&
-           writeLiteral("}\n");
+    if (!writeLiteral("{\"p\":") || !writeUint8Decimal(command) || !writeLiteral(",\"t\":") || !writeUint8Decimal(protocolClickType) ||
+        !writeLiteral(",\"i\":") || !writeUint8Decimal(clickableId) || !writeLiteral(",\"c\":") || !writeUint8Decimal(correlationId))
+    {
+        return false;
+    }
+    if (isTimestamped())
+    {
+        return writeLiteral(",\"m\":") && writeUint32Decimal(BridgeClock::toBridgeTime(timeKeeper::getTime())) && writeLiteral("}\n");
+    }
+    return writeLiteral("}\n");
+}
+#endif
+
+#if LSH_STATIC_CONFIG_NETWORK_OCCUPANCY > 0
+[[nodiscard]] auto writeJsonOccupancyPayload(uint8_t occupancyId, bool occupied) -> bool
+{
+    if (!writeLiteral("{\"p\":26,\"i\":") || !writeUint8Decimal(occupancyId) || !writeLiteral(",\"s\":") ||
+        !writeSerialByte(static_cast<uint8_t>(occupied ? '1' : '0')))
+    {
+        return false;
+    }
+    if (isTimestamped())
+    {
+        return writeLiteral(",\"m\":") && writeUint32Decimal(BridgeClock::toBridgeTime(timeKeeper::getTime())) && writeLiteral("}\n");
+    }
+    return writeLiteral("}\n");
+}
+#endif
+
+#if LSH_STATIC_CONFIG_NETWORK_ENCODERS > 0
+[[nodiscard]] auto writeJsonEncoderStepsPayload(uint8_t encoderId, int8_t steps) -> bool
+{
+    if (!writeLiteral("{\"p\":8,\"i\":") || !writeUint8Decimal(encoderId) || !writeLiteral(",\"r\":") ||
+        (steps < 0 && !writeSerialByte(static_cast<uint8_t>('-'))) ||
+        !writeUint8Decimal(static_cast<uint8_t>(steps < 0 ? -steps : steps)))
+    {
+        return false;
+    }
+    if (isTimestamped())
+    {
+        return writeLiteral(",\"m\":") && writeUint32Decimal(BridgeClock::toBridgeTime(timeKeeper::getTime())) && writeLiteral("}\n");
+    }
+    return writeLiteral("}\n");
+}
+#endif
+
+#if LSH_STATIC_CONFIG_ONE_WIRE_BUSES > 0
+[[nodiscard]] auto writeJsonTemperaturesPayload(const OneWireBus &bus) -> bool
+{
+    if (!writeLiteral("{\"p\":27,\"e\":["))
+    {
+        return false;
+    }
+
+    bool first = true;
+    for (uint8_t index = 0U; index < bus.count(); ++index)
+    {
+        if (!bus.isFresh(index))
+        {
+            continue;
+        }
+        const int16_t raw = bus.reading(index);
+        const uint32_t magnitude = (raw < 0) ? static_cast<uint32_t>(-static_cast<int32_t>(raw)) : static_cast<uint32_t>(raw);
+        if ((!first && !writeSerialByte(static_cast<uint8_t>(','))) || !writeSerialByte(static_cast<uint8_t>('[')) ||
+            !writeUint8Decimal(bus.sensorId(index)) || !writeSerialByte(static_cast<uint8_t>(',')) ||
+            (raw < 0 && !writeSerialByte(static_cast<uint8_t>('-'))) || !writeUint32Decimal(magnitude) ||
+            !writeSerialByte(static_cast<uint8_t>(']')))
+        {
+            return false;
+        }
+        first = false;
+    }
+    if (!writeLiteral("],\"w\":") || !writeUint32Decimal(bus.worstSlot()))
+    {
+        return false;
+    }
+    if (isTimestamped())
+    {
+        return writeLiteral(",\"m\":") && writeUint32Decimal(BridgeClock::toBridgeTime(timeKeeper::getTime())) && writeLiteral("}\n");
+    }
+    return writeLiteral("}\n");
+}
+#endif
+
+#ifdef CONFIG_BRIDGE_ECHO_PROBE
+[[nodiscard]] auto writeJsonEchoProbePayload(uint8_t correlationId) -> bool
+{
+    return writeLiteral("{\"p\":6,\"c\":") && writeUint8Decimal(correlationId) && writeLiteral("}\n");
+}
+
+[[nodiscard]] auto writeJsonRttHistogramPayload() -> bool
+{
+    if (!writeLiteral("{\"p\":7,\"h\":["))
+    {
+        return false;
+    }
+
+    for (uint8_t slotIndex = 0U; slotIndex < EchoProbe::HISTOGRAM_SLOTS; ++slotIndex)
+    {
+        if ((slotIndex != 0U && !writeSerialByte(static_cast<uint8_t>(','))) || !writeUint32Decimal(EchoProbe::histogramSlot(slotIndex)))
+        {
+            return false;
+        }
+    }
+    return writeLiteral("]}\n");
+}
+#endif
+
+[[nodiscard]] auto writeJsonTimerList(uint8_t firstTimer, uint8_t endTimer, uint32_t now_ms) -> bool
+{
+    if (!writeSerialByte(static_cast<uint8_t>('[')))
+    {
+        return false;
+    }
+
+    bool first = true;
+    uint8_t actuatorId = 0U;
+    uint32_t remaining_ms = 0U;
+    for (uint8_t timerIndex = firstTimer; timerIndex < endTimer; ++timerIndex)
+    {
+        if (!lsh::core::static_config::getActiveTimer(timerIndex, now_ms, actuatorId, remaining_ms))
+        {
+            continue;
+        }
+        if ((!first && !writeSerialByte(static_cast<uint8_t>(','))) || !writeSerialByte(static_cast<uint8_t>('[')) ||
+            !writeUint8Decimal(actuatorId) || !writeSerialByte(static_cast<uint8_t>(',')) || !writeUint32Decimal(remaining_ms) ||
+            !writeSerialByte(static_cast<uint8_t>(']')))
+        {
+            return false;
+        }
+        first = false;
+    }
+    return writeSerialByte(static_cast<uint8_t>(']'));
+}
+
+[[nodiscard]] auto writeJsonTimersStatePayload(uint32_t now_ms) -> bool
+{
+    return writeLiteral("{\"p\":22,\"o\":") && writeJsonTimerList(0U, AUTO_OFF_TIMERS, now_ms) && writeLiteral(",\"u\":") &&
+           writeJsonTimerList(AUTO_OFF_TIMERS, TIMER_SLOTS, now_ms) && writeLiteral("}\n");
+}
+
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+[[nodiscard]] auto writeJsonBounceProfilePayload(uint8_t clickableId, const BounceProfile &profile) -> bool
+{
+    if (!writeLiteral("{\"p\":24,\"i\":") || !writeUint8Decimal(clickableId) || !writeLiteral(",\"h\":["))
+    {
+        return false;
+    }
+
+    for (uint8_t bucket = 0U; bucket < BounceProfile::BUCKETS; ++bucket)
+    {
+        if ((bucket != 0U && !writeSerialByte(static_cast<uint8_t>(','))) || !writeUint32Decimal(profile.edgeCount(bucket)))
+        {
+            return false;
+        }
+    }
+    return writeLiteral("],\"x\":") && writeUint32Decimal(profile.bounces()) && writeLiteral(",\"w\":") &&
+           writeUint8Decimal(profile.maxWindow()) && writeLiteral("}\n");
+}
+#endif
+
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+[[nodiscard]] auto writeJsonHealthPingPayload() -> bool
+{
+    return writeLiteral("{\"p\":5,\"d\":[") && writeUint32Decimal(LinkHealth::maxLoopTime()) && writeLiteral(",") &&
+           writeUint32Decimal(LinkHealth::rxErrors()) && writeLiteral(",") && writeUint32Decimal(LinkHealth::txDrops()) &&
+           writeLiteral(",") && writeUint8Decimal(hotLoopState::activeNetworkClicks()) && writeLiteral("]}\n");
 }
 #endif
 #endif
@@ -276,6 +770,9 @@ using lsh::core::protocol::Command;
 
 /**
  * @brief Send one compile-time pre-serialized static control payload.
+ * @details With `CONFIG_BRIDGE_HEALTH_PING` the heartbeat is no longer static:
+ *          it carries the link health summary as `d`, for example
+ *          {"p":5,"d":[maxLoop_ms,rxErrors,txDrops,activeNetworkClicks]}.
  *
  * @param payloadType type of the payload.
  */
@@ -287,6 +784,22 @@ auto serializeStaticPayload(constants::payloads::StaticType payloadType) -> bool
         return false;
     }
 
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+    if (payloadType == StaticType::PING_)
+    {
+#ifdef CONFIG_MSG_PACK
+        if (!writeMsgPackHealthPingPayload())
+#else
+        if (!writeJsonHealthPingPayload())
+#endif
+        {
+            return false;
+        }
+        LinkHealth::onHeartbeatSent();
+        return finishSuccessfulPayload();
+    }
+#endif
+
     if (writeStaticPayload(payloadType))
     {
         return finishSuccessfulPayload();
@@ -313,7 +826,8 @@ auto serializeDetails() -> bool
  * @brief Send an actuator-state payload with a bitpacked byte array.
  * @details The actuator manager keeps a packed state shadow in protocol order,
  *          so this path only appends already-built bytes to the outbound payload.
- *          JSON output format: {"p":2,"s":[byte0,byte1,...]}.
+ *          JSON output format: {"p":2,"s":[byte0,byte1,...]}, plus `"m"` with
+ *          the bridge time of the latest state change once `TIME_SYNC` was accepted.
  */
 auto serializeActuatorsState() -> bool
 {
@@ -333,7 +847,10 @@ auto serializeActuatorsState() -> bool
 /**
  * @brief Send a network click request/confirmation payload using the active serial codec.
  * @details Uses NETWORK_CLICK_REQUEST (p:3) for network click requests.
- *          Example request:  {"p":3,"t":1,"i":7,"c":42}
+ *          Example request:  {"p":3,"t":1,"i":7,"c":42}, plus `"m"` with the
+ *          bridge time of the click once `TIME_SYNC` was accepted.
+ *          The runtime sends requests through `serializeNetworkClickRequest()`
+ *          and keeps this generic writer for confirmations.
  *
  * @param clickableIndex The index of the clickable.
  * @param clickType The type of the click (long, super long).
@@ -383,4 +900,208 @@ auto serializeNetworkClick(uint8_t clickableIndex, constants::ClickType clickTyp
 #endif
 }
 
+/**
+ * @brief Stream the pre-framed network click request of one generated slot.
+ * @details The generator stores one PROGMEM prefix per network-click slot, for
+ *          both codecs, already framed and ending with the `c` key. Only the
+ *          correlation value, the optional `m` timestamp and the terminator are
+ *          written at run time, so the long-press path reaches the UART with a
+ *          slot lookup instead of four key/value encodings.
+ *
+ * @param slotIndex Generated network-click slot of the clickable and click type.
+ * @param correlationId The correlation ID that ties request, ack, failover and confirm together.
+ */
+auto serializeNetworkClickRequest(uint8_t slotIndex, uint8_t correlationId) -> bool
+{
+#if !CONFIG_USE_NETWORK_CLICKS
+    static_cast<void>(slotIndex);
+    static_cast<void>(correlationId);
+    return false;
+#else
+    const bool timestamped = isTimestamped();
+    if (!lsh::core::static_config::writeNetworkClickRequestPrefix(slotIndex, timestamped))
+    {
+        return false;
+    }
+
+#ifdef CONFIG_MSG_PACK
+    if (!writeMsgPackUint(correlationId) ||
+        (timestamped && (!writeMsgPackKey('m') || !writeMsgPackUint32(BridgeClock::toBridgeTime(timeKeeper::getTime())))) ||
+        !endMsgPackFrame())
+#else
+    if (!writeUint8Decimal(correlationId) ||
+        (timestamped && (!writeLiteral(",\"m\":") || !writeUint32Decimal(BridgeClock::toBridgeTime(timeKeeper::getTime())))) ||
+        !writeLiteral("}\n"))
+#endif
+    {
+        return false;
+    }
+    return finishSuccessfulPayload();
+#endif
+}
+
+#if LSH_STATIC_CONFIG_NETWORK_ENCODERS > 0
+/**
+ * @brief Send the net detents of one network rotary encoder.
+ * @details JSON output format: {"p":8,"i":encoderId,"r":steps}, plus `m`
+ *          once the bridge clock is synced.
+ *
+ * @param encoderId generated encoder ID.
+ * @param steps signed detents, never `0`.
+ */
+auto serializeEncoderSteps(uint8_t encoderId, int8_t steps) -> bool
+{
+#ifdef CONFIG_MSG_PACK
+    if (!writeMsgPackEncoderStepsPayload(encoderId, steps))
+#else
+    if (!writeJsonEncoderStepsPayload(encoderId, steps))
+#endif
+    {
+        return false;
+    }
+    return finishSuccessfulPayload();
+}
+#endif
+
+#if LSH_STATIC_CONFIG_NETWORK_OCCUPANCY > 0
+/**
+ * @brief Send the occupancy summary of one network occupancy input.
+ * @details JSON output format: {"p":26,"i":occupancyId,"s":0|1}, plus `m`
+ *          once the bridge clock is synced.
+ *
+ * @param occupancyId generated occupancy input ID.
+ * @param occupied true when the closing window saw motion.
+ */
+auto serializeOccupancy(uint8_t occupancyId, bool occupied) -> bool
+{
+#ifdef CONFIG_MSG_PACK
+    if (!writeMsgPackOccupancyPayload(occupancyId, occupied))
+#else
+    if (!writeJsonOccupancyPayload(occupancyId, occupied))
+#endif
+    {
+        return false;
+    }
+    return finishSuccessfulPayload();
+}
+#endif
+
+#if LSH_STATIC_CONFIG_ONE_WIRE_BUSES > 0
+/**
+ * @brief Send the readings of one completed 1-Wire bus cycle.
+ * @details JSON output format: {"p":27,"e":[[sensorId,raw],...],"w":worstSlot_us},
+ *          plus `m` once the bridge clock is synced. `raw` is the signed
+ *          DS18B20 value in 1/16 degree Celsius; sensors without a valid
+ *          reading in this cycle are left out.
+ *
+ * @param bus the bus that just finished its cycle.
+ */
+auto serializeTemperatures(const OneWireBus &bus) -> bool
+{
+    DP_CONTEXT();
+#ifdef CONFIG_MSG_PACK
+    if (!writeMsgPackTemperaturesPayload(bus))
+#else
+    if (!writeJsonTemperaturesPayload(bus))
+#endif
+    {
+        return false;
+    }
+    return finishSuccessfulPayload();
+}
+#endif
+
+/**
+ * @brief Send the running auto-off and pulse countdowns.
+ * @details JSON output format: {"p":22,"o":[[id,remaining_ms],...],"u":[[id,remaining_ms],...]}.
+ *          The generated profile reads the same timestamps and pulse slots used
+ *          by `checkAutoOffTimers()` and `checkPulseTimers()`, so the snapshot
+ *          needs no extra RAM. Countdowns are measured from the cached loop time.
+ */
+auto serializeTimersState() -> bool
+{
+    DP_CONTEXT();
+    const uint32_t now_ms = timeKeeper::getTime();
+#ifdef CONFIG_MSG_PACK
+    if (!writeMsgPackTimersStatePayload(now_ms))
+#else
+    if (!writeJsonTimersStatePayload(now_ms))
+#endif
+    {
+        return false;
+    }
+    return finishSuccessfulPayload();
+}
+
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+/**
+ * @brief Send the raw-edge bounce statistics of one button.
+ * @details JSON output format: {"p":24,"i":id,"h":[e0,...,e5],"x":bounces,"w":maxWindow_ms}.
+ *          The profile is read in place from the generated clickable object.
+ *
+ * @param clickableIndex generated clickable index.
+ * @return true if the payload was sent, false for an unknown index or a failed write.
+ */
+auto serializeBounceProfile(uint8_t clickableIndex) -> bool
+{
+    DP_CONTEXT();
+    const BounceProfile *const profile = lsh::core::static_config::getBounceProfile(clickableIndex);
+    if (profile == nullptr)
+    {
+        return false;
+    }
+    const uint8_t clickableId = lsh::core::static_config::getClickableId(clickableIndex);
+    DPL("Bounce profile of button ID ", clickableId, ": longest window ", profile->maxWindow(), " ms, ", profile->bounces(), " bounces.");
+#ifdef CONFIG_MSG_PACK
+    if (!writeMsgPackBounceProfilePayload(clickableId, *profile))
+#else
+    if (!writeJsonBounceProfilePayload(clickableId, *profile))
+#endif
+    {
+        return false;
+    }
+    return finishSuccessfulPayload();
+}
+#endif
+
+#ifdef CONFIG_BRIDGE_ECHO_PROBE
+/**
+ * @brief Send one tagged round-trip probe.
+ * @details JSON output format: {"p":6,"c":42}. The bridge answers with
+ *          `ECHO_REPLY` carrying the same correlation ID.
+ *
+ * @param correlationId correlation ID in `1..255`.
+ */
+auto serializeEchoProbe(uint8_t correlationId) -> bool
+{
+#ifdef CONFIG_MSG_PACK
+    if (!writeMsgPackEchoProbePayload(correlationId))
+#else
+    if (!writeJsonEchoProbePayload(correlationId))
+#endif
+    {
+        return false;
+    }
+    return finishSuccessfulPayload();
+}
+
+/**
+ * @brief Send the round-trip histogram.
+ * @details JSON output format: {"p":7,"h":[bucket0,...,bucket11,lost]}.
+ */
+auto serializeRttHistogram() -> bool
+{
+    DP_CONTEXT();
+#ifdef CONFIG_MSG_PACK
+    if (!writeMsgPackRttHistogramPayload())
+#else
+    if (!writeJsonRttHistogramPayload())
+#endif
+    {
+        return false;
+    }
+    return finishSuccessfulPayload();
+}
+#endif  // CONFIG_BRIDGE_ECHO_PROBE
+
 }  // namespace Serializer
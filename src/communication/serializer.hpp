@@ -24,20 +24,43 @@
 #include <stdint.h>
 
 #include "communication/constants/static_payloads.hpp"
+#include "internal/user_config_bridge.hpp"
 #include "util/constants/click_types.hpp"
+
+#if LSH_STATIC_CONFIG_ONE_WIRE_BUSES > 0
+class OneWireBus;
+#endif
 /**
  * @brief Provide functions to emit bridge payloads with the active serial codec.
  *
  */
 namespace Serializer
 {
-[[nodiscard]] auto serializeStaticPayload(constants::payloads::StaticType payloadType) -> bool;  // Send a static control payload
-[[nodiscard]] auto serializeDetails() -> bool;                                                   // Send generated device details
-[[nodiscard]] auto serializeActuatorsState() -> bool;                                            // Send packed actuator state
+[[nodiscard]] auto serializeStaticPayload(constants::payloads::StaticType payloadType) -> bool;     // Send a static control payload
+[[nodiscard]] auto serializeDetails() -> bool;                                                      // Send generated device details
+[[nodiscard]] auto serializeActuatorsState() -> bool;                                               // Send packed actuator state
+[[nodiscard]] auto serializeNetworkClickRequest(uint8_t slotIndex, uint8_t correlationId) -> bool;  // Stream a pre-framed click request
 [[nodiscard]] auto serializeNetworkClick(uint8_t clickableIndex,
                                          constants::ClickType clickType,
                                          bool confirm,
                                          uint8_t correlationId) -> bool;  // Send a network click payload
+[[nodiscard]] auto serializeTimersState() -> bool;  // Send the running auto-off and pulse countdowns
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+[[nodiscard]] auto serializeBounceProfile(uint8_t clickableIndex) -> bool;  // Send the bounce statistics of one button
+#endif
+#ifdef CONFIG_BRIDGE_ECHO_PROBE
+[[nodiscard]] auto serializeEchoProbe(uint8_t correlationId) -> bool;  // Send one tagged round-trip probe
+[[nodiscard]] auto serializeRttHistogram() -> bool;                    // Send the round-trip histogram
+#endif
+#if LSH_STATIC_CONFIG_NETWORK_ENCODERS > 0
+[[nodiscard]] auto serializeEncoderSteps(uint8_t encoderId, int8_t steps) -> bool;  // Send net detents of one network encoder
+#endif
+#if LSH_STATIC_CONFIG_NETWORK_OCCUPANCY > 0
+[[nodiscard]] auto serializeOccupancy(uint8_t occupancyId, bool occupied) -> bool;  // Send the summary of one occupancy input
+#endif
+#if LSH_STATIC_CONFIG_ONE_WIRE_BUSES > 0
+[[nodiscard]] auto serializeTemperatures(const OneWireBus &bus) -> bool;  // Send the fresh readings of one 1-Wire bus cycle
+#endif
 }  // namespace Serializer
 
 #endif  // LSH_CORE_COMMUNICATION_SERIALIZER_HPP
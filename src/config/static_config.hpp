@@ -23,8 +23,13 @@
 
 #include <stdint.h>
 
+#include "internal/user_config_bridge.hpp"
 #include "util/constants/click_types.hpp"
 
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+class BounceProfile;
+#endif
+
 namespace lsh::core::static_config
 {
 static constexpr uint8_t CLICK_SCAN_STATE_CHANGED = 0x01U;    //!< A local click action changed at least one actuator state.
@@ -44,6 +49,7 @@ static constexpr uint8_t CLICK_SCAN_NETWORK_PENDING = 0x02U;  //!< A network-cli
 [[nodiscard]] auto getIndicatorActuatorLinkCount(uint8_t indicatorIndex) noexcept -> uint8_t;
 [[nodiscard]] auto setActuatorStateById(uint8_t actuatorId, bool state) noexcept -> bool;
 [[nodiscard]] auto writeDetailsPayload() noexcept -> bool;
+[[nodiscard]] auto writeNetworkClickRequestPrefix(uint8_t slotIndex, bool timestamped) noexcept -> bool;
 [[nodiscard]] auto runShortClick(uint8_t clickableIndex) noexcept -> bool;
 [[nodiscard]] auto runLongClick(uint8_t clickableIndex) noexcept -> bool;
 [[nodiscard]] auto runSuperLongClick(uint8_t clickableIndex) noexcept -> bool;
@@ -53,13 +59,24 @@ static constexpr uint8_t CLICK_SCAN_NETWORK_PENDING = 0x02U;  //!< A network-cli
 [[nodiscard]] auto getNetworkClickSlotIndex(uint8_t clickableIndex, constants::ClickType clickType) noexcept -> uint8_t;
 [[nodiscard]] auto getNetworkClickClickableIndex(uint8_t slotIndex) noexcept -> uint8_t;
 [[nodiscard]] auto getNetworkClickType(uint8_t slotIndex) noexcept -> constants::ClickType;
+[[nodiscard]] auto getNetworkClickQueueDepth(uint8_t slotIndex) noexcept -> uint8_t;
 [[nodiscard]] auto isClickableConfigurationValid(uint8_t clickableIndex) noexcept -> bool;
 [[nodiscard]] auto scanClickables(uint16_t elapsed_ms) noexcept -> uint8_t;
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+[[nodiscard]] auto getBounceProfile(uint8_t clickableIndex) noexcept -> const BounceProfile *;
+#endif
 [[nodiscard]] auto turnOffAllActuators() noexcept -> bool;
 [[nodiscard]] auto turnOffUnprotectedActuators() noexcept -> bool;
 [[nodiscard]] auto checkPulseTimers(uint16_t elapsed_ms) noexcept -> bool;
+[[nodiscard]] auto reconcilePriorityInputs() noexcept -> bool;
+[[nodiscard]] auto drainEncoders() noexcept -> bool;
+[[nodiscard]] auto scanOccupancy() noexcept -> bool;
+void reportOccupancy() noexcept;
+void pollOneWire(uint16_t elapsed_ms) noexcept;
 [[nodiscard]] auto checkAutoOffTimers(uint32_t now_ms) noexcept -> bool;
+[[nodiscard]] auto getActiveTimer(uint8_t timerIndex, uint32_t now_ms, uint8_t &actuatorId, uint32_t &remaining_ms) noexcept -> bool;
 [[nodiscard]] auto applyPackedActuatorStateByte(uint8_t byteIndex, uint8_t packedByte) noexcept -> bool;
+[[nodiscard]] auto actuatorTopologyFingerprint() noexcept -> uint32_t;
 [[nodiscard]] auto computeIndicatorState(uint8_t indicatorIndex) noexcept -> bool;
 void refreshIndicators() noexcept;
 }  // namespace lsh::core::static_config
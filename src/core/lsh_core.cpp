@@ -23,18 +23,80 @@
 #include <stdint.h>
 
 #include "communication/constants/static_payloads.hpp"
+#include "communication/bridge_clock.hpp"
 #include "communication/bridge_serial.hpp"
 #include "communication/bridge_sync.hpp"
+#include "communication/bridge_transport.hpp"
+#include "communication/echo_probe.hpp"
+#include "communication/link_health.hpp"
+#include "communication/peer_link.hpp"
 #include "communication/serializer.hpp"
 #include "config/configurator.hpp"
 #include "config/static_config.hpp"
 #include "core/network_clicks.hpp"
+#include "core/state_handover.hpp"
+#include "internal/hot_loop_state.hpp"
 #include "internal/user_config_bridge.hpp"
 #include "util/constants/timing.hpp"
 #include "util/debug/debug.hpp"
 #include "util/saturating_time.hpp"
 #include "util/time_keeper.hpp"
 
+namespace
+{
+/**
+ * @brief Timers and counters that `loop()` carries from one pass to the next.
+ * @details They are grouped in one block, rather than kept as function-local
+ *          statics, so `CONFIG_HOT_STATE_LAYOUT` can address every field from
+ *          a single base pointer. Keep the block under 64 bytes: that is the
+ *          reach of the AVR `LDD`/`STD` displacement.
+ */
+struct LoopState
+{
+#if LSH_STATIC_CONFIG_CLICKABLES > 0
+    uint16_t clickableScanAge_ms = 0U;  //!< Saturated age since the last input scan pass.
+#endif
+#if CONFIG_USE_NETWORK_CLICKS
+    uint16_t networkClickCheckAge_ms = 0U;  //!< Saturated age since the last network-click timeout sweep.
+#endif
+#if LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS > 0
+    uint16_t autoOffCheckAge_ms = 0U;  //!< Saturated age since the last generated auto-off timer sweep.
+#endif
+#if LSH_STATIC_CONFIG_NETWORK_OCCUPANCY > 0
+    uint16_t occupancyReportAge_ms = 0U;  //!< Saturated age since the last occupancy summary window closed.
+#endif
+    uint32_t lastLoopTime_ms = 0U;  //!< Previous cached loop timestamp; one 32-bit delta feeds every periodic gate.
+#ifdef CONFIG_LSH_BENCH
+    uint32_t benchmarkIterationCount = 0U;  //!< Loop passes since the last benchmark report.
+    uint32_t lastBenchmarkTime_ms = 0U;     //!< Cached time of the last benchmark report.
+    uint32_t lastIterationTime_us = 0U;     //!< Start of the previous loop pass, for the worst-pass figure.
+    uint32_t worstIteration_us = 0U;        //!< Longest loop pass since the last benchmark report.
+#endif
+};
+
+LoopState loopStateStorage;  //!< The only instance, owned by `lsh::core::loop()`.
+
+/**
+ * @brief Return the loop state block.
+ * @details With `CONFIG_HOT_STATE_LAYOUT` on AVR, the block address is hidden
+ *          from the optimizer behind an empty asm statement that pins it into
+ *          `Y` or `Z`. Every field access in `loop()` then becomes a one-word
+ *          `LDD`/`STD` with displacement instead of a two-word `LDS`/`STS`.
+ *          Without the flag this is a plain reference and the code is
+ *          identical to function-local statics.
+ */
+[[nodiscard]] inline auto loopState() -> LoopState &
+{
+#if defined(CONFIG_HOT_STATE_LAYOUT) && defined(__AVR__)
+    LoopState *base = &loopStateStorage;
+    __asm__("" : "+b"(base));
+    return *base;
+#else
+    return loopStateStorage;
+#endif
+}
+}  // namespace
+
 namespace lsh::core
 {
 
@@ -63,9 +125,21 @@ void setup()
     DPL(FPSTR(dStr::COMPILED_BY_GCC), FPSTR(dStr::SPACE), __GNUC__, FPSTR(dStr::POINT), __GNUC_MINOR__, FPSTR(dStr::POINT),
         __GNUC_PATCHLEVEL__);
     timeKeeper::update();
+    hotLoopState::reset();
     BridgeSerial::init();
+#if LSH_STATIC_CONFIG_PEER_ADDRESS > 0
+    PeerLink::init();
+#endif
     Configurator::configure();      // Apply user configuration and register the real runtime topology.
     Configurator::finalizeSetup();  // Finalize setup for the actually registered devices only.
+#ifdef CONFIG_STATE_HANDOVER
+    // A reset that follows UPDATE_READY brings the outputs back before BOOT,
+    // so the bridge reads the restored state during the handshake.
+    if (StateHandover::restore())
+    {
+        lsh::core::static_config::refreshIndicators();
+    }
+#endif
     // After any controller reboot or config change, the bridge must ask for
     // REQUEST_DETAILS and REQUEST_STATE before mutating commands are trusted.
     BridgeSync::begin();
@@ -97,12 +171,15 @@ void loop()
 #if CONFIG_USE_NETWORK_CLICKS
     using constants::timings::NETWORK_CLICK_CHECK_INTERVAL_MS;
 #endif
+#if LSH_STATIC_CONFIG_NETWORK_OCCUPANCY > 0
+    using constants::timings::OCCUPANCY_REPORT_INTERVAL_MS;
+#endif
 
+    LoopState &state = loopState();
     timeKeeper::update();
     const auto now = timeKeeper::getTime();
-    static uint32_t lastLoopTime_ms = 0U;  //!< Previous cached loop timestamp; one 32-bit delta feeds every periodic gate.
-    const uint32_t elapsedSinceLastLoop_ms = now - lastLoopTime_ms;
-    lastLoopTime_ms = now;
+    const uint32_t elapsedSinceLastLoop_ms = now - state.lastLoopTime_ms;
+    state.lastLoopTime_ms = now;
     // AVR pays noticeably for repeated uint32_t subtractions. The loop does one
     // wrap-safe 32-bit delta, then every periodic subsystem consumes the same
     // saturated 16-bit age because none of these intervals needs multi-minute
@@ -111,39 +188,43 @@ void loop()
 
 #ifdef CONFIG_LSH_BENCH
     using constants::timings::BENCH_ITERATIONS;
-    static uint32_t benchmarkIterationCount = 0U;
-    benchmarkIterationCount++;
-    if (benchmarkIterationCount == BENCH_ITERATIONS)
+    // The average hides periodic spikes such as a full input scan, so the
+    // longest single pass is reported as well.
+    const uint32_t iterationStart_us = micros();
+    const uint32_t iteration_us = iterationStart_us - state.lastIterationTime_us;
+    state.lastIterationTime_us = iterationStart_us;
+    if (state.benchmarkIterationCount != 0U && iteration_us > state.worstIteration_us)
     {
-        static uint32_t lastBenchmarkTime_ms = 0U;
-        const uint32_t elapsedBenchmarkTime_ms = now - lastBenchmarkTime_ms;
+        state.worstIteration_us = iteration_us;
+    }
+    state.benchmarkIterationCount++;
+    if (state.benchmarkIterationCount == BENCH_ITERATIONS)
+    {
+        const uint32_t elapsedBenchmarkTime_ms = now - state.lastBenchmarkTime_ms;
 #ifdef LSH_DEBUG
         DPL(FPSTR(dStr::EXEC_TIME), FPSTR(dStr::SPACE), FPSTR(dStr::FOR), FPSTR(dStr::SPACE), BENCH_ITERATIONS, FPSTR(dStr::SPACE),
             FPSTR(dStr::ITERATIONS), FPSTR(dStr::COLON_SPACE), elapsedBenchmarkTime_ms);
+        DPL(FPSTR(dStr::WORST_ITERATION_US), FPSTR(dStr::COLON_SPACE), state.worstIteration_us);
         DFM();
 #else
         CONFIG_DEBUG_SERIAL->print(F("Exec time for "));
         CONFIG_DEBUG_SERIAL->print(BENCH_ITERATIONS);
         CONFIG_DEBUG_SERIAL->print(F(" iterations: "));
         CONFIG_DEBUG_SERIAL->println(elapsedBenchmarkTime_ms);
+        CONFIG_DEBUG_SERIAL->print(F("Worst iteration us: "));
+        CONFIG_DEBUG_SERIAL->println(state.worstIteration_us);
 #endif  // LSH_DEBUG
-        lastBenchmarkTime_ms = now;
-        benchmarkIterationCount = 0U;
+        state.lastBenchmarkTime_ms = now;
+        state.benchmarkIterationCount = 0U;
+        state.worstIteration_us = 0U;
     }
 #endif  // CONFIG_LSH_BENCH
 
     // These flags persist across loop iterations so the runtime can defer bridge I/O
     // without losing the fact that a state refresh or timeout scan is still required.
-    static bool mustTransmitStateToBridge = false;  //!< True when the bridge must receive a fresh actuator snapshot.
-#if LSH_STATIC_CONFIG_INDICATORS > 0
-    static bool mustRefreshIndicators = false;  //!< True when local indicators must be refreshed from actuator states.
-#endif
-#if CONFIG_USE_NETWORK_CLICKS
-    static bool mustPollNetworkClickTimeouts = false;  //!< True while at least one network click transaction still needs timeout handling.
-#endif
-#if LSH_STATIC_CONFIG_CLICKABLES > 0
-    static uint16_t clickableScanAge_ms = 0U;  //!< Saturated age since the last input scan pass.
-#endif
+    // They live in `hotLoopState` so AVR builds keep them in GPIOR0 and every
+    // idle-path test is a single skip instruction instead of a RAM load.
+    using hotLoopState::Flag;
     uint8_t receivedPayloadsThisLoop = 0U;  //!< Number of bridge payloads already dispatched in this loop iteration.
     uint16_t receivedBytesThisLoop = 0U;    //!< Raw UART bytes already consumed in this loop iteration.
 
@@ -151,9 +232,12 @@ void loop()
     {
         if (stateChanged)
         {
-            mustTransmitStateToBridge = true;
+            hotLoopState::set<Flag::TransmitStateToBridge>();
+#ifdef CONFIG_BRIDGE_TIME_SYNC
+            BridgeClock::noteStateChange(now);
+#endif
 #if LSH_STATIC_CONFIG_INDICATORS > 0
-            mustRefreshIndicators = true;
+            hotLoopState::set<Flag::RefreshIndicators>();
 #endif
         }
     };
@@ -161,7 +245,7 @@ void loop()
     auto drainBridgeRx = [&](uint8_t maxPayloadsToDispatch, uint16_t maxBytesToConsume)
     {
         while (receivedPayloadsThisLoop < maxPayloadsToDispatch && receivedBytesThisLoop < maxBytesToConsume &&
-               CONFIG_COM_SERIAL->HardwareSerial::available())
+               BridgeTransport::available())
         {
             const uint16_t remainingByteBudget = static_cast<uint16_t>(maxBytesToConsume - receivedBytesThisLoop);
             const auto receiveResult = BridgeSerial::receiveAndDispatch(remainingByteBudget);
@@ -173,7 +257,7 @@ void loop()
             receivedBytesThisLoop = static_cast<uint16_t>(receivedBytesThisLoop + receiveResult.consumedBytes);
             noteActuatorStateChanged(receiveResult.dispatch.stateChanged);
 #if CONFIG_USE_NETWORK_CLICKS
-            mustPollNetworkClickTimeouts |= receiveResult.dispatch.networkClickHandled;
+            hotLoopState::setIf<Flag::PollNetworkClickTimeouts>(receiveResult.dispatch.networkClickHandled);
 #endif
             if (receiveResult.payloadDispatched)
             {
@@ -182,6 +266,17 @@ void loop()
         }
     };
 
+#if LSH_STATIC_CONFIG_PRIORITY_INPUTS > 0
+    // Priority-input ISRs already drove their outputs OFF; publish that state
+    // before any other subsystem reads the cached actuator flags.
+    noteActuatorStateChanged(lsh::core::static_config::reconcilePriorityInputs());
+#endif
+#if LSH_STATIC_CONFIG_PEER_ADDRESS > 0
+    // Peer frames are polled on every pass, outside the elapsed-time gates,
+    // so a button on another controller switches here as fast as a local one.
+    noteActuatorStateChanged(PeerLink::receive());
+#endif
+
     if (loopElapsed_ms > 0U)
     {
         // Bridge heartbeat pacing and handshake retries intentionally use their
@@ -189,9 +284,43 @@ void loop()
         // independent from the clickable scan policy while still avoiding extra
         // timestamp work on raw Arduino `loop()` iterations that happened
         // inside the same cached millisecond.
+#ifdef CONFIG_BRIDGE_HEALTH_PING
+        LinkHealth::noteLoopTime(loopElapsed_ms);
+#endif
         BridgeSerial::tickSendIdleTimer(loopElapsed_ms);
         BridgeSync::tick(loopElapsed_ms);
+#ifdef CONFIG_BRIDGE_ECHO_PROBE
+        EchoProbe::tick(loopElapsed_ms);
+#endif
+#ifdef CONFIG_STATE_HANDOVER
+        StateHandover::tick(loopElapsed_ms);
+#endif
+#if LSH_STATIC_CONFIG_ENCODERS > 0
+        // Encoder ISRs only count transitions; draining them on the same
+        // elapsed-time gate batches a fast spin into one action per encoder
+        // and millisecond instead of one per detent.
+        noteActuatorStateChanged(lsh::core::static_config::drainEncoders());
+#endif
+#if LSH_STATIC_CONFIG_OCCUPANCY_INPUTS > 0
+        // Active sensors hold the targets' auto-off countdowns locally; the
+        // bridge only sees one summary per window, whatever the motion rate.
+        noteActuatorStateChanged(lsh::core::static_config::scanOccupancy());
+#endif
+#if LSH_STATIC_CONFIG_NETWORK_OCCUPANCY > 0
+        state.occupancyReportAge_ms = timeUtils::addElapsedTimeSaturated(state.occupancyReportAge_ms, loopElapsed_ms);
+        if (state.occupancyReportAge_ms >= OCCUPANCY_REPORT_INTERVAL_MS)
+        {
+            state.occupancyReportAge_ms = 0U;
+            lsh::core::static_config::reportOccupancy();
+        }
+#endif
     }
+#if LSH_STATIC_CONFIG_ONE_WIRE_BUSES > 0
+    // 1-Wire buses are checked on every pass, not only on elapsed
+    // milliseconds: the Timer5 handler runs the bit slots, and a finished
+    // transfer is collected and the next one started without a pass of delay.
+    lsh::core::static_config::pollOneWire(loopElapsed_ms);
+#endif
 
     // Rescue one pending inbound payload before deciding whether the bridge is
     // alive for long/super-long click routing. Without this bounded pre-drain,
@@ -199,7 +328,7 @@ void loop()
     // the next loop iteration and a network-clickable press could spuriously
     // fall back to the local action on the timeout edge.
 #if CONFIG_USE_NETWORK_CLICKS
-    if (CONFIG_COM_SERIAL->HardwareSerial::available() && !BridgeSerial::isConnected())
+    if (BridgeTransport::available() && !BridgeSerial::isConnected())
     {
         drainBridgeRx(1U, constants::bridgeSerial::COM_SERIAL_MAX_RX_BYTES_PER_LOOP);
     }
@@ -210,16 +339,17 @@ void loop()
     // debounce and long-click timing stay correct even when the scan policy is
     // slower than the historical ~1 kHz default or when the MCU is briefly busy.
 #if LSH_STATIC_CONFIG_CLICKABLES > 0
-    clickableScanAge_ms = timeUtils::addElapsedTimeSaturated(clickableScanAge_ms, loopElapsed_ms);
-    if (clickableScanAge_ms >= CLICKABLE_SCAN_INTERVAL_MS)
+    state.clickableScanAge_ms = timeUtils::addElapsedTimeSaturated(state.clickableScanAge_ms, loopElapsed_ms);
+    if (state.clickableScanAge_ms >= CLICKABLE_SCAN_INTERVAL_MS)
     {
-        const uint16_t clickableElapsed_ms = clickableScanAge_ms;
-        clickableScanAge_ms = 0U;
+        const uint16_t clickableElapsed_ms = state.clickableScanAge_ms;
+        state.clickableScanAge_ms = 0U;
 
         const uint8_t clickScanResultFlags = lsh::core::static_config::scanClickables(clickableElapsed_ms);
         noteActuatorStateChanged((clickScanResultFlags & lsh::core::static_config::CLICK_SCAN_STATE_CHANGED) != 0U);
 #if CONFIG_USE_NETWORK_CLICKS
-        mustPollNetworkClickTimeouts |= (clickScanResultFlags & lsh::core::static_config::CLICK_SCAN_NETWORK_PENDING) != 0U;
+        const bool networkClickPending = (clickScanResultFlags & lsh::core::static_config::CLICK_SCAN_NETWORK_PENDING) != 0U;
+        hotLoopState::setIf<Flag::PollNetworkClickTimeouts>(networkClickPending);
 #endif
     }
 #endif
@@ -231,26 +361,24 @@ void loop()
 
 #if CONFIG_USE_NETWORK_CLICKS
     // Timeout checks for long/super long network clicked clickables
-    if (mustPollNetworkClickTimeouts)
+    if (hotLoopState::test<Flag::PollNetworkClickTimeouts>())
     {
-        static uint16_t networkClickCheckAge_ms = 0U;  //!< Saturated age since the last network-click timeout sweep.
-        networkClickCheckAge_ms = timeUtils::addElapsedTimeSaturated(networkClickCheckAge_ms, loopElapsed_ms);
-        if (networkClickCheckAge_ms > NETWORK_CLICK_CHECK_INTERVAL_MS)  // Check network click timers every N ms
+        state.networkClickCheckAge_ms = timeUtils::addElapsedTimeSaturated(state.networkClickCheckAge_ms, loopElapsed_ms);
+        if (state.networkClickCheckAge_ms > NETWORK_CLICK_CHECK_INTERVAL_MS)  // Check network click timers every N ms
         {
-            networkClickCheckAge_ms = 0U;
+            state.networkClickCheckAge_ms = 0U;
             noteActuatorStateChanged(NetworkClicks::checkAllNetworkClicksTimers(false));
-            mustPollNetworkClickTimeouts = NetworkClicks::thereAreActiveNetworkClicks();
+            hotLoopState::assign<Flag::PollNetworkClickTimeouts>(NetworkClicks::thereAreActiveNetworkClicks());
         }
     }
 #endif
 
     // Check actuators auto OFF timer
 #if LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS > 0
-    static uint16_t autoOffCheckAge_ms = 0U;  //!< Saturated age since the last generated auto-off timer sweep.
-    autoOffCheckAge_ms = timeUtils::addElapsedTimeSaturated(autoOffCheckAge_ms, loopElapsed_ms);
-    if (autoOffCheckAge_ms > ACTUATORS_AUTO_OFF_CHECK_INTERVAL_MS)  // Check every second
+    state.autoOffCheckAge_ms = timeUtils::addElapsedTimeSaturated(state.autoOffCheckAge_ms, loopElapsed_ms);
+    if (state.autoOffCheckAge_ms > ACTUATORS_AUTO_OFF_CHECK_INTERVAL_MS)  // Check every second
     {
-        autoOffCheckAge_ms = 0U;
+        state.autoOffCheckAge_ms = 0U;
         noteActuatorStateChanged(lsh::core::static_config::checkAutoOffTimers(now));
     }
 #endif
@@ -268,22 +396,22 @@ void loop()
 #endif
 
 #if LSH_STATIC_CONFIG_INDICATORS > 0
-    if (mustRefreshIndicators)
+    if (hotLoopState::test<Flag::RefreshIndicators>())
     {
         lsh::core::static_config::refreshIndicators();
-        mustRefreshIndicators = false;
+        hotLoopState::clear<Flag::RefreshIndicators>();
     }
 #endif
 
     // Publish the latest controller state to the bridge only after the grace period
     // that protects the link from immediate reply collisions after an inbound frame.
-    if (mustTransmitStateToBridge)
+    if (hotLoopState::test<Flag::TransmitStateToBridge>())
     {
         if (BridgeSerial::receiveIdleAge_ms > DELAY_AFTER_RECEIVE_MS)
         {
             if (Serializer::serializeActuatorsState())
             {
-                mustTransmitStateToBridge = false;
+                hotLoopState::clear<Flag::TransmitStateToBridge>();
             }
         }
     }
@@ -24,6 +24,7 @@
 #include "communication/serializer.hpp"
 #include "config/static_config.hpp"
 #include "internal/etl_array.hpp"
+#include "internal/hot_loop_state.hpp"
 #include "util/constants/config.hpp"
 #include "util/constants/timing.hpp"
 #include "util/debug/debug.hpp"
@@ -39,6 +40,11 @@ namespace
 {
 constexpr uint8_t NETWORK_CLICK_FLAG_ACTIVE = 0x01U;
 constexpr uint8_t NETWORK_CLICK_FLAG_ACKED = 0x02U;
+// The upper six flag bits count follow-up presses waiting behind the open
+// transaction, so queueing costs no RAM beyond the existing slot. The
+// generator caps every queue depth well below the 63 presses they can hold.
+constexpr uint8_t NETWORK_CLICK_QUEUE_SHIFT = 2U;
+constexpr uint8_t NETWORK_CLICK_QUEUE_UNIT = static_cast<uint8_t>(1U << NETWORK_CLICK_QUEUE_SHIFT);
 
 struct ActiveNetworkClick
 {
@@ -48,8 +54,7 @@ struct ActiveNetworkClick
 };
 
 etl::array<ActiveNetworkClick, constants::config::ACTIVE_NETWORK_CLICK_STORAGE_CAPACITY>
-    activeNetworkClicks{};              //!< Pending network-click transactions, dense and compact.
-uint8_t activeNetworkClickCount = 0U;   //!< Number of active entries in `activeNetworkClicks`.
+    activeNetworkClicks{};              //!< One fixed slot per network clickable/click type, with its queued presses.
 uint8_t nextCorrelationId = 0U;         //!< Monotonic 8-bit generator. 0 is reserved as "missing/invalid".
 uint32_t lastTimersUpdateTime_ms = 0U;  //!< Last cached time used to advance active network-click ages.
 
@@ -74,6 +79,11 @@ void markNetworkClickAcked(ActiveNetworkClick &entry)
     entry.flags |= NETWORK_CLICK_FLAG_ACKED;
 }
 
+auto queuedFollowUps(const ActiveNetworkClick &entry) -> uint8_t
+{
+    return static_cast<uint8_t>(entry.flags >> NETWORK_CLICK_QUEUE_SHIFT);
+}
+
 auto getNetworkClickSlotIndex(uint8_t clickableIndex, constants::ClickType clickType) -> uint8_t
 {
     if (!isSupportedNetworkClickType(clickType))
@@ -119,9 +129,9 @@ auto findActiveNetworkClick(uint8_t clickableIndex, constants::ClickType clickTy
 void clearActiveNetworkClickSlot(uint8_t slotIndex)
 {
     auto &entry = activeNetworkClicks[slotIndex];
-    if (isNetworkClickActive(entry) && activeNetworkClickCount != 0U)
+    if (isNetworkClickActive(entry) && hotLoopState::activeNetworkClicks() != 0U)
     {
-        --activeNetworkClickCount;
+        --hotLoopState::activeNetworkClicks();
     }
     entry.age_ms = 0U;
     entry.correlationId = 0U;
@@ -139,7 +149,7 @@ void eraseActiveNetworkClickAt(uint8_t slotIndex)
 
 auto appendActiveNetworkClick(uint8_t clickableIndex, constants::ClickType clickType) -> ActiveNetworkClick *
 {
-    if (activeNetworkClickCount >= constants::config::MAX_ACTIVE_NETWORK_CLICKS)
+    if (hotLoopState::activeNetworkClicks() >= constants::config::MAX_ACTIVE_NETWORK_CLICKS)
     {
         return nullptr;
     }
@@ -159,10 +169,42 @@ auto appendActiveNetworkClick(uint8_t clickableIndex, constants::ClickType click
     entry.age_ms = 0U;
     entry.correlationId = generateCorrelationId();
     entry.flags = NETWORK_CLICK_FLAG_ACTIVE;
-    ++activeNetworkClickCount;
+    ++hotLoopState::activeNetworkClicks();
     return &entry;
 }
 
+/**
+ * @brief Close one confirmed transaction and replay the next queued press, if any.
+ * @details Only a fully confirmed transaction releases the queue: the bridge
+ *          just proved to be reachable, so the follow-up press goes out as a
+ *          fresh request with its own correlation ID and inherits the remaining
+ *          queued count. Timeouts and failovers erase the slot instead and drop
+ *          the queue, because replaying presses against an unreachable bridge
+ *          would only chain more timeouts.
+ *
+ * @param slotIndex Fixed generated slot of the confirmed transaction.
+ */
+void completeActiveNetworkClickAt(uint8_t slotIndex)
+{
+    const uint8_t queued = queuedFollowUps(activeNetworkClicks[slotIndex]);
+    clearActiveNetworkClickSlot(slotIndex);
+    if (queued == 0U)
+    {
+        return;
+    }
+
+    auto &entry = activeNetworkClicks[slotIndex];
+    entry.age_ms = 0U;
+    entry.correlationId = generateCorrelationId();
+    entry.flags = static_cast<uint8_t>(NETWORK_CLICK_FLAG_ACTIVE | ((queued - 1U) << NETWORK_CLICK_QUEUE_SHIFT));
+    ++hotLoopState::activeNetworkClicks();
+    if (!Serializer::serializeNetworkClickRequest(slotIndex, entry.correlationId))
+    {
+        DPL("Dropping queued network clicks because the UART rejected the replayed request.");
+        clearActiveNetworkClickSlot(slotIndex);
+    }
+}
+
 template <uint8_t SlotIndex> void advanceActiveTimerSlots(uint16_t elapsed_ms)
 {
     // The number of network-click slots is fully generated. Recursing over the
@@ -189,7 +231,7 @@ template <uint8_t SlotIndex> void advanceActiveTimerSlots(uint16_t elapsed_ms)
  */
 void advanceActiveTimersTo(uint32_t now)
 {
-    if (activeNetworkClickCount == 0U)
+    if (hotLoopState::activeNetworkClicks() == 0U)
     {
         lastTimersUpdateTime_ms = now;
         return;
@@ -234,7 +276,7 @@ template <uint8_t SlotIndex> auto checkAllNetworkClickTimerSlots(bool failover)
             }
             else if (entry.correlationId != 0U && Serializer::serializeNetworkClick(clickableIndex, clickType, true, entry.correlationId))
             {
-                eraseActiveNetworkClickAt(SlotIndex);
+                completeActiveNetworkClickAt(SlotIndex);
             }
         }
         else if (failover || entry.age_ms > LCNB_TIMEOUT_MS)
@@ -264,6 +306,9 @@ using constants::ClickType;
  * @param clickType The type of click (LONG or SUPER_LONG).
  * @return RequestResult::Accepted if the request frame has been accepted by
  *         the UART and the pending timeout should remain active.
+ * @return RequestResult::Queued if the same clickable/type pair still has one
+ *         unresolved transaction and the press has been queued (or merged)
+ *         behind it, following the generated per-slot queue depth.
  * @return RequestResult::AlreadyPending if the same clickable/type pair still
  *         has one unresolved transaction and this press should be ignored.
  * @return RequestResult::TransportRejected if the UART rejected the request
@@ -276,8 +321,15 @@ auto request(uint8_t clickableIndex, constants::ClickType clickType) -> RequestR
     {
         return RequestResult::TransportRejected;
     }
-    if (findActiveNetworkClick(clickableIndex, clickType) != nullptr)
+    auto *const pending = findActiveNetworkClick(clickableIndex, clickType);
+    if (pending != nullptr)
     {
+        const auto slotIndex = static_cast<uint8_t>(pending - activeNetworkClicks.data());
+        if (queuedFollowUps(*pending) < lsh::core::static_config::getNetworkClickQueueDepth(slotIndex))
+        {
+            pending->flags = static_cast<uint8_t>(pending->flags + NETWORK_CLICK_QUEUE_UNIT);
+            return RequestResult::Queued;
+        }
         DPL("Rejecting new network click because the same clickable and click type still have one pending transaction.");
         return RequestResult::AlreadyPending;
     }
@@ -290,7 +342,8 @@ auto request(uint8_t clickableIndex, constants::ClickType clickType) -> RequestR
         return RequestResult::TransportRejected;
     }
 
-    if (!Serializer::serializeNetworkClick(clickableIndex, clickType, false, entry->correlationId))
+    const auto slotIndex = static_cast<uint8_t>(entry - activeNetworkClicks.data());
+    if (!Serializer::serializeNetworkClickRequest(slotIndex, entry->correlationId))
     {
         eraseNetworkClick(clickableIndex, clickType);
         return RequestResult::TransportRejected;
@@ -328,7 +381,7 @@ auto confirm(uint8_t clickableIndex, constants::ClickType clickType) -> bool
     const uint8_t correlationId = entry->correlationId;
     if (Serializer::serializeNetworkClick(clickableIndex, clickType, true, correlationId))
     {
-        eraseNetworkClick(clickableIndex, clickType);
+        completeActiveNetworkClickAt(static_cast<uint8_t>(entry - activeNetworkClicks.data()));
     }
     else
     {
@@ -364,7 +417,7 @@ auto matchesCorrelationId(uint8_t clickableIndex, constants::ClickType clickType
  */
 auto thereAreActiveNetworkClicks() -> bool
 {
-    return activeNetworkClickCount != 0U;
+    return hotLoopState::activeNetworkClicks() != 0U;
 }
 
 /**
@@ -444,7 +497,7 @@ auto checkNetworkClickTimer(uint8_t clickableIndex, constants::ClickType clickTy
 
         if (Serializer::serializeNetworkClick(clickableIndex, clickType, true, entry->correlationId))
         {
-            eraseNetworkClick(clickableIndex, clickType);
+            completeActiveNetworkClickAt(static_cast<uint8_t>(entry - activeNetworkClicks.data()));
         }
         return false;
     }
@@ -471,7 +524,7 @@ auto checkAllNetworkClicksTimers(bool failover) -> bool
     // DP_CONTEXT(); pollutes serial
     const auto now = timeKeeper::getTime();
     advanceActiveTimersTo(now);
-    if (activeNetworkClickCount == 0U)
+    if (hotLoopState::activeNetworkClicks() == 0U)
     {
         return false;
     }
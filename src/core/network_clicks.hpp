@@ -33,23 +33,27 @@
  * at least one click is pending. Each clickable/type pair can hold at most one
  * in-flight network transaction at a time, so one held button may legitimately
  * occupy two slots when both long and super-long network clicks are enabled.
- * Callers must inspect the returned
+ * Presses that arrive while that transaction is open are dropped, merged or
+ * queued according to the generated per-slot queue depth and replayed one by
+ * one as each transaction is confirmed. Callers must inspect the returned
  * `RequestResult`: only `TransportRejected` means the network path is
- * unavailable for this click, while `AlreadyPending` means the press was
- * intentionally ignored because the previous transaction is still open.
+ * unavailable for this click, while `Queued` and `AlreadyPending` mean the
+ * press was deferred or intentionally ignored because the previous
+ * transaction is still open.
  */
 namespace NetworkClicks
 {
 enum class RequestResult : uint8_t
 {
     Accepted,          //!< The request frame has been accepted by the UART and the request-timeout window is now active.
-    AlreadyPending,    //!< The same clickable/clickType pair already has one in-flight transaction.
+    Queued,            //!< The press waits behind the in-flight transaction of the same clickable/clickType pair.
+    AlreadyPending,    //!< The same clickable/clickType pair already has one in-flight transaction and a full queue.
     TransportRejected  //!< The UART rejected the outgoing request frame.
 };
 
 // Network clicks
 [[nodiscard]] auto request(uint8_t clickableIndex, constants::ClickType clickType)
-    -> RequestResult;  // Initiates a network click action and reports whether the transaction was accepted, already pending, or rejected.
+    -> RequestResult;  // Initiates a network click action and reports whether the press was accepted, queued, ignored, or rejected.
 [[nodiscard]] auto confirm(uint8_t clickableIndex, constants::ClickType clickType)
     -> bool;  // Confirms a pending network click action after receiving an ACK
 [[nodiscard]] auto matchesCorrelationId(uint8_t clickableIndex, constants::ClickType clickType, uint8_t correlationId)
@@ -0,0 +1,170 @@
+/**
+ * @file    state_handover.cpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Implements the actuator state handover across a reset into new firmware.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/state_handover.hpp"
+
+#ifdef CONFIG_STATE_HANDOVER
+#include <stddef.h>
+
+#include "communication/constants/config.hpp"
+#include "communication/constants/static_payloads.hpp"
+#include "communication/serializer.hpp"
+#include "config/static_config.hpp"
+#include "device/actuator_manager.hpp"
+#include "internal/user_config_bridge.hpp"
+#include "util/saturating_time.hpp"
+
+#if defined(__AVR__)
+#define LSH_STATE_HANDOVER_NOINIT __attribute__((section(".noinit")))
+#else
+#define LSH_STATE_HANDOVER_NOINIT
+#endif
+
+namespace StateHandover
+{
+namespace
+{
+constexpr uint16_t SNAPSHOT_MAGIC = 0x4C55U;  //!< Marks a snapshot written by `prepare()`, "LU".
+
+/**
+ * @brief Packed actuator state kept across a reset.
+ * @details The C runtime clears `.bss` but leaves `.noinit` alone, so a
+ *          watchdog or external reset keeps the block. After a power cycle,
+ *          or if the bootloader used the same RAM, the contents are random and
+ *          the magic, topology and check byte reject them.
+ */
+struct Snapshot
+{
+    uint16_t magic;                                                      //!< `SNAPSHOT_MAGIC` while the snapshot is armed.
+    uint8_t actuatorCount;                                               //!< `CONFIG_MAX_ACTUATORS` of the firmware that wrote it.
+    uint32_t topology;                                                   //!< Generated hash of the ordered actuator IDs and pins.
+    uint8_t packedStates[CONFIG_PACKED_ACTUATOR_STATE_STORAGE_CAPACITY];  //!< Copy of `Actuators::packedActuatorStates`.
+    uint8_t check;                                                       //!< Check byte over every previous field.
+};
+
+Snapshot snapshot LSH_STATE_HANDOVER_NOINIT;  //!< The only snapshot, never initialized by the runtime.
+uint16_t armedAge_ms = 0U;                     //!< Saturated age of the snapshot armed by this firmware, `0` when none.
+bool armed = false;                            //!< True between `prepare()` and the window expiry.
+
+/**
+ * @brief Compute the check byte of the current snapshot contents.
+ * @details A rotate-and-xor sum seeded with a non-zero value, so an all-zero
+ *          or all-ones RAM block never validates.
+ */
+[[nodiscard]] auto computeCheck() -> uint8_t
+{
+    uint8_t check = 0xA5U;
+    const auto *const bytes = reinterpret_cast<const uint8_t *>(&snapshot);
+    for (uint8_t byteIndex = 0U; byteIndex < static_cast<uint8_t>(offsetof(Snapshot, check)); ++byteIndex)
+    {
+        check = static_cast<uint8_t>(((check << 1U) | (check >> 7U)) ^ bytes[byteIndex]);
+    }
+    return check;
+}
+
+void invalidate()
+{
+    snapshot.magic = 0U;
+    armed = false;
+    armedAge_ms = 0U;
+}
+}  // namespace
+
+/**
+ * @brief Save the actuator state and answer `UPDATE_READY`.
+ * @details Repeated requests refresh the snapshot and restart the window, so a
+ *          bridge may simply retry when the answer got lost. The snapshot is
+ *          dropped again when `UPDATE_READY` cannot leave, because the bridge
+ *          will not reset a controller that never confirmed.
+ *
+ * @return true if the snapshot is armed and the bridge was told so.
+ */
+auto prepare() -> bool
+{
+    snapshot.magic = SNAPSHOT_MAGIC;
+    snapshot.actuatorCount = CONFIG_MAX_ACTUATORS;
+    snapshot.topology = lsh::core::static_config::actuatorTopologyFingerprint();
+    for (uint8_t byteIndex = 0U; byteIndex < CONFIG_PACKED_ACTUATOR_STATE_BYTES; ++byteIndex)
+    {
+        snapshot.packedStates[byteIndex] = Actuators::packedActuatorStates[byteIndex];
+    }
+    snapshot.check = computeCheck();
+
+    if (!Serializer::serializeStaticPayload(constants::payloads::StaticType::UPDATE_READY))
+    {
+        invalidate();
+        return false;
+    }
+    armed = true;
+    armedAge_ms = 0U;
+    return true;
+}
+
+/**
+ * @brief Discard the saved state when no reset followed within the window.
+ * @details Without the expiry a snapshot taken for an update that was then
+ *          cancelled would resurrect old output states at the next unrelated
+ *          watchdog reset. Local changes made while armed are not folded into
+ *          the snapshot; the bridge resends its view after the re-sync anyway.
+ *
+ * @param elapsed_ms Milliseconds elapsed since the previous bridge housekeeping pass.
+ */
+void tick(uint16_t elapsed_ms)
+{
+    if (!armed)
+    {
+        return;
+    }
+    armedAge_ms = timeUtils::addElapsedTimeSaturated(armedAge_ms, elapsed_ms);
+    if (armedAge_ms >= constants::bridgeSerial::STATE_HANDOVER_WINDOW_MS)
+    {
+        invalidate();
+    }
+}
+
+/**
+ * @brief Apply and consume a valid saved state after a reset.
+ * @details Must run after `Configurator::configure()`, because the generated
+ *          setters need the final actuator objects. The snapshot is consumed
+ *          before it is applied, so a crash while applying cannot loop. A
+ *          snapshot from a firmware whose actuators differ in count, order,
+ *          ID or pin is ignored: its bits would switch the wrong outputs.
+ *
+ * @return true if at least one actuator changed state.
+ */
+auto restore() -> bool
+{
+    if (snapshot.magic != SNAPSHOT_MAGIC || snapshot.actuatorCount != CONFIG_MAX_ACTUATORS ||
+        snapshot.topology != lsh::core::static_config::actuatorTopologyFingerprint() || snapshot.check != computeCheck())
+    {
+        invalidate();
+        return false;
+    }
+    invalidate();
+
+    bool anyActuatorChangedState = false;
+    for (uint8_t byteIndex = 0U; byteIndex < CONFIG_PACKED_ACTUATOR_STATE_BYTES; ++byteIndex)
+    {
+        anyActuatorChangedState |= lsh::core::static_config::applyPackedActuatorStateByte(byteIndex, snapshot.packedStates[byteIndex]);
+    }
+    return anyActuatorChangedState;
+}
+}  // namespace StateHandover
+#endif  // CONFIG_STATE_HANDOVER
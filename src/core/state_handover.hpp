@@ -0,0 +1,44 @@
+/**
+ * @file    state_handover.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Declares the actuator state handover across a reset into new firmware.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_CORE_STATE_HANDOVER_HPP
+#define LSH_CORE_CORE_STATE_HANDOVER_HPP
+
+#include <stdint.h>
+
+/**
+ * @brief Actuator state handover for firmware updates flashed by the bridge.
+ *
+ * @details Compiled only with `CONFIG_STATE_HANDOVER`. This is not an update
+ * path: the image is written by the bootloader after the bridge resets the
+ * controller and flashes it over the same UART. Before that, `PREPARE_UPDATE` makes the controller save
+ * its packed actuator state in RAM that survives a reset and answer with
+ * `UPDATE_READY`. The new firmware restores that state during `setup()`, so
+ * the outputs are back before the first `BOOT` instead of waiting for the
+ * bridge to resend them after the handshake.
+ */
+namespace StateHandover
+{
+[[nodiscard]] auto prepare() -> bool;  // Save the actuator state and answer UPDATE_READY.
+void tick(uint16_t elapsed_ms);        // Discard the saved state when no reset followed within the window.
+[[nodiscard]] auto restore() -> bool;  // Apply and consume a valid saved state after a reset.
+}  // namespace StateHandover
+
+#endif  // LSH_CORE_CORE_STATE_HANDOVER_HPP
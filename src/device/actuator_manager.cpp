@@ -193,6 +193,28 @@ auto checkCompactAutoOffTimer(uint8_t autoOffIndex, uint8_t actuatorIndex, Actua
     }
     return false;
 }
+
+/**
+ * @brief Report the countdown of one generated compact auto-off entry.
+ *
+ * @param autoOffIndex Dense index inside the compact auto-off timestamp pool.
+ * @param actuator Actuator owning the entry.
+ * @param now_ms Cached current time.
+ * @param timer_ms Auto-off timeout for the actuator.
+ * @param remaining_ms Receives the time left, `0` when the next sweep is already due.
+ * @return true if the actuator is ON, so the countdown is running.
+ */
+auto getCompactAutoOffRemaining(uint8_t autoOffIndex, const Actuator &actuator, uint32_t now_ms, uint32_t timer_ms, uint32_t &remaining_ms)
+    -> bool
+{
+    if (autoOffIndex >= constants::config::MAX_AUTO_OFF_ACTUATORS || !actuator.getState())
+    {
+        return false;
+    }
+    const uint32_t elapsed_ms = now_ms - autoOffLastSwitchTimes[autoOffIndex];
+    remaining_ms = (elapsed_ms >= timer_ms) ? 0U : timer_ms - elapsed_ms;
+    return true;
+}
 #endif
 
 /**
@@ -65,6 +65,11 @@ void recordSwitchTime(uint8_t actuatorIndex, uint32_t now_ms);  // Records a sta
                                             Actuator &actuator,
                                             uint32_t now_ms,
                                             uint32_t timer_ms) -> bool;  // Checks one generated compact auto-off entry.
+[[nodiscard]] auto getCompactAutoOffRemaining(uint8_t autoOffIndex,
+                                              const Actuator &actuator,
+                                              uint32_t now_ms,
+                                              uint32_t timer_ms,
+                                              uint32_t &remaining_ms) -> bool;  // Reports one compact auto-off countdown.
 #endif
 
 /**
@@ -0,0 +1,211 @@
+/**
+ * @file    hot_loop_state.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Storage for the one-bit loop flags and small counters touched on every loop pass.
+ *
+ * Classic AVR parts expose three General Purpose I/O Registers. GPIOR0 lives in
+ * the low I/O space, so single-bit updates and tests compile to one `SBI`,
+ * `CBI` or `SBIS` instruction instead of a `LDS`/`ORI`/`STS` sequence on RAM.
+ * GPIOR1/GPIOR2 are reached with single-cycle `IN`/`OUT` instead of two-cycle
+ * `LDS`/`STS`. Other targets, or builds that define
+ * `CONFIG_DISABLE_GPIOR_HOT_STATE`, keep the same API backed by plain RAM.
+ * The header also owns `LSH_HOT_PROGMEM`, the flash placement of tables read on
+ * the loop or ISR path.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_INTERNAL_HOT_LOOP_STATE_HPP
+#define LSH_CORE_INTERNAL_HOT_LOOP_STATE_HPP
+
+#include <stdint.h>
+
+#if defined(__AVR__)
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#endif
+
+#if defined(__AVR__) && defined(GPIOR0) && defined(GPIOR1) && defined(GPIOR2) && !defined(CONFIG_DISABLE_GPIOR_HOT_STATE)
+#define LSH_HOT_LOOP_STATE_IN_GPIOR 1
+#else
+#define LSH_HOT_LOOP_STATE_IN_GPIOR 0
+#endif
+
+/**
+ * @brief Flash placement for tables read on the loop or ISR path.
+ * @details With `CONFIG_HOT_STATE_LAYOUT` on AVR, tables go to `.progmem.gcc*`,
+ *          which the stock linker scripts place ahead of every other `PROGMEM`
+ *          table. They therefore stay inside the 64 KB that `pgm_read_byte()`
+ *          reaches on ATmega2560-class parts, however much flash data the core
+ *          and other libraries add. Otherwise this is plain `PROGMEM`.
+ */
+#if defined(__AVR__) && defined(CONFIG_HOT_STATE_LAYOUT)
+#define LSH_HOT_PROGMEM __attribute__((section(".progmem.gcc_lsh")))
+#elif defined(__AVR__)
+#define LSH_HOT_PROGMEM PROGMEM
+#else
+#define LSH_HOT_PROGMEM
+#endif
+
+namespace hotLoopState
+{
+/**
+ * @brief Bit positions of the persistent loop flags.
+ * @details Every flag is owned by `lsh::core::loop()` or by one module that the
+ *          loop consults on each pass. Keep the list short: only flags tested
+ *          on the idle path belong here.
+ */
+enum class Flag : uint8_t
+{
+    TransmitStateToBridge = 0U,     //!< The bridge must receive a fresh actuator snapshot.
+    RefreshIndicators = 1U,         //!< Local indicators must be refreshed from actuator states.
+    PollNetworkClickTimeouts = 2U,  //!< At least one network click transaction still needs timeout handling.
+};
+
+namespace detail
+{
+[[nodiscard]] constexpr inline auto mask(Flag flag) -> uint8_t
+{
+    return static_cast<uint8_t>(1U << static_cast<uint8_t>(flag));
+}
+
+#if LSH_HOT_LOOP_STATE_IN_GPIOR
+[[nodiscard]] inline auto flags() -> volatile uint8_t &
+{
+    return GPIOR0;
+}
+#else
+inline uint8_t flagStorage = 0U;  //!< RAM fallback for the loop flag bits.
+
+[[nodiscard]] inline auto flags() -> uint8_t &
+{
+    return flagStorage;
+}
+#endif  // LSH_HOT_LOOP_STATE_IN_GPIOR
+}  // namespace detail
+
+/**
+ * @brief Set one loop flag.
+ *
+ * @tparam F flag to set.
+ */
+template <Flag F> inline void set()
+{
+    detail::flags() |= detail::mask(F);
+}
+
+/**
+ * @brief Clear one loop flag.
+ *
+ * @tparam F flag to clear.
+ */
+template <Flag F> inline void clear()
+{
+    detail::flags() &= static_cast<uint8_t>(~detail::mask(F));
+}
+
+/**
+ * @brief Set one loop flag only when the condition is true.
+ * @details Mirrors the `flag |= condition` idiom without a read-modify-write
+ *          on the not-taken path.
+ *
+ * @tparam F flag to set.
+ * @param condition true to set the flag, false to leave it untouched.
+ */
+template <Flag F> inline void setIf(bool condition)
+{
+    if (condition)
+    {
+        set<F>();
+    }
+}
+
+/**
+ * @brief Assign one loop flag from a boolean.
+ *
+ * @tparam F flag to assign.
+ * @param value new flag value.
+ */
+template <Flag F> inline void assign(bool value)
+{
+    if (value)
+    {
+        set<F>();
+    }
+    else
+    {
+        clear<F>();
+    }
+}
+
+/**
+ * @brief Test one loop flag.
+ *
+ * @tparam F flag to test.
+ * @return true if the flag is set.
+ */
+template <Flag F> [[nodiscard]] inline auto test() -> bool
+{
+    return (detail::flags() & detail::mask(F)) != 0U;
+}
+
+#if LSH_HOT_LOOP_STATE_IN_GPIOR
+/**
+ * @brief Counter of active network click transactions, owned by `NetworkClicks`.
+ */
+[[nodiscard]] inline auto activeNetworkClicks() -> volatile uint8_t &
+{
+    return GPIOR1;
+}
+
+/**
+ * @brief Counter of armed pulse countdowns, owned by the generated pulse helpers.
+ */
+[[nodiscard]] inline auto activePulseActuators() -> volatile uint8_t &
+{
+    return GPIOR2;
+}
+#else
+namespace detail
+{
+inline uint8_t activeNetworkClickStorage = 0U;   //!< RAM fallback for the active network-click counter.
+inline uint8_t activePulseActuatorStorage = 0U;  //!< RAM fallback for the active pulse counter.
+}  // namespace detail
+
+[[nodiscard]] inline auto activeNetworkClicks() -> uint8_t &
+{
+    return detail::activeNetworkClickStorage;
+}
+
+[[nodiscard]] inline auto activePulseActuators() -> uint8_t &
+{
+    return detail::activePulseActuatorStorage;
+}
+#endif  // LSH_HOT_LOOP_STATE_IN_GPIOR
+
+/**
+ * @brief Reset every flag and counter to the power-on state.
+ * @details I/O registers are cleared by a hardware reset, but not by a jump to
+ *          the reset vector, so setup() clears them explicitly.
+ */
+inline void reset()
+{
+    detail::flags() = 0U;
+    activeNetworkClicks() = 0U;
+    activePulseActuators() = 0U;
+}
+}  // namespace hotLoopState
+
+#endif  // LSH_CORE_INTERNAL_HOT_LOOP_STATE_HPP
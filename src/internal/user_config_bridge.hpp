@@ -77,6 +77,36 @@
 #ifndef LSH_STATIC_CONFIG_PULSE_ACTUATORS
 #error "LSH_STATIC_CONFIG_PULSE_ACTUATORS must be defined by the static profile."
 #endif
+#ifndef LSH_STATIC_CONFIG_PRIORITY_INPUTS
+#error "LSH_STATIC_CONFIG_PRIORITY_INPUTS must be defined by the static profile."
+#endif
+#ifndef LSH_STATIC_CONFIG_TOUCH_KEYS
+#error "LSH_STATIC_CONFIG_TOUCH_KEYS must be defined by the static profile."
+#endif
+#ifndef LSH_STATIC_CONFIG_MATRIX_KEYS
+#error "LSH_STATIC_CONFIG_MATRIX_KEYS must be defined by the static profile."
+#endif
+#ifndef LSH_STATIC_CONFIG_ENCODERS
+#error "LSH_STATIC_CONFIG_ENCODERS must be defined by the static profile."
+#endif
+#ifndef LSH_STATIC_CONFIG_NETWORK_ENCODERS
+#error "LSH_STATIC_CONFIG_NETWORK_ENCODERS must be defined by the static profile."
+#endif
+#ifndef LSH_STATIC_CONFIG_OCCUPANCY_INPUTS
+#error "LSH_STATIC_CONFIG_OCCUPANCY_INPUTS must be defined by the static profile."
+#endif
+#ifndef LSH_STATIC_CONFIG_NETWORK_OCCUPANCY
+#error "LSH_STATIC_CONFIG_NETWORK_OCCUPANCY must be defined by the static profile."
+#endif
+#ifndef LSH_STATIC_CONFIG_TEMPERATURE_SENSORS
+#error "LSH_STATIC_CONFIG_TEMPERATURE_SENSORS must be defined by the static profile."
+#endif
+#ifndef LSH_STATIC_CONFIG_ONE_WIRE_BUSES
+#error "LSH_STATIC_CONFIG_ONE_WIRE_BUSES must be defined by the static profile."
+#endif
+#ifndef LSH_STATIC_CONFIG_PEER_ADDRESS
+#error "LSH_STATIC_CONFIG_PEER_ADDRESS must be defined by the static profile."
+#endif
 #ifndef LSH_STATIC_CONFIG_ACTIVE_NETWORK_CLICKS
 #error "LSH_STATIC_CONFIG_ACTIVE_NETWORK_CLICKS must be defined by the static profile."
 #endif
@@ -166,6 +196,40 @@ static constexpr uint8_t CONFIG_MAX_PULSE_ACTUATORS =
     static_cast<uint8_t>(CONFIG_MAX_PULSE_ACTUATORS_WIDE);  //!< Number of generated momentary/pulse actuators in the device.
 static constexpr uint8_t CONFIG_PULSE_STORAGE_CAPACITY = (CONFIG_MAX_PULSE_ACTUATORS == 0U) ? 1U : CONFIG_MAX_PULSE_ACTUATORS;
 
+static_assert(LSH_STATIC_CONFIG_PRIORITY_INPUTS >= 0, "LSH_STATIC_CONFIG_PRIORITY_INPUTS must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_PRIORITY_INPUTS <= 8, "LSH_STATIC_CONFIG_PRIORITY_INPUTS must fit in one pending-mask byte.");
+static_assert(LSH_STATIC_CONFIG_PRIORITY_INPUTS <= LSH_STATIC_CONFIG_CLICKABLES,
+              "LSH_STATIC_CONFIG_PRIORITY_INPUTS cannot exceed LSH_STATIC_CONFIG_CLICKABLES.");
+static_assert(LSH_STATIC_CONFIG_TOUCH_KEYS >= 0, "LSH_STATIC_CONFIG_TOUCH_KEYS must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_TOUCH_KEYS <= 16, "LSH_STATIC_CONFIG_TOUCH_KEYS cannot exceed the 16 ADC channels.");
+static_assert(LSH_STATIC_CONFIG_TOUCH_KEYS <= LSH_STATIC_CONFIG_CLICKABLES,
+              "LSH_STATIC_CONFIG_TOUCH_KEYS cannot exceed LSH_STATIC_CONFIG_CLICKABLES.");
+static_assert(LSH_STATIC_CONFIG_MATRIX_KEYS >= 0, "LSH_STATIC_CONFIG_MATRIX_KEYS must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_MATRIX_KEYS <= 128, "LSH_STATIC_CONFIG_MATRIX_KEYS cannot exceed a 16x8 matrix.");
+static_assert(LSH_STATIC_CONFIG_MATRIX_KEYS <= LSH_STATIC_CONFIG_CLICKABLES,
+              "LSH_STATIC_CONFIG_MATRIX_KEYS cannot exceed LSH_STATIC_CONFIG_CLICKABLES.");
+
+static_assert(LSH_STATIC_CONFIG_ENCODERS >= 0, "LSH_STATIC_CONFIG_ENCODERS must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_ENCODERS <= UINT8_MAX, "LSH_STATIC_CONFIG_ENCODERS must fit in uint8_t.");
+static_assert(LSH_STATIC_CONFIG_NETWORK_ENCODERS >= 0, "LSH_STATIC_CONFIG_NETWORK_ENCODERS must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_NETWORK_ENCODERS <= LSH_STATIC_CONFIG_ENCODERS,
+              "LSH_STATIC_CONFIG_NETWORK_ENCODERS cannot exceed LSH_STATIC_CONFIG_ENCODERS.");
+
+static_assert(LSH_STATIC_CONFIG_OCCUPANCY_INPUTS >= 0, "LSH_STATIC_CONFIG_OCCUPANCY_INPUTS must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_OCCUPANCY_INPUTS <= UINT8_MAX, "LSH_STATIC_CONFIG_OCCUPANCY_INPUTS must fit in uint8_t.");
+static_assert(LSH_STATIC_CONFIG_NETWORK_OCCUPANCY >= 0, "LSH_STATIC_CONFIG_NETWORK_OCCUPANCY must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_NETWORK_OCCUPANCY <= LSH_STATIC_CONFIG_OCCUPANCY_INPUTS,
+              "LSH_STATIC_CONFIG_NETWORK_OCCUPANCY cannot exceed LSH_STATIC_CONFIG_OCCUPANCY_INPUTS.");
+
+static_assert(LSH_STATIC_CONFIG_TEMPERATURE_SENSORS >= 0, "LSH_STATIC_CONFIG_TEMPERATURE_SENSORS must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_TEMPERATURE_SENSORS <= UINT8_MAX, "LSH_STATIC_CONFIG_TEMPERATURE_SENSORS must fit in uint8_t.");
+static_assert(LSH_STATIC_CONFIG_ONE_WIRE_BUSES >= 0, "LSH_STATIC_CONFIG_ONE_WIRE_BUSES must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_ONE_WIRE_BUSES <= LSH_STATIC_CONFIG_TEMPERATURE_SENSORS,
+              "LSH_STATIC_CONFIG_ONE_WIRE_BUSES cannot exceed LSH_STATIC_CONFIG_TEMPERATURE_SENSORS.");
+
+static_assert(LSH_STATIC_CONFIG_PEER_ADDRESS >= 0, "LSH_STATIC_CONFIG_PEER_ADDRESS must be non-negative.");
+static_assert(LSH_STATIC_CONFIG_PEER_ADDRESS <= UINT8_MAX, "LSH_STATIC_CONFIG_PEER_ADDRESS must fit in uint8_t.");
+
 #if defined(LSH_COMPACT_ACTUATOR_SWITCH_TIMES)
 #error "LSH_COMPACT_ACTUATOR_SWITCH_TIMES was removed; set CONFIG_ACTUATOR_DEBOUNCE_TIME_MS=0 for automatic compact storage."
 #endif
@@ -233,5 +297,8 @@ static constexpr uint16_t CONFIG_INDICATOR_ACTUATOR_LINK_STORAGE_CAPACITY =
 
 static constexpr HardwareSerial *const CONFIG_COM_SERIAL = LSH_COM_SERIAL();      //!< Serial port used for the controller-to-bridge link.
 static constexpr HardwareSerial *const CONFIG_DEBUG_SERIAL = LSH_DEBUG_SERIAL();  //!< Serial port used for local debug output.
+#if LSH_STATIC_CONFIG_PEER_ADDRESS > 0
+static constexpr HardwareSerial *const CONFIG_PEER_SERIAL = LSH_PEER_SERIAL();  //!< Serial port used for the peer controller link.
+#endif
 
 #endif  // LSH_CORE_INTERNAL_USER_CONFIG_BRIDGE_HPP
@@ -0,0 +1,142 @@
+/**
+ * @file    bounce_profile.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Defines the opt-in per-input bounce recorder fed by the Clickable FSM.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_PERIPHERALS_INPUT_BOUNCE_PROFILE_HPP
+#define LSH_CORE_PERIPHERALS_INPUT_BOUNCE_PROFILE_HPP
+
+#include <stdint.h>
+
+#include "util/constants/timing.hpp"
+#include "util/saturating_time.hpp"
+
+/**
+ * @brief Raw-edge statistics of one input, independent from its debounce time.
+ *
+ * @details Every scan sample is compared with the last settled raw level. The
+ *          first difference opens an edge window; every further raw transition
+ *          inside it counts as one bounce and moves the window end. The window
+ *          closes once the raw level stayed put for
+ *          `CLICKABLE_BOUNCE_SETTLE_TIME_MS`, and its length, the time from the
+ *          first to the last raw transition, is filed in a power-of-two
+ *          histogram. A debounce longer than the longest window filters every
+ *          recorded edge. Glitches that return to the old level are recorded
+ *          the same way, since the debounce has to swallow them too.
+ *          Resolution is the clickable scan interval.
+ */
+class BounceProfile
+{
+public:
+    static constexpr uint8_t BUCKETS = 6U;  //!< Windows of 0, 1, 2-3, 4-7, 8-15 and 16+ ms.
+
+private:
+    static constexpr uint8_t FLAG_WINDOW_OPEN = 0x01U;
+    static constexpr uint8_t FLAG_RAW_LEVEL = 0x02U;
+
+    uint16_t edgeCounts[BUCKETS] = {};  //!< Saturating counts of closed windows per bucket.
+    uint16_t bounceCount = 0U;          //!< Saturating count of extra raw transitions inside windows.
+    uint8_t windowAge_ms = 0U;          //!< Age of the open window, saturating at `UINT8_MAX`.
+    uint8_t lastTransition_ms = 0U;     //!< Window age of the latest raw transition.
+    uint8_t maxWindow_ms = 0U;          //!< Longest closed window.
+    uint8_t flags = 0U;                 //!< Open-window marker and last raw level.
+
+    [[nodiscard]] static auto bucketFor(uint8_t window_ms) noexcept -> uint8_t
+    {
+        uint8_t bucket = 0U;
+        while (window_ms != 0U && bucket < static_cast<uint8_t>(BUCKETS - 1U))
+        {
+            window_ms = static_cast<uint8_t>(window_ms >> 1U);
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    void closeWindow() noexcept
+    {
+        const uint8_t bucket = bucketFor(this->lastTransition_ms);
+        if (this->edgeCounts[bucket] != UINT16_MAX)
+        {
+            ++this->edgeCounts[bucket];
+        }
+        if (this->lastTransition_ms > this->maxWindow_ms)
+        {
+            this->maxWindow_ms = this->lastTransition_ms;
+        }
+        this->flags &= static_cast<uint8_t>(~FLAG_WINDOW_OPEN);
+    }
+
+public:
+    /**
+     * @brief Feed one raw sample taken by the clickable scan.
+     *
+     * @param rawPressed raw pin level of this scan.
+     * @param elapsed_ms milliseconds since the previous scan of this input.
+     */
+    void sample(bool rawPressed, uint16_t elapsed_ms) noexcept
+    {
+        using constants::timings::CLICKABLE_BOUNCE_SETTLE_TIME_MS;
+
+        const bool lastRaw = (this->flags & FLAG_RAW_LEVEL) != 0U;
+        if ((this->flags & FLAG_WINDOW_OPEN) == 0U)
+        {
+            if (rawPressed != lastRaw)
+            {
+                this->flags = static_cast<uint8_t>(FLAG_WINDOW_OPEN | (rawPressed ? FLAG_RAW_LEVEL : 0U));
+                this->windowAge_ms = 0U;
+                this->lastTransition_ms = 0U;
+            }
+            return;
+        }
+
+        const uint16_t nextAge = timeUtils::addElapsedTimeSaturated(static_cast<uint16_t>(this->windowAge_ms), elapsed_ms);
+        this->windowAge_ms = nextAge > UINT8_MAX ? UINT8_MAX : static_cast<uint8_t>(nextAge);
+        if (rawPressed != lastRaw)
+        {
+            this->flags ^= FLAG_RAW_LEVEL;
+            this->lastTransition_ms = this->windowAge_ms;
+            if (this->bounceCount != UINT16_MAX)
+            {
+                ++this->bounceCount;
+            }
+        }
+
+        if (this->windowAge_ms == UINT8_MAX ||
+            static_cast<uint8_t>(this->windowAge_ms - this->lastTransition_ms) >= CLICKABLE_BOUNCE_SETTLE_TIME_MS)
+        {
+            this->closeWindow();
+        }
+    }
+
+    [[nodiscard]] auto edgeCount(uint8_t bucket) const noexcept -> uint16_t
+    {
+        return (bucket < BUCKETS) ? this->edgeCounts[bucket] : 0U;
+    }
+
+    [[nodiscard]] auto bounces() const noexcept -> uint16_t
+    {
+        return this->bounceCount;
+    }
+
+    [[nodiscard]] auto maxWindow() const noexcept -> uint8_t
+    {
+        return this->maxWindow_ms;
+    }
+};
+
+#endif  // LSH_CORE_PERIPHERALS_INPUT_BOUNCE_PROFILE_HPP
@@ -20,6 +20,10 @@
 
 #include "peripherals/input/clickable.hpp"
 
+#ifdef CONFIG_COMPACT_CLICKABLES
+uint8_t Clickable::tickRemainder_ms = 0U;
+#endif
+
 /**
  * @brief Store the dense runtime index assigned by the generated static profile.
  *
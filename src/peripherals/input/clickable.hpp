@@ -29,11 +29,23 @@
 #ifdef CONFIG_USE_FAST_CLICKABLES
 #include "internal/avr_fast_io.hpp"
 #endif
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+#include "peripherals/input/bounce_profile.hpp"
+#endif
 #include "util/constants/click_detection.hpp"
 #include "util/constants/click_results.hpp"
 #include "util/constants/timing.hpp"
 #include "util/saturating_time.hpp"
 
+/**
+ * @brief Tag that builds a clickable without a pin of its own.
+ * @details Such clickables are advanced only through the `clickDetection()`
+ *          overloads that take an already sampled level, like matrix keys.
+ */
+struct SampledInputTag
+{
+};
+
 /**
  * @brief A class that represents a clickable object, like a button, and its associated logic.
  *
@@ -47,7 +59,29 @@ private:
     static constexpr uint8_t CLICKABLE_FLAG_LONG_FIRED = 0x08U;
     static constexpr uint8_t CLICKABLE_FLAG_SUPER_LONG_FIRED = 0x10U;
 
-#ifndef CONFIG_USE_FAST_CLICKABLES
+#ifdef CONFIG_USE_FAST_CLICKABLES
+    /**
+     * @brief Force one fast-I/O input to plain INPUT with the pull-up disabled.
+     *
+     * lsh-core expects externally pulled-down buttons. Explicitly disabling
+     * the AVR pull-up avoids inheriting a previous firmware's PORT latch state
+     * before the scan loop starts sampling the direct input register.
+     */
+    static void releaseFastInput(lsh::core::avr::FastInputPinBinding binding) noexcept
+    {
+        const uint8_t oldSREG = SREG;
+        cli();
+        *binding.outputPort &= static_cast<uint8_t>(~binding.mask);
+        *binding.modePort &= static_cast<uint8_t>(~binding.mask);
+        SREG = oldSREG;
+    }
+#endif
+
+#ifdef CONFIG_COMPACT_CLICKABLES
+    // Compact layout: the pin is a template argument of the generated scan
+    // call, so no pin number, mask or port pointer is kept in SRAM.
+    static uint8_t tickRemainder_ms;  //!< Milliseconds not yet folded into a whole scan tick, shared by every clickable.
+#elif !defined(CONFIG_USE_FAST_CLICKABLES)
     const uint8_t pinNumber;  //!< The pin to which the clickable is connected to, for conventional IO
 #else
     const uint8_t pinMask;                  //!< Mask of the clickable, for fast IO
@@ -63,22 +97,22 @@ private:
      */
     explicit Clickable(lsh::core::avr::FastInputPinBinding binding) noexcept : pinMask(binding.mask), pinPort(binding.pinPort)
     {
-        // lsh-core expects externally pulled-down buttons. Explicitly disabling
-        // the AVR pull-up avoids inheriting a previous firmware's PORT latch
-        // state before the scan loop starts sampling the direct input register.
-        const uint8_t oldSREG = SREG;
-        cli();
-        *binding.outputPort &= ~this->pinMask;
-        *binding.modePort &= ~this->pinMask;
-        SREG = oldSREG;
+        releaseFastInput(binding);
     }
 #endif
-    uint16_t pressAge_ms = 0U;    //!< Debounced press duration, frozen while a release is only a debounce candidate.
+#ifdef CONFIG_COMPACT_CLICKABLES
+    uint8_t pressAge_ticks = 0U;  //!< Debounced press duration in shared scan ticks, frozen while a release is only a candidate.
+#else
+    uint16_t pressAge_ms = 0U;  //!< Debounced press duration, frozen while a release is only a debounce candidate.
+#endif
     uint8_t debounceAge_ms = 0U;  //!< Elapsed time spent validating the raw candidate edge.
 #if defined(LSH_DEBUG) || defined(LSH_STATIC_CONFIG_RUNTIME_CHECKS)
     uint8_t index = UINT8_MAX;  //!< Debug/runtime-check registration index; stripped from release objects.
 #endif
     uint8_t flags = 0U;  //!< Packed debounce state and once-per-press action markers.
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+    BounceProfile bounceProfile;  //!< Raw-edge statistics, fed before the debounce filter.
+#endif
 
     [[nodiscard]] auto hasClickableFlag(uint8_t flag) const noexcept -> bool
     {
@@ -117,6 +151,54 @@ private:
         return this->isDebouncing() && this->stablePressed() && !this->candidatePressed();
     }
 
+#ifdef CONFIG_COMPACT_CLICKABLES
+    [[nodiscard]] auto pressAge() const noexcept -> uint16_t
+    {
+        return this->pressAge_ticks;
+    }
+
+    void resetPressAge() noexcept
+    {
+        this->pressAge_ticks = 0U;
+    }
+
+    void advancePressAge(uint16_t elapsed) noexcept
+    {
+        const uint16_t nextPressAge = timeUtils::addElapsedTimeSaturated(static_cast<uint16_t>(this->pressAge_ticks), elapsed);
+        this->pressAge_ticks = nextPressAge > UINT8_MAX ? UINT8_MAX : static_cast<uint8_t>(nextPressAge);
+    }
+
+    /**
+     * @brief Sample one compile-time pin without any per-object binding.
+     * @details On boards known by the constexpr pin map the register address
+     *          and mask fold into one direct I/O read.
+     */
+    template <uint8_t Pin> [[nodiscard]] static auto readPin(lsh::core::PinTag<Pin>) noexcept -> bool
+    {
+#ifdef CONFIG_USE_FAST_CLICKABLES
+        const uint8_t mask = lsh::core::avr::readPinBitMask(lsh::core::PinTag<Pin>{});
+        return (*lsh::core::avr::inputRegisterForPin(lsh::core::PinTag<Pin>{}) & mask) != 0U;
+#else
+        return static_cast<bool>(digitalRead(Pin));
+#endif
+    }
+#else
+    [[nodiscard]] auto pressAge() const noexcept -> uint16_t
+    {
+        return this->pressAge_ms;
+    }
+
+    void resetPressAge() noexcept
+    {
+        this->pressAge_ms = 0U;
+    }
+
+    void advancePressAge(uint16_t elapsed_ms) noexcept
+    {
+        this->pressAge_ms = timeUtils::addElapsedTimeSaturated(this->pressAge_ms, elapsed_ms);
+    }
+#endif
+
     void clearTimedActionFlags() noexcept
     {
         this->flags &= static_cast<uint8_t>(~(CLICKABLE_FLAG_LONG_FIRED | CLICKABLE_FLAG_SUPER_LONG_FIRED));
@@ -138,18 +220,21 @@ private:
         return pressed ? constants::ClickResult::NO_CLICK_KEEPING_CLICKED : constants::ClickResult::NO_CLICK;
     }
 
+    template <uint8_t Debounce_ms>
     [[nodiscard]] auto updateDebouncedEdge(bool rawPressed, uint16_t elapsed_ms) noexcept -> constants::ClickResult
     {
         using constants::ClickResult;
-        using constants::timings::CLICKABLE_DEBOUNCE_TIME_MS;
 
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+        this->bounceProfile.sample(rawPressed, elapsed_ms);
+#endif
         if (!this->isDebouncing())
         {
             if (rawPressed == this->stablePressed())
             {
                 return ClickResult::NO_CLICK;
             }
-            if (CLICKABLE_DEBOUNCE_TIME_MS == 0U)
+            if (Debounce_ms == 0U)
             {
                 return this->confirmDebouncedEdge(rawPressed);
             }
@@ -170,7 +255,7 @@ private:
 
         const uint16_t nextDebounceAge = timeUtils::addElapsedTimeSaturated(this->debounceAge_ms, elapsed_ms);
         this->debounceAge_ms = nextDebounceAge > UINT8_MAX ? UINT8_MAX : static_cast<uint8_t>(nextDebounceAge);
-        if (this->debounceAge_ms >= CLICKABLE_DEBOUNCE_TIME_MS)
+        if (this->debounceAge_ms >= Debounce_ms)
         {
             return this->confirmDebouncedEdge(rawPressed);
         }
@@ -183,22 +268,25 @@ private:
      *          That lets AVR-GCC erase disabled click families with
      *          `if constexpr` instead of checking runtime bit flags in the
      *          button polling path. The runtime overload below keeps the same
-     *          behavior for any non-generated caller.
+     *          behavior for any non-generated caller. Press age and thresholds
+     *          share one unit: milliseconds, or scan ticks in compact builds.
+     *          The debounce time is always in milliseconds.
      */
-    template <bool StaticConfigKnown, uint8_t StaticDetectionFlags, uint16_t StaticLongClick_ms, uint16_t StaticSuperLongClick_ms>
-    [[nodiscard]] auto clickDetectionImpl(uint16_t elapsed_ms, uint8_t detectionFlags, uint16_t longClick_ms, uint16_t superLongClick_ms)
-        -> constants::ClickResult
+    template <bool StaticConfigKnown, uint8_t StaticDetectionFlags, uint16_t StaticLongClick_ms, uint16_t StaticSuperLongClick_ms,
+              uint8_t Debounce_ms>
+    [[nodiscard]] auto clickDetectionImpl(bool rawPressed, uint16_t elapsed_ms, uint16_t pressElapsed, uint8_t detectionFlags,
+                                          uint16_t longClick_ms, uint16_t superLongClick_ms) -> constants::ClickResult
     {
         using constants::ClickResult;
         using namespace constants::clickDetection;
 
         const bool wasStablePressed = this->stablePressed();
-        static_cast<void>(this->updateDebouncedEdge(this->getState(), elapsed_ms));
+        static_cast<void>(this->updateDebouncedEdge<Debounce_ms>(rawPressed, elapsed_ms));
         const bool isStablePressed = this->stablePressed();
 
         if (!wasStablePressed && isStablePressed)
         {
-            this->pressAge_ms = 0U;
+            this->resetPressAge();
             this->clearTimedActionFlags();
             if constexpr (StaticConfigKnown)
             {
@@ -218,7 +306,7 @@ private:
         {
             const bool timedActionFired =
                 this->hasClickableFlag(CLICKABLE_FLAG_LONG_FIRED) || this->hasClickableFlag(CLICKABLE_FLAG_SUPER_LONG_FIRED);
-            this->pressAge_ms = 0U;
+            this->resetPressAge();
             this->clearTimedActionFlags();
             if constexpr (StaticConfigKnown)
             {
@@ -253,12 +341,12 @@ private:
             return ClickResult::NO_CLICK_KEEPING_CLICKED;
         }
 
-        this->pressAge_ms = timeUtils::addElapsedTimeSaturated(this->pressAge_ms, elapsed_ms);
+        this->advancePressAge(pressElapsed);
         if constexpr (StaticConfigKnown)
         {
             if constexpr ((StaticDetectionFlags & LONG_ENABLED) != 0U)
             {
-                if (!this->hasClickableFlag(CLICKABLE_FLAG_LONG_FIRED) && this->pressAge_ms >= StaticLongClick_ms)
+                if (!this->hasClickableFlag(CLICKABLE_FLAG_LONG_FIRED) && this->pressAge() >= StaticLongClick_ms)
                 {
                     this->setClickableFlag(CLICKABLE_FLAG_LONG_FIRED, true);
                     return ClickResult::LONG_CLICK;
@@ -267,7 +355,7 @@ private:
 
             if constexpr ((StaticDetectionFlags & SUPER_LONG_ENABLED) != 0U)
             {
-                if (!this->hasClickableFlag(CLICKABLE_FLAG_SUPER_LONG_FIRED) && this->pressAge_ms >= StaticSuperLongClick_ms)
+                if (!this->hasClickableFlag(CLICKABLE_FLAG_SUPER_LONG_FIRED) && this->pressAge() >= StaticSuperLongClick_ms)
                 {
                     this->setClickableFlag(CLICKABLE_FLAG_SUPER_LONG_FIRED, true);
                     return ClickResult::SUPER_LONG_CLICK;
@@ -277,14 +365,14 @@ private:
         else
         {
             if (hasFlag(detectionFlags, LONG_ENABLED) && !this->hasClickableFlag(CLICKABLE_FLAG_LONG_FIRED) &&
-                this->pressAge_ms >= longClick_ms)
+                this->pressAge() >= longClick_ms)
             {
                 this->setClickableFlag(CLICKABLE_FLAG_LONG_FIRED, true);
                 return ClickResult::LONG_CLICK;
             }
 
             if (hasFlag(detectionFlags, SUPER_LONG_ENABLED) && !this->hasClickableFlag(CLICKABLE_FLAG_SUPER_LONG_FIRED) &&
-                this->pressAge_ms >= superLongClick_ms)
+                this->pressAge() >= superLongClick_ms)
             {
                 this->setClickableFlag(CLICKABLE_FLAG_SUPER_LONG_FIRED, true);
                 return ClickResult::SUPER_LONG_CLICK;
@@ -294,7 +382,28 @@ private:
     }
 
 public:
-#ifndef CONFIG_USE_FAST_CLICKABLES
+#ifdef CONFIG_COMPACT_CLICKABLES
+    /**
+     * @brief Construct a compact clickable from a compile-time pin tag.
+     *
+     * The pin is configured once here and then only referenced by the
+     * generated scan call, so the object holds nothing but click state.
+     */
+    template <uint8_t Pin> explicit Clickable(lsh::core::PinTag<Pin>) noexcept
+    {
+#ifdef CONFIG_USE_FAST_CLICKABLES
+        releaseFastInput(lsh::core::avr::makeFastInputPinBinding(lsh::core::PinTag<Pin>{}));
+#else
+        pinMode(Pin, INPUT);
+        digitalWrite(Pin, LOW);
+#endif
+    }
+
+    /**
+     * @brief Construct a compact clickable that owns no pin.
+     */
+    explicit Clickable(SampledInputTag) noexcept {}
+#elif !defined(CONFIG_USE_FAST_CLICKABLES)
     /**
      * @brief Construct a new Clickable object, conventional IO version.
      *
@@ -315,6 +424,11 @@ public:
     template <uint8_t Pin>
     explicit LSH_OPTIONAL_CONSTEXPR_CTOR Clickable(lsh::core::PinTag<Pin>) noexcept : Clickable(static_cast<uint8_t>(Pin))
     {}
+
+    /**
+     * @brief Construct a clickable that owns no pin; `getState()` must not be used.
+     */
+    explicit Clickable(SampledInputTag) noexcept : pinNumber(UINT8_MAX) {}
 #else
     /**
      * @brief Construct a new Clickable object, fast IO version.
@@ -333,6 +447,11 @@ public:
     template <uint8_t Pin>
     explicit Clickable(lsh::core::PinTag<Pin>) noexcept : Clickable(lsh::core::avr::makeFastInputPinBinding(lsh::core::PinTag<Pin>{}))
     {}
+
+    /**
+     * @brief Construct a clickable that owns no pin; `getState()` must not be used.
+     */
+    explicit Clickable(SampledInputTag) noexcept : pinMask(0U), pinPort(nullptr) {}
 #endif
 
 // Delete copy constructor, copy assignment operator, move constructor and move assignment operator
@@ -343,6 +462,7 @@ public:
     auto operator=(Clickable &&) -> Clickable & = delete;
 #endif  // LSH_USING_CPP17
 
+#ifndef CONFIG_COMPACT_CLICKABLES
     /**
      * @brief Get the state of the clickable if configured as INPUT with its external pulldown resistor (PIN -> BUTTON -> +12v/+5V).
      *
@@ -360,13 +480,78 @@ public:
         return (static_cast<bool>(digitalRead(this->pinNumber)));
 #endif
     }
+#endif  // CONFIG_COMPACT_CLICKABLES
 
     void setIndex(uint8_t indexToSet);  // Set the Clickable index on Clickables namespace Array
 
     // Getters
     [[nodiscard]] auto getIndex() const -> uint8_t;  // Get the Clickable index on Clickables namespace Array
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+    [[nodiscard]] auto getBounceProfile() const noexcept -> const BounceProfile &
+    {
+        return this->bounceProfile;
+    }
+#endif
 
     // Utilities
+#ifdef CONFIG_COMPACT_CLICKABLES
+    /**
+     * @brief Fold the elapsed scan time into whole ticks shared by every clickable.
+     * @details Called once per generated scan. The sub-tick remainder carries
+     *          over, so no time is lost between scans; only the phase of one
+     *          press inside its first tick is unknown, which the generator
+     *          covers by adding one tick to every threshold.
+     *
+     * @tparam TickShift Tick length as a power of two, chosen by the generator.
+     * @param elapsed_ms Milliseconds elapsed since the previous clickable scan.
+     * @return uint8_t Whole ticks elapsed, saturated at `UINT8_MAX`.
+     */
+    template <uint8_t TickShift> [[nodiscard]] static auto consumeElapsedTicks(uint16_t elapsed_ms) noexcept -> uint8_t
+    {
+        static_assert(TickShift < 8U, "Compact clickable ticks must keep the remainder inside uint8_t.");
+        const uint16_t total_ms = timeUtils::addElapsedTimeSaturated(elapsed_ms, tickRemainder_ms);
+        tickRemainder_ms = static_cast<uint8_t>(total_ms & ((1U << TickShift) - 1U));
+        const uint16_t ticks = static_cast<uint16_t>(total_ms >> TickShift);
+        return ticks > UINT8_MAX ? UINT8_MAX : static_cast<uint8_t>(ticks);
+    }
+
+    /**
+     * @brief Advance the compact click FSM with fully generated compile-time constants.
+     *
+     * @tparam DetectionFlags Bit mask from `constants::clickDetection`.
+     * @tparam LongClick_ticks Long-click threshold in scan ticks.
+     * @tparam SuperLongClick_ticks Super-long-click threshold in scan ticks.
+     * @tparam Debounce_ms Debounce time of this input in milliseconds.
+     * @param pin Compile-time pin of this clickable.
+     * @param elapsed_ms Milliseconds elapsed since the previous scan, used for debounce.
+     * @param elapsed_ticks Ticks returned by `consumeElapsedTicks()` for this scan.
+     * @return constants::ClickResult The detected click event, or `NO_CLICK`.
+     */
+    template <uint8_t DetectionFlags, uint16_t LongClick_ticks, uint16_t SuperLongClick_ticks,
+              uint8_t Debounce_ms = constants::timings::CLICKABLE_DEBOUNCE_TIME_MS, uint8_t Pin>
+    [[nodiscard]] auto clickDetection(lsh::core::PinTag<Pin> pin, uint16_t elapsed_ms, uint8_t elapsed_ticks) -> constants::ClickResult
+    {
+        static_assert(LongClick_ticks <= UINT8_MAX && SuperLongClick_ticks <= UINT8_MAX,
+                      "Compact clickable thresholds must fit the 8-bit press age.");
+        return this->clickDetectionImpl<true, DetectionFlags, LongClick_ticks, SuperLongClick_ticks, Debounce_ms>(
+            readPin(pin), elapsed_ms, elapsed_ticks, 0U, 0U, 0U);
+    }
+
+    /**
+     * @brief Advance the compact click FSM from an already sampled level.
+     * @details Used by inputs that are not a plain digital read, such as
+     *          touch keys, so they share the same debounce and click rules.
+     */
+    template <uint8_t DetectionFlags, uint16_t LongClick_ticks, uint16_t SuperLongClick_ticks,
+              uint8_t Debounce_ms = constants::timings::CLICKABLE_DEBOUNCE_TIME_MS>
+    [[nodiscard]] auto clickDetection(bool rawPressed, uint16_t elapsed_ms, uint8_t elapsed_ticks) -> constants::ClickResult
+    {
+        static_assert(LongClick_ticks <= UINT8_MAX && SuperLongClick_ticks <= UINT8_MAX,
+                      "Compact clickable thresholds must fit the 8-bit press age.");
+        return this->clickDetectionImpl<true, DetectionFlags, LongClick_ticks, SuperLongClick_ticks, Debounce_ms>(
+            rawPressed, elapsed_ms, elapsed_ticks, 0U, 0U, 0U);
+    }
+#else
     /**
      * @brief Advance the click FSM with fully generated static configuration.
      * @details The selected TOML profile already knows which click kinds are
@@ -383,17 +568,36 @@ public:
     [[nodiscard]] auto clickDetection(uint16_t elapsed_ms, uint8_t detectionFlags, uint16_t longClick_ms, uint16_t superLongClick_ms)
         -> constants::ClickResult
     {
-        return this->clickDetectionImpl<false, 0U, 0U, 0U>(elapsed_ms, detectionFlags, longClick_ms, superLongClick_ms);
+        return this->clickDetectionImpl<false, 0U, 0U, 0U, constants::timings::CLICKABLE_DEBOUNCE_TIME_MS>(
+            this->getState(), elapsed_ms, elapsed_ms, detectionFlags, longClick_ms, superLongClick_ms);
     }
 
     /**
      * @brief Advance the click FSM with fully generated compile-time constants.
+     * @details `Debounce_ms` defaults to the global button debounce; the
+     *          generator passes a per-input value when the TOML sets one.
      */
-    template <uint8_t DetectionFlags, uint16_t LongClick_ms, uint16_t SuperLongClick_ms>
+    template <uint8_t DetectionFlags, uint16_t LongClick_ms, uint16_t SuperLongClick_ms,
+              uint8_t Debounce_ms = constants::timings::CLICKABLE_DEBOUNCE_TIME_MS>
     [[nodiscard]] auto clickDetection(uint16_t elapsed_ms) -> constants::ClickResult
     {
-        return this->clickDetectionImpl<true, DetectionFlags, LongClick_ms, SuperLongClick_ms>(elapsed_ms, 0U, 0U, 0U);
+        return this->clickDetectionImpl<true, DetectionFlags, LongClick_ms, SuperLongClick_ms, Debounce_ms>(this->getState(), elapsed_ms,
+                                                                                                            elapsed_ms, 0U, 0U, 0U);
+    }
+
+    /**
+     * @brief Advance the click FSM from an already sampled level.
+     * @details Used by inputs that are not a plain digital read, such as
+     *          touch keys, so they share the same debounce and click rules.
+     */
+    template <uint8_t DetectionFlags, uint16_t LongClick_ms, uint16_t SuperLongClick_ms,
+              uint8_t Debounce_ms = constants::timings::CLICKABLE_DEBOUNCE_TIME_MS>
+    [[nodiscard]] auto clickDetection(bool rawPressed, uint16_t elapsed_ms) -> constants::ClickResult
+    {
+        return this->clickDetectionImpl<true, DetectionFlags, LongClick_ms, SuperLongClick_ms, Debounce_ms>(rawPressed, elapsed_ms,
+                                                                                                            elapsed_ms, 0U, 0U, 0U);
     }
+#endif  // CONFIG_COMPACT_CLICKABLES
 };
 
 #endif  // LSH_CORE_PERIPHERALS_INPUT_CLICKABLE_HPP
@@ -0,0 +1,209 @@
+/**
+ * @file    key_matrix.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Declares the row/column key matrix scanned one row per timer tick.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_PERIPHERALS_INPUT_KEY_MATRIX_HPP
+#define LSH_CORE_PERIPHERALS_INPUT_KEY_MATRIX_HPP
+
+#include <stdint.h>
+
+#include "internal/avr_fast_io.hpp"
+#include "internal/cpp_features.hpp"
+#include "internal/pin_tag.hpp"
+
+#if !defined(__AVR__)
+#error "Key matrices are scanned from the AVR Timer0 compare-B interrupt."
+#endif
+
+/**
+ * @brief Pin and timer helpers used by the generated `TIMER0_COMPB_vect` handler.
+ *
+ * @details Rows are open-drain: every row stays high impedance with its output
+ *          bit LOW, and the active row is selected by setting only its
+ *          direction bit. The handler therefore never writes a PORT register,
+ *          which the loop keeps writing for actuators sharing the same port.
+ *          Columns are inputs with pull-up, so a closed key pulls its column
+ *          LOW while its row is active. The handler reads the row selected on
+ *          the previous tick, which had a whole tick to settle, and then moves
+ *          the selection to the next row.
+ */
+namespace KeyMatrixIo
+{
+constexpr uint8_t COMPARE_POINT = 0x80U;  //!< OCR0B value, half a Timer0 period away from the millis() overflow.
+
+/**
+ * @brief Tell whether an Arduino pin is the OC0B output of the compare point that paces the scan.
+ */
+[[nodiscard]] constexpr auto isCompareOutputPin(uint8_t pin) noexcept -> bool
+{
+#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+    return pin == 4U;
+#elif defined(__AVR_ATmega168__) || defined(__AVR_ATmega328P__)
+    return pin == 5U;
+#else
+    return static_cast<void>(pin), false;
+#endif
+}
+
+/**
+ * @brief Configure one row as high impedance with its output bit LOW. Setup only.
+ */
+template <uint8_t Pin> void idleRow(lsh::core::PinTag<Pin> pin) noexcept
+{
+    const uint8_t mask = lsh::core::avr::readPinBitMask(pin);
+    *lsh::core::avr::modeRegisterForPin(pin) &= static_cast<uint8_t>(~mask);
+    *lsh::core::avr::outputRegisterForPin(pin) &= static_cast<uint8_t>(~mask);
+}
+
+/**
+ * @brief Leave one row high impedance.
+ */
+template <uint8_t Pin> void releaseRow(lsh::core::PinTag<Pin> pin) noexcept
+{
+    *lsh::core::avr::modeRegisterForPin(pin) &= static_cast<uint8_t>(~lsh::core::avr::readPinBitMask(pin));
+}
+
+/**
+ * @brief Pull one row LOW. The output bit is already LOW from `idleRow()`.
+ */
+template <uint8_t Pin> void driveRow(lsh::core::PinTag<Pin> pin) noexcept
+{
+    *lsh::core::avr::modeRegisterForPin(pin) |= lsh::core::avr::readPinBitMask(pin);
+}
+
+/**
+ * @brief Configure one column as input with pull-up.
+ */
+template <uint8_t Pin> void pullUpColumn(lsh::core::PinTag<Pin> pin) noexcept
+{
+    const uint8_t mask = lsh::core::avr::readPinBitMask(pin);
+    *lsh::core::avr::modeRegisterForPin(pin) &= static_cast<uint8_t>(~mask);
+    *lsh::core::avr::outputRegisterForPin(pin) |= mask;
+}
+
+/**
+ * @brief Return bit `column` when a closed key of the active row pulls the column LOW.
+ */
+template <uint8_t Pin> [[nodiscard]] auto columnBit(lsh::core::PinTag<Pin> pin, uint8_t column) noexcept -> uint8_t
+{
+    const bool closed = (*lsh::core::avr::inputRegisterForPin(pin) & lsh::core::avr::readPinBitMask(pin)) == 0U;
+    return closed ? static_cast<uint8_t>(1U << column) : 0U;
+}
+
+/**
+ * @brief Enable the Timer0 compare-B interrupt that paces the scan.
+ *
+ * @details Timer0 keeps running for `millis()`; only the otherwise unused
+ *          compare-B match is enabled, so one row is scanned every Timer0
+ *          overflow period (1.024 ms at 16 MHz). `analogWrite()` on the OC0B
+ *          pin would move the compare point and must not be used.
+ */
+inline void startTimer() noexcept
+{
+    OCR0B = COMPARE_POINT;
+    TIFR0 = static_cast<uint8_t>(1U << OCF0B);
+    TIMSK0 |= static_cast<uint8_t>(1U << OCIE0B);
+}
+}  // namespace KeyMatrixIo
+
+/**
+ * @brief Debounced key bitmap of one row/column matrix.
+ *
+ * @details The generated interrupt hands over one row of column bits per tick.
+ *          A key bit changes only when two consecutive samples of its row
+ *          agree, so the debounce window is one full matrix pass. Without
+ *          diodes, three closed keys on the corners of a rectangle make the
+ *          fourth corner read closed as well; a row that shares two or more
+ *          closed columns with another row is then ambiguous and keeps its
+ *          previous debounced bits until the ambiguity clears. The loop reads
+ *          single bytes, so no lock is needed between the ISR and the scan.
+ *
+ * @tparam Rows Number of driven rows.
+ * @tparam Diodes True when every key has its own diode, which rules out ghosting.
+ */
+template <uint8_t Rows, bool Diodes> class KeyMatrix
+{
+    static_assert(Rows > 0U && Rows <= 16U, "A key matrix needs 1..16 rows.");
+
+private:
+    uint8_t lastSample[Rows] = {};     //!< Raw column bits of each row from its previous tick.
+    volatile uint8_t keys[Rows] = {};  //!< Debounced closed-key bits, one byte per row.
+    uint8_t activeRow = 0U;            //!< Row driven LOW since the previous tick.
+
+    /**
+     * @brief Return true when a sample of one row may contain ghost keys.
+     */
+    [[nodiscard]] auto isAmbiguous(uint8_t row, uint8_t columns) const noexcept -> bool
+    {
+        if ((columns & static_cast<uint8_t>(columns - 1U)) == 0U)
+        {
+            return false;  // Fewer than two closed columns cannot span a rectangle.
+        }
+        for (uint8_t other = 0U; other < Rows; ++other)
+        {
+            const uint8_t shared = static_cast<uint8_t>(this->lastSample[other] & columns);
+            if (other != row && (shared & static_cast<uint8_t>(shared - 1U)) != 0U)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    KeyMatrix() noexcept = default;
+
+#if LSH_USING_CPP17
+    KeyMatrix(const KeyMatrix &) = delete;
+    KeyMatrix(KeyMatrix &&) = delete;
+    auto operator=(const KeyMatrix &) -> KeyMatrix & = delete;
+    auto operator=(KeyMatrix &&) -> KeyMatrix & = delete;
+#endif  // LSH_USING_CPP17
+
+    /**
+     * @brief Fold the column bits of the active row and advance to the next row.
+     *
+     * @param columns Bit `c` set when column `c` reads a closed key.
+     * @return uint8_t The row that was sampled, so the caller can release it.
+     */
+    auto sample(uint8_t columns) noexcept -> uint8_t
+    {
+        const uint8_t row = this->activeRow;
+        const uint8_t previous = this->lastSample[row];
+        this->lastSample[row] = columns;
+        if (Diodes || !this->isAmbiguous(row, columns))
+        {
+            const uint8_t stable = static_cast<uint8_t>(~(columns ^ previous));
+            this->keys[row] = static_cast<uint8_t>((this->keys[row] & static_cast<uint8_t>(~stable)) | (columns & stable));
+        }
+        this->activeRow = (row + 1U < Rows) ? static_cast<uint8_t>(row + 1U) : 0U;
+        return row;
+    }
+
+    /**
+     * @brief Return true while the key at `row`/`column` is closed after debounce.
+     */
+    template <uint8_t Row, uint8_t Column> [[nodiscard]] auto pressed() const noexcept -> bool
+    {
+        static_assert(Row < Rows && Column < 8U, "Key outside the matrix.");
+        return (this->keys[Row] & static_cast<uint8_t>(1U << Column)) != 0U;
+    }
+};
+
+#endif  // LSH_CORE_PERIPHERALS_INPUT_KEY_MATRIX_HPP
@@ -0,0 +1,146 @@
+/**
+ * @file    occupancy_input.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Defines the OccupancyInput class for PIR and presence sensors.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_PERIPHERALS_INPUT_OCCUPANCY_INPUT_HPP
+#define LSH_CORE_PERIPHERALS_INPUT_OCCUPANCY_INPUT_HPP
+
+#include <stdint.h>
+
+#include "internal/cpp_features.hpp"
+#include "internal/pin_tag.hpp"
+#include "internal/user_config_bridge.hpp"
+#ifdef CONFIG_USE_FAST_CLICKABLES
+#include "internal/avr_fast_io.hpp"
+#endif
+
+/**
+ * @brief A motion or presence sensor that holds local countdowns while active.
+ *
+ * @details The generated profile samples the sensor once per elapsed
+ * millisecond. A rising edge switches the target actuators ON, and every
+ * sample taken while the sensor is active restarts their auto-off countdown,
+ * so the light stays on for as long as the sensor holds its output, without
+ * any bridge round trip. The falling edge does nothing, so a manual OFF is
+ * not undone when the sensor releases. The object only keeps one flag byte;
+ * the countdown itself is the actuator auto-off timer. Network inputs also
+ * remember whether motion was seen since the last bridge summary.
+ */
+class OccupancyInput
+{
+private:
+    static constexpr uint8_t FLAG_LEVEL = 0x01U;     //!< Last sampled sensor level.
+    static constexpr uint8_t FLAG_MOTION = 0x02U;    //!< Edge or active level seen in the current summary window.
+    static constexpr uint8_t FLAG_REPORTED = 0x04U;  //!< Occupancy last delivered to the bridge.
+
+    uint8_t flags = 0U;  //!< Packed level and summary flags.
+
+    /**
+     * @brief Sample one compile-time pin with the clickable I/O policy.
+     */
+    template <uint8_t Pin> [[nodiscard]] static auto readPin(lsh::core::PinTag<Pin>) noexcept -> bool
+    {
+#ifdef CONFIG_USE_FAST_CLICKABLES
+        const uint8_t mask = lsh::core::avr::readPinBitMask(lsh::core::PinTag<Pin>{});
+        return (*lsh::core::avr::inputRegisterForPin(lsh::core::PinTag<Pin>{}) & mask) != 0U;
+#else
+        return static_cast<bool>(digitalRead(Pin));
+#endif
+    }
+
+public:
+    /**
+     * @brief Construct an occupancy input from a compile-time pin tag.
+     *
+     * Like buttons, the pin is a plain input that expects the sensor, or an
+     * external resistor, to drive both levels. A sensor already active at boot
+     * does not count as an edge.
+     */
+    template <uint8_t Pin> explicit OccupancyInput(lsh::core::PinTag<Pin> pin) noexcept
+    {
+        pinMode(Pin, INPUT);
+        this->flags = readPin(pin) ? FLAG_LEVEL : 0U;
+    }
+
+#if LSH_USING_CPP17
+    OccupancyInput(const OccupancyInput &) = delete;
+    OccupancyInput(OccupancyInput &&) = delete;
+    auto operator=(const OccupancyInput &) -> OccupancyInput & = delete;
+    auto operator=(OccupancyInput &&) -> OccupancyInput & = delete;
+#endif  // LSH_USING_CPP17
+
+    /**
+     * @brief Sample the sensor and report whether it just became active.
+     *
+     * @return true on a rising edge since the previous sample.
+     */
+    template <uint8_t Pin> [[nodiscard]] auto sampleRisingEdge(lsh::core::PinTag<Pin> pin) noexcept -> bool
+    {
+        const uint8_t level = readPin(pin) ? FLAG_LEVEL : 0U;
+        const bool edge = (this->flags & FLAG_LEVEL) != level;
+        this->flags = static_cast<uint8_t>((this->flags & static_cast<uint8_t>(~FLAG_LEVEL)) | level);
+        if (edge || level != 0U)
+        {
+            this->flags |= FLAG_MOTION;
+        }
+        return edge && level != 0U;
+    }
+
+    /**
+     * @brief Return the level taken by the last `sampleRisingEdge()` call.
+     */
+    [[nodiscard]] auto active() const noexcept -> bool
+    {
+        return (this->flags & FLAG_LEVEL) != 0U;
+    }
+
+    /**
+     * @brief Return true when the current summary window saw motion.
+     */
+    [[nodiscard]] auto occupied() const noexcept -> bool
+    {
+        return (this->flags & (FLAG_MOTION | FLAG_LEVEL)) != 0U;
+    }
+
+    /**
+     * @brief Return true when the bridge still holds a different occupancy.
+     */
+    [[nodiscard]] auto summaryChanged() const noexcept -> bool
+    {
+        return this->occupied() != ((this->flags & FLAG_REPORTED) != 0U);
+    }
+
+    /**
+     * @brief Start the next summary window.
+     *
+     * @param delivered true when the bridge now holds `occupied()`. When false
+     *                  the old view is kept, so the change is sent again later.
+     */
+    void closeSummaryWindow(bool delivered) noexcept
+    {
+        if (delivered)
+        {
+            this->flags = static_cast<uint8_t>((this->flags & static_cast<uint8_t>(~FLAG_REPORTED)) |
+                                               (this->occupied() ? FLAG_REPORTED : 0U));
+        }
+        this->flags &= static_cast<uint8_t>(~FLAG_MOTION);
+    }
+};
+
+#endif  // LSH_CORE_PERIPHERALS_INPUT_OCCUPANCY_INPUT_HPP
@@ -0,0 +1,582 @@
+/**
+ * @file    one_wire_bus.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Defines the non-blocking 1-Wire bus driver for DS18B20-class sensors.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_PERIPHERALS_INPUT_ONE_WIRE_BUS_HPP
+#define LSH_CORE_PERIPHERALS_INPUT_ONE_WIRE_BUS_HPP
+
+#include <stdint.h>
+
+#include "internal/cpp_features.hpp"
+#include "internal/pin_tag.hpp"
+#include "util/constants/timing.hpp"
+#include "util/saturating_time.hpp"
+#if defined(__AVR__)
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+#include "internal/avr_fast_io.hpp"
+
+#if !defined(TIMSK5)
+#error "1-Wire bit slots are timed by the Timer5 compare-A interrupt of the ATmega1280/2560."
+#endif
+#endif
+
+/**
+ * @brief Timer5 helpers used by the generated `TIMER5_COMPA_vect` handler.
+ *
+ * @details Timer0 keeps `millis()` and Timer1/Timer2 are taken by Servo and
+ *          tone() on the Mega. Timer5 is switched to a free-running /8 count,
+ *          half a microsecond per tick at 16 MHz, while a bus transfer runs;
+ *          `analogWrite()` on pins 44..46 and the Servo library cannot be used
+ *          next to 1-Wire sensors.
+ *          Hosts without the AVR registers, such as the bit-level sensor model
+ *          of the tests, define these five functions instead.
+ */
+namespace OneWireTimer
+{
+#if defined(__AVR__)
+constexpr uint8_t TICKS_PER_US = static_cast<uint8_t>(F_CPU / 8000000UL);  //!< Timer5 ticks per microsecond with the /8 prescaler.
+static_assert(TICKS_PER_US > 0U, "1-Wire slot timing needs F_CPU of at least 8 MHz.");
+
+/**
+ * @brief Return the free-running slot clock.
+ */
+[[nodiscard]] inline auto now() noexcept -> uint16_t
+{
+    return TCNT5;
+}
+
+/**
+ * @brief Run the slot handler `delay_us` from now.
+ */
+inline void schedule(uint16_t delay_us) noexcept
+{
+    OCR5A = static_cast<uint16_t>(TCNT5 + (delay_us * TICKS_PER_US));
+    TIFR5 = static_cast<uint8_t>(1U << OCF5A);
+}
+
+/**
+ * @brief Take Timer5 over and run the first slot handler `delay_us` from now.
+ *
+ * @details The Arduino core leaves Timer5 in 8-bit PWM mode, so the mode is
+ *          set again before every transfer instead of once at construction.
+ */
+inline void start(uint16_t delay_us) noexcept
+{
+    const uint8_t oldSREG = SREG;
+    cli();
+    TCCR5A = 0U;
+    TCCR5B = static_cast<uint8_t>(1U << CS51);
+    schedule(delay_us);
+    TIMSK5 |= static_cast<uint8_t>(1U << OCIE5A);
+    SREG = oldSREG;
+}
+
+/**
+ * @brief Stop the slot handler; called from it after the last slot.
+ */
+inline void stop() noexcept
+{
+    TIMSK5 &= static_cast<uint8_t>(~(1U << OCIE5A));
+}
+
+/**
+ * @brief Tell whether a transfer of any bus still owns the timer.
+ */
+[[nodiscard]] inline auto busy() noexcept -> bool
+{
+    return (TIMSK5 & static_cast<uint8_t>(1U << OCIE5A)) != 0U;
+}
+#else
+constexpr uint8_t TICKS_PER_US = 1U;  //!< The host hooks count microseconds.
+
+// Provided by the host build: a microsecond slot clock and the handler scheduling.
+[[nodiscard]] auto now() noexcept -> uint16_t;
+void schedule(uint16_t delay_us) noexcept;
+void start(uint16_t delay_us) noexcept;
+void stop() noexcept;
+[[nodiscard]] auto busy() noexcept -> bool;
+#endif
+}  // namespace OneWireTimer
+
+/**
+ * @brief One 1-Wire bus of DS18B20-class sensors driven from the slot timer.
+ *
+ * @details Blocking drivers keep interrupts off for whole bytes and sleep
+ *          through the 750 ms conversion. Here the loop only schedules: each
+ *          `step()` either starts one transfer, collects a finished one or
+ *          counts the conversion and sample interval down in milliseconds.
+ *          A transfer, one reset with its presence answer followed by the
+ *          command and scratchpad bits, then runs entirely from
+ *          `onTimer()`, called by the generated Timer5 compare-A handler.
+ *          Every call does one short part of a slot and schedules the next:
+ *          the 480 us reset low phase, the 60 us low phase of a written `0`
+ *          and every recovery time pass with interrupts enabled. The longest
+ *          handler is a read slot, about 13 us from the falling edge to the
+ *          sample, so at 500 kBd a UART with its two-byte receive buffer
+ *          cannot overrun. The longest handler of a cycle is kept and
+ *          reported with the readings.
+ *
+ *          One cycle broadcasts CONVERT T to the whole bus, waits the
+ *          conversion time, then reads each sensor's scratchpad with MATCH ROM,
+ *          or SKIP ROM for a lone sensor without ROM code. Readings whose CRC
+ *          or configuration byte do not check out are not marked fresh.
+ *          Several buses share the timer, one transfer at a time. Sensors need
+ *          their own supply; parasite power is not driven.
+ */
+class OneWireBus
+{
+public:
+    static constexpr uint8_t MAX_SENSORS = 8U;  //!< Sensors per bus, bounded by the fresh-reading mask.
+
+private:
+    static constexpr uint8_t PHASE_IDLE = 0U;
+    static constexpr uint8_t PHASE_PENDING = 1U;  //!< Transfer due, waiting for the slot timer.
+    static constexpr uint8_t PHASE_TRANSFER = 2U;
+    static constexpr uint8_t PHASE_CONVERTING = 3U;
+
+    static constexpr uint8_t SLOT_IDLE = 0U;          //!< No transfer of this bus in flight.
+    static constexpr uint8_t SLOT_RESET_LOW = 1U;
+    static constexpr uint8_t SLOT_RESET_RELEASE = 2U;
+    static constexpr uint8_t SLOT_PRESENCE = 3U;
+    static constexpr uint8_t SLOT_BIT = 4U;
+    static constexpr uint8_t SLOT_ZERO_RELEASE = 5U;  //!< End of the low phase of a written `0`.
+
+    static constexpr uint8_t CONVERT_ALL = 0xFFU;  //!< `sensorIndex` while the CONVERT T broadcast runs.
+    static constexpr uint8_t SCRATCHPAD_BYTES = 9U;
+    static constexpr uint8_t ROM_BYTES = 8U;
+    static constexpr uint8_t COMMAND_BYTES = ROM_BYTES + 2U;
+
+    static constexpr uint8_t CMD_SKIP_ROM = 0xCCU;
+    static constexpr uint8_t CMD_MATCH_ROM = 0x55U;
+    static constexpr uint8_t CMD_CONVERT_T = 0x44U;
+    static constexpr uint8_t CMD_READ_SCRATCHPAD = 0xBEU;
+
+    static constexpr uint16_t START_DELAY_US = 16U;
+    static constexpr uint16_t RESET_LOW_US = 480U;
+    static constexpr uint16_t PRESENCE_SAMPLE_US = 70U;
+    static constexpr uint16_t PRESENCE_RECOVERY_US = 410U;
+    static constexpr uint8_t WRITE_ONE_LOW_US = 6U;
+    static constexpr uint16_t WRITE_ZERO_LOW_US = 60U;
+    static constexpr uint8_t READ_LOW_US = 3U;
+    static constexpr uint8_t READ_SAMPLE_US = 10U;
+    static constexpr uint16_t SLOT_RECOVERY_US = 10U;
+    static constexpr uint16_t SLOT_US = 70U;  //!< Time slot plus recovery, from one falling edge to the next.
+
+    const uint8_t *const sensorIds;          //!< Flash table of public sensor IDs.
+    const uint8_t *const sensorRoms;         //!< Flash table of 8-byte ROM codes, `nullptr` for a lone SKIP ROM sensor.
+    int16_t *const readings;                 //!< Last good raw reading per sensor, in 1/16 degree Celsius.
+    uint16_t phaseAge_ms = 0U;               //!< Saturated age of the idle or converting phase.
+    volatile uint16_t worstSlot_us = 0U;     //!< Longest slot handler of the current cycle.
+    uint8_t command[COMMAND_BYTES] = {};
+    volatile uint8_t scratchpad[SCRATCHPAD_BYTES] = {};
+    const uint8_t sensorCount;
+    uint8_t freshMask = 0U;                  //!< Sensors read successfully in the current cycle.
+    uint8_t phase = PHASE_IDLE;
+    uint8_t sensorIndex = CONVERT_ALL;
+    uint8_t writeBits = 0U;                  //!< Command bits of the current transfer.
+    uint8_t totalBits = 0U;                  //!< Command plus scratchpad bits of the current transfer.
+    volatile uint8_t slotPhase = SLOT_IDLE;  //!< Written by the loop only while `SLOT_IDLE`, then by `onTimer()`.
+    volatile uint8_t bitIndex = 0U;          //!< Next bit of the current transfer, writes first.
+    volatile bool present = false;           //!< True when the last reset got a presence answer.
+
+    [[nodiscard]] static auto readFlashByte(const uint8_t *address) noexcept -> uint8_t
+    {
+#if defined(__AVR__)
+        return pgm_read_byte(address);
+#else
+        return *address;
+#endif
+    }
+
+    /**
+     * @brief Pull the line low; the output bit is already LOW from construction.
+     *
+     * @details Only the slot handler writes the mode bit after construction,
+     *          and AVR handlers do not nest, so no other code can interleave.
+     */
+    template <uint8_t Pin> static void driveLow(lsh::core::PinTag<Pin> pin) noexcept
+    {
+#if defined(__AVR__)
+        *lsh::core::avr::modeRegisterForPin(pin) |= lsh::core::avr::readPinBitMask(pin);
+#else
+        static_cast<void>(pin);
+        pinMode(Pin, OUTPUT);
+#endif
+    }
+
+    /**
+     * @brief Let the pull-up raise the line.
+     */
+    template <uint8_t Pin> static void release(lsh::core::PinTag<Pin> pin) noexcept
+    {
+#if defined(__AVR__)
+        *lsh::core::avr::modeRegisterForPin(pin) &= static_cast<uint8_t>(~lsh::core::avr::readPinBitMask(pin));
+#else
+        static_cast<void>(pin);
+        pinMode(Pin, INPUT);
+#endif
+    }
+
+    template <uint8_t Pin> [[nodiscard]] static auto readLine(lsh::core::PinTag<Pin> pin) noexcept -> bool
+    {
+#if defined(__AVR__)
+        return (*lsh::core::avr::inputRegisterForPin(pin) & lsh::core::avr::readPinBitMask(pin)) != 0U;
+#else
+        static_cast<void>(pin);
+        return static_cast<bool>(digitalRead(Pin));
+#endif
+    }
+
+    /**
+     * @brief Return one command byte of the current transfer.
+     */
+    [[nodiscard]] auto commandByte(uint8_t byteIndex) const noexcept -> uint8_t
+    {
+        if (this->sensorIndex == CONVERT_ALL)
+        {
+            return byteIndex == 0U ? CMD_SKIP_ROM : CMD_CONVERT_T;
+        }
+        if (this->sensorRoms == nullptr)
+        {
+            return byteIndex == 0U ? CMD_SKIP_ROM : CMD_READ_SCRATCHPAD;
+        }
+        if (byteIndex == 0U)
+        {
+            return CMD_MATCH_ROM;
+        }
+        if (byteIndex > ROM_BYTES)
+        {
+            return CMD_READ_SCRATCHPAD;
+        }
+        return readFlashByte(this->sensorRoms + (static_cast<uint16_t>(this->sensorIndex) * ROM_BYTES) + byteIndex - 1U);
+    }
+
+    /**
+     * @brief Copy the command of the current transfer and hand it to the slot timer.
+     *
+     * @details Buses share the timer, so a bus whose turn has come waits in
+     *          `PHASE_PENDING` while another bus transfers.
+     */
+    void startTransfer() noexcept
+    {
+        if (OneWireTimer::busy())
+        {
+            return;
+        }
+        const bool broadcast = this->sensorIndex == CONVERT_ALL;
+        const uint8_t commandLength = (broadcast || this->sensorRoms == nullptr) ? 2U : COMMAND_BYTES;
+        for (uint8_t byteIndex = 0U; byteIndex < commandLength; ++byteIndex)
+        {
+            this->command[byteIndex] = this->commandByte(byteIndex);
+        }
+        this->writeBits = static_cast<uint8_t>(commandLength * 8U);
+        this->totalBits = broadcast ? this->writeBits : static_cast<uint8_t>(this->writeBits + (SCRATCHPAD_BYTES * 8U));
+        this->bitIndex = 0U;
+        this->present = false;
+        this->slotPhase = SLOT_RESET_LOW;
+        this->phase = PHASE_TRANSFER;
+        OneWireTimer::start(START_DELAY_US);
+    }
+
+    /**
+     * @brief Start the next time slot, or close the transfer after the last bit.
+     */
+    template <uint8_t Pin> void runBitSlot(lsh::core::PinTag<Pin> pin) noexcept
+    {
+        const uint8_t bit = this->bitIndex;
+        if (bit >= this->totalBits)
+        {
+            OneWireTimer::stop();
+            this->slotPhase = SLOT_IDLE;
+            return;
+        }
+        this->bitIndex = static_cast<uint8_t>(bit + 1U);
+        if (bit < this->writeBits)
+        {
+            driveLow(pin);
+            if (((this->command[bit >> 3U] >> (bit & 0x07U)) & 0x01U) == 0U)
+            {
+                this->slotPhase = SLOT_ZERO_RELEASE;
+                OneWireTimer::schedule(WRITE_ZERO_LOW_US);
+                return;
+            }
+            delayMicroseconds(WRITE_ONE_LOW_US);
+            release(pin);
+            OneWireTimer::schedule(SLOT_US - WRITE_ONE_LOW_US);
+            return;
+        }
+
+        driveLow(pin);
+        delayMicroseconds(READ_LOW_US);
+        release(pin);
+        delayMicroseconds(READ_SAMPLE_US);
+        const bool high = readLine(pin);
+        OneWireTimer::schedule(SLOT_US - READ_LOW_US - READ_SAMPLE_US);
+
+        const uint8_t readBit = static_cast<uint8_t>(bit - this->writeBits);
+        const uint8_t byteIndex = static_cast<uint8_t>(readBit >> 3U);
+        uint8_t value = ((readBit & 0x07U) == 0U) ? 0U : this->scratchpad[byteIndex];
+        if (high)
+        {
+            value |= static_cast<uint8_t>(1U << (readBit & 0x07U));
+        }
+        this->scratchpad[byteIndex] = value;
+    }
+
+    /**
+     * @brief Check the Dallas CRC-8 and the DS18B20 configuration byte.
+     */
+    [[nodiscard]] auto scratchpadValid() const noexcept -> bool
+    {
+        uint8_t crc = 0U;
+        for (uint8_t byteIndex = 0U; byteIndex < SCRATCHPAD_BYTES; ++byteIndex)
+        {
+            uint8_t value = this->scratchpad[byteIndex];
+            for (uint8_t bit = 0U; bit < 8U; ++bit)
+            {
+                const bool mix = ((crc ^ value) & 0x01U) != 0U;
+                crc = static_cast<uint8_t>(crc >> 1U);
+                if (mix)
+                {
+                    crc ^= 0x8CU;
+                }
+                value = static_cast<uint8_t>(value >> 1U);
+            }
+        }
+        // A shorted line reads all zeros, which also passes the CRC.
+        return crc == 0U && (this->scratchpad[4] & 0x9FU) == 0x1FU;
+    }
+
+    /**
+     * @brief Move to the next sensor, or close the cycle after the last one.
+     *
+     * @return true when the cycle is complete.
+     */
+    [[nodiscard]] auto nextSensor() noexcept -> bool
+    {
+        ++this->sensorIndex;
+        if (this->sensorIndex < this->sensorCount)
+        {
+            this->phase = PHASE_PENDING;
+            return false;
+        }
+        this->phase = PHASE_IDLE;
+        this->phaseAge_ms = 0U;
+        return true;
+    }
+
+    /**
+     * @brief Evaluate a finished transfer: a missing broadcast ends the cycle.
+     *
+     * @return true when the cycle is complete.
+     */
+    [[nodiscard]] auto finishTransfer() noexcept -> bool
+    {
+        const bool broadcast = this->sensorIndex == CONVERT_ALL;
+        if (!this->present)
+        {
+            if (broadcast)
+            {
+                this->sensorIndex = this->sensorCount;
+            }
+            return this->nextSensor();
+        }
+        if (broadcast)
+        {
+            this->phase = PHASE_CONVERTING;
+            this->phaseAge_ms = 0U;
+            return false;
+        }
+        if (this->scratchpadValid())
+        {
+            this->readings[this->sensorIndex] =
+                static_cast<int16_t>(static_cast<uint16_t>(this->scratchpad[0]) | (static_cast<uint16_t>(this->scratchpad[1]) << 8U));
+            this->freshMask |= static_cast<uint8_t>(1U << this->sensorIndex);
+        }
+        return this->nextSensor();
+    }
+
+public:
+    /**
+     * @brief Construct a bus from a compile-time pin tag and its generated tables.
+     *
+     * @param pin bus pin; an external pull-up is expected.
+     * @param count sensors on the bus, `1..MAX_SENSORS`.
+     * @param ids flash table of `count` public sensor IDs.
+     * @param roms flash table of `count` 8-byte ROM codes, or `nullptr` for one sensor.
+     * @param readingStorage `count` raw readings owned by the generated profile.
+     */
+    template <uint8_t Pin>
+    OneWireBus(lsh::core::PinTag<Pin> pin, uint8_t count, const uint8_t *ids, const uint8_t *roms, int16_t *readingStorage) noexcept
+        : sensorIds(ids), sensorRoms(roms), readings(readingStorage), sensorCount(count)
+    {
+        // Generated buses are static objects, built before the core enables
+        // interrupts, so the shared port register can be written directly.
+#if defined(__AVR__)
+        *lsh::core::avr::outputRegisterForPin(pin) &= static_cast<uint8_t>(~lsh::core::avr::readPinBitMask(pin));
+#else
+        digitalWrite(Pin, LOW);
+#endif
+        release(pin);
+        // Start the first cycle on the first loop pass instead of one interval after boot.
+        this->phaseAge_ms = UINT16_MAX;
+    }
+
+#if LSH_USING_CPP17
+    OneWireBus(const OneWireBus &) = delete;
+    OneWireBus(OneWireBus &&) = delete;
+    auto operator=(const OneWireBus &) -> OneWireBus & = delete;
+    auto operator=(OneWireBus &&) -> OneWireBus & = delete;
+#endif  // LSH_USING_CPP17
+
+    /**
+     * @brief Advance the bus schedule from the loop.
+     *
+     * @param elapsed_ms milliseconds since the previous call.
+     * @return true once per cycle, when every sensor has been read or skipped.
+     */
+    [[nodiscard]] auto step(uint16_t elapsed_ms) noexcept -> bool
+    {
+        using constants::timings::ONE_WIRE_CONVERSION_TIME_MS;
+        using constants::timings::TEMPERATURE_SAMPLE_INTERVAL_MS;
+
+        if (this->phase == PHASE_TRANSFER)
+        {
+            return this->slotPhase == SLOT_IDLE && this->finishTransfer();
+        }
+        if (this->phase == PHASE_IDLE || this->phase == PHASE_CONVERTING)
+        {
+            this->phaseAge_ms = timeUtils::addElapsedTimeSaturated(this->phaseAge_ms, elapsed_ms);
+            if (this->phase == PHASE_IDLE && this->phaseAge_ms >= TEMPERATURE_SAMPLE_INTERVAL_MS)
+            {
+                this->freshMask = 0U;
+                this->worstSlot_us = 0U;
+                this->sensorIndex = CONVERT_ALL;
+                this->phase = PHASE_PENDING;
+            }
+            else if (this->phase == PHASE_CONVERTING && this->phaseAge_ms >= ONE_WIRE_CONVERSION_TIME_MS)
+            {
+                this->sensorIndex = 0U;
+                this->phase = PHASE_PENDING;
+            }
+        }
+        if (this->phase == PHASE_PENDING)
+        {
+            this->startTransfer();
+        }
+        return false;
+    }
+
+    /**
+     * @brief Run one part of a slot; called from the slot timer handler.
+     *
+     * @param pin bus pin, the same used at construction.
+     */
+    template <uint8_t Pin> void onTimer(lsh::core::PinTag<Pin> pin) noexcept
+    {
+        const uint8_t slot = this->slotPhase;
+        if (slot == SLOT_IDLE)
+        {
+            return;
+        }
+        const uint16_t entry = OneWireTimer::now();
+        switch (slot)
+        {
+        case SLOT_RESET_LOW:
+            driveLow(pin);
+            this->slotPhase = SLOT_RESET_RELEASE;
+            OneWireTimer::schedule(RESET_LOW_US);
+            break;
+        case SLOT_RESET_RELEASE:
+            release(pin);
+            this->slotPhase = SLOT_PRESENCE;
+            OneWireTimer::schedule(PRESENCE_SAMPLE_US);
+            break;
+        case SLOT_PRESENCE:
+            this->present = !readLine(pin);
+            if (!this->present)
+            {
+                OneWireTimer::stop();
+                this->slotPhase = SLOT_IDLE;
+                break;
+            }
+            this->slotPhase = SLOT_BIT;
+            OneWireTimer::schedule(PRESENCE_RECOVERY_US);
+            break;
+        case SLOT_ZERO_RELEASE:
+            release(pin);
+            this->slotPhase = SLOT_BIT;
+            OneWireTimer::schedule(SLOT_RECOVERY_US);
+            break;
+        default:
+            this->runBitSlot(pin);
+            break;
+        }
+        const uint16_t handler_us = static_cast<uint16_t>(OneWireTimer::now() - entry) / OneWireTimer::TICKS_PER_US;
+        if (handler_us > this->worstSlot_us)
+        {
+            this->worstSlot_us = handler_us;
+        }
+    }
+
+    [[nodiscard]] auto count() const noexcept -> uint8_t
+    {
+        return this->sensorCount;
+    }
+
+    [[nodiscard]] auto sensorId(uint8_t index) const noexcept -> uint8_t
+    {
+        return readFlashByte(this->sensorIds + index);
+    }
+
+    [[nodiscard]] auto isFresh(uint8_t index) const noexcept -> bool
+    {
+        return (this->freshMask & static_cast<uint8_t>(1U << index)) != 0U;
+    }
+
+    [[nodiscard]] auto freshCount() const noexcept -> uint8_t
+    {
+        uint8_t fresh = 0U;
+        for (uint8_t mask = this->freshMask; mask != 0U; mask = static_cast<uint8_t>(mask & (mask - 1U)))
+        {
+            ++fresh;
+        }
+        return fresh;
+    }
+
+    [[nodiscard]] auto reading(uint8_t index) const noexcept -> int16_t
+    {
+        return this->readings[index];
+    }
+
+    /**
+     * @brief Return the longest slot handler of the last cycle in microseconds.
+     *
+     * @details Interrupts are off for that long at most, which is the whole
+     *          cost of the bus on input and UART latency.
+     */
+    [[nodiscard]] auto worstSlot() const noexcept -> uint16_t
+    {
+        return this->worstSlot_us;
+    }
+};
+
+#endif  // LSH_CORE_PERIPHERALS_INPUT_ONE_WIRE_BUS_HPP
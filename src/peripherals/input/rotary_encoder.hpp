@@ -0,0 +1,185 @@
+/**
+ * @file    rotary_encoder.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Defines the RotaryEncoder class, decoded inside pin interrupts.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_PERIPHERALS_INPUT_ROTARY_ENCODER_HPP
+#define LSH_CORE_PERIPHERALS_INPUT_ROTARY_ENCODER_HPP
+
+#include <stdint.h>
+
+#include "internal/cpp_features.hpp"
+#include "internal/hot_loop_state.hpp"
+#include "internal/pin_tag.hpp"
+#include "internal/user_config_bridge.hpp"
+#ifdef CONFIG_USE_FAST_CLICKABLES
+#include "internal/avr_fast_io.hpp"
+#endif
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#endif
+
+/**
+ * @brief A quadrature rotary encoder whose transitions are counted inside ISRs.
+ *
+ * @details The generated profile attaches one `CHANGE` interrupt to each
+ * encoder pin and calls `onPinChange()` from both. The ISR only advances a
+ * signed transition counter; the main loop later converts whole detents with
+ * `takeDetents()`, so a fast spin costs one drain per loop pass instead of one
+ * action per detent. Pins are template arguments, so no pin data lives in SRAM.
+ */
+class RotaryEncoder
+{
+private:
+    volatile int8_t pendingTransitions = 0;  //!< ISR-owned signed transition count, saturating at +/-127.
+    uint8_t lastPhase = 0U;                  //!< ISR-owned previous AB phase, A in bit 1 and B in bit 0.
+    int8_t residualTransitions = 0;          //!< Loop-owned transitions that do not form a whole detent yet.
+#if LSH_STATIC_CONFIG_NETWORK_ENCODERS > 0
+    int8_t pendingNetworkSteps = 0;  //!< Detents not yet reported to the bridge, saturating at +/-127.
+#endif
+
+    /**
+     * @brief Sample one compile-time pin with the clickable I/O policy.
+     */
+    template <uint8_t Pin> [[nodiscard]] static auto readPin(lsh::core::PinTag<Pin>) noexcept -> bool
+    {
+#ifdef CONFIG_USE_FAST_CLICKABLES
+        const uint8_t mask = lsh::core::avr::readPinBitMask(lsh::core::PinTag<Pin>{});
+        return (*lsh::core::avr::inputRegisterForPin(lsh::core::PinTag<Pin>{}) & mask) != 0U;
+#else
+        return static_cast<bool>(digitalRead(Pin));
+#endif
+    }
+
+    template <uint8_t PinA, uint8_t PinB> [[nodiscard]] static auto readPhase() noexcept -> uint8_t
+    {
+        return static_cast<uint8_t>((readPin(lsh::core::PinTag<PinA>{}) ? 0x02U : 0x00U) |
+                                    (readPin(lsh::core::PinTag<PinB>{}) ? 0x01U : 0x00U));
+    }
+
+    /**
+     * @brief Map one phase transition to its signed step.
+     *
+     * @param transition previous phase in bits 3..2, current phase in bits 1..0.
+     * @return int8_t `+1` when A leads B, `-1` when B leads A, `0` for bounces
+     *         and for the impossible double-bit jumps.
+     */
+    [[nodiscard]] static auto transitionStep(uint8_t transition) noexcept -> int8_t
+    {
+#if defined(__AVR__)
+        static const int8_t TRANSITIONS[16] LSH_HOT_PROGMEM = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+        return static_cast<int8_t>(pgm_read_byte(&TRANSITIONS[transition]));
+#else
+        static const int8_t TRANSITIONS[16] = {0, -1, 1, 0, 1, 0, 0, -1, -1, 0, 0, 1, 0, 1, -1, 0};
+        return TRANSITIONS[transition];
+#endif
+    }
+
+    [[nodiscard]] static auto saturatingAdd(int8_t value, int8_t delta) noexcept -> int8_t
+    {
+        const int16_t sum = static_cast<int16_t>(value) + delta;
+        if (sum > INT8_MAX)
+        {
+            return INT8_MAX;
+        }
+        if (sum < -INT8_MAX)
+        {
+            return -INT8_MAX;
+        }
+        return static_cast<int8_t>(sum);
+    }
+
+public:
+    /**
+     * @brief Construct a rotary encoder from two compile-time pin tags.
+     *
+     * Both pins are plain inputs; like buttons, they expect external resistors.
+     * The decoder is polarity-agnostic, so common-to-ground and common-to-VDD
+     * wiring count the same direction.
+     */
+    template <uint8_t PinA, uint8_t PinB> explicit RotaryEncoder(lsh::core::PinTag<PinA>, lsh::core::PinTag<PinB>) noexcept
+    {
+        pinMode(PinA, INPUT);
+        pinMode(PinB, INPUT);
+        this->lastPhase = readPhase<PinA, PinB>();
+    }
+
+#if LSH_USING_CPP17
+    RotaryEncoder(const RotaryEncoder &) = delete;
+    RotaryEncoder(RotaryEncoder &&) = delete;
+    auto operator=(const RotaryEncoder &) -> RotaryEncoder & = delete;
+    auto operator=(RotaryEncoder &&) -> RotaryEncoder & = delete;
+#endif  // LSH_USING_CPP17
+
+    /**
+     * @brief Advance the quadrature state machine; call only from the pin ISRs.
+     */
+    template <uint8_t PinA, uint8_t PinB> void onPinChange(lsh::core::PinTag<PinA>, lsh::core::PinTag<PinB>) noexcept
+    {
+        const uint8_t phase = readPhase<PinA, PinB>();
+        const int8_t step = transitionStep(static_cast<uint8_t>((this->lastPhase << 2U) | phase));
+        this->lastPhase = phase;
+        if (step != 0)
+        {
+            this->pendingTransitions = saturatingAdd(this->pendingTransitions, step);
+        }
+    }
+
+    /**
+     * @brief Drain the ISR counter and return the whole detents turned since the last call.
+     *
+     * @details Transitions that do not complete a detent are kept for the next
+     *          call, so slow turns never lose steps. The counter is swapped with
+     *          interrupts disabled for two instructions only.
+     *
+     * @tparam TransitionsPerDetent quadrature transitions per mechanical detent.
+     * @return int8_t signed detents, positive when A leads B.
+     */
+    template <uint8_t TransitionsPerDetent> [[nodiscard]] auto takeDetents() noexcept -> int8_t
+    {
+        static_assert(TransitionsPerDetent > 0U, "TransitionsPerDetent must be positive.");
+        noInterrupts();
+        const int8_t transitions = this->pendingTransitions;
+        this->pendingTransitions = 0;
+        interrupts();
+
+        const int16_t total = static_cast<int16_t>(this->residualTransitions) + transitions;
+        const int16_t detents = total / static_cast<int16_t>(TransitionsPerDetent);
+        this->residualTransitions = static_cast<int8_t>(total - (detents * static_cast<int16_t>(TransitionsPerDetent)));
+        return static_cast<int8_t>(detents);
+    }
+
+#if LSH_STATIC_CONFIG_NETWORK_ENCODERS > 0
+    void addNetworkSteps(int8_t detents) noexcept
+    {
+        this->pendingNetworkSteps = saturatingAdd(this->pendingNetworkSteps, detents);
+    }
+
+    [[nodiscard]] auto networkSteps() const noexcept -> int8_t
+    {
+        return this->pendingNetworkSteps;
+    }
+
+    void clearNetworkSteps() noexcept
+    {
+        this->pendingNetworkSteps = 0;
+    }
+#endif
+};
+
+#endif  // LSH_CORE_PERIPHERALS_INPUT_ROTARY_ENCODER_HPP
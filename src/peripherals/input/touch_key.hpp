@@ -0,0 +1,222 @@
+/**
+ * @file    touch_key.hpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Declares capacitive touch keys sampled by charge sharing through the ADC.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LSH_CORE_PERIPHERALS_INPUT_TOUCH_KEY_HPP
+#define LSH_CORE_PERIPHERALS_INPUT_TOUCH_KEY_HPP
+
+#include <stdint.h>
+
+#include "internal/avr_fast_io.hpp"
+#include "internal/cpp_features.hpp"
+#include "internal/pin_tag.hpp"
+#include "internal/user_config_bridge.hpp"
+#include "util/constants/timing.hpp"
+
+#if !defined(__AVR__)
+#error "Touch buttons sample through the AVR ADC conversion-complete interrupt."
+#endif
+
+/**
+ * @brief Charge-sharing steps chained from `ADC_vect`.
+ *
+ * @details One key costs two conversions. `precharge()` drives the electrode
+ *          HIGH and converts the 0 V channel, which empties the ADC
+ *          sample-and-hold capacitor. `shareCharge()` releases the electrode
+ *          and converts its channel: the electrode charge spreads over both
+ *          capacitors, so a finger, which adds capacitance to the electrode,
+ *          raises the reading. The generated `ADC_vect` handler calls these
+ *          in turn for every touch key and `finishSweep()` after the last
+ *          one, so the loop only starts a sweep and reads the samples.
+ *
+ *          The profile owns the ADC. The handler ignores conversions while
+ *          no sweep runs, so a stray interrupt cannot move the step counter
+ *          away from `SWEEP_IDLE`. It cannot tell a foreign conversion from
+ *          its own mid-sweep, so `analogRead()` and other ADC users are
+ *          unsupported with touch buttons.
+ */
+namespace TouchSense
+{
+constexpr uint8_t SWEEP_IDLE = UINT8_MAX;  //!< Sweep step before the first sweep was started.
+#ifdef MUX4
+constexpr uint8_t GROUND_MUX = 0x1FU;  //!< 0 V input on 5-bit multiplexers (ATmega1280/2560).
+#else
+constexpr uint8_t GROUND_MUX = 0x0FU;  //!< 0 V input on 4-bit multiplexers (ATmega328P).
+#endif
+constexpr uint8_t ADC_IDLE = static_cast<uint8_t>((1U << ADEN) | (1U << ADIF) | (1U << ADPS2) | (1U << ADPS1) | (1U << ADPS0));
+constexpr uint8_t ADC_START = static_cast<uint8_t>(ADC_IDLE | (1U << ADSC) | (1U << ADIE));  //!< Start, clear a stale flag, interrupt.
+
+/**
+ * @brief Return the ADC channel of one analog pin.
+ * @details Channels follow `A0` in order, as on the ATmega328P and ATmega2560.
+ */
+template <uint8_t Pin> [[nodiscard]] constexpr auto channelFor(lsh::core::PinTag<Pin>) noexcept -> uint8_t
+{
+    static_assert(Pin >= A0 && Pin < A0 + NUM_ANALOG_INPUTS, "Touch buttons need an analog input pin.");
+    return static_cast<uint8_t>(Pin - A0);
+}
+
+/**
+ * @brief Select one multiplexer input with AVcc as reference.
+ */
+inline void selectInput(uint8_t mux) noexcept
+{
+#ifdef MUX5
+    ADCSRB = static_cast<uint8_t>((ADCSRB & static_cast<uint8_t>(~(1U << MUX5))) | ((mux & 0x20U) != 0U ? (1U << MUX5) : 0U));
+#endif
+    ADMUX = static_cast<uint8_t>((1U << REFS0) | (mux & 0x1FU));
+}
+
+/**
+ * @brief Drive the electrode HIGH and start the conversion that empties the S/H capacitor.
+ */
+template <uint8_t Pin> void precharge(lsh::core::PinTag<Pin> pin) noexcept
+{
+    const uint8_t mask = lsh::core::avr::readPinBitMask(pin);
+    *lsh::core::avr::outputRegisterForPin(pin) |= mask;
+    *lsh::core::avr::modeRegisterForPin(pin) |= mask;
+    selectInput(GROUND_MUX);
+    ADCSRA = ADC_START;
+}
+
+/**
+ * @brief Release the electrode onto the S/H capacitor and start its measurement.
+ *
+ * @details The direction bit is cleared first: clearing the output bit first
+ *          would ground the electrode for one cycle, while the other order
+ *          only enables the pull-up for one cycle.
+ */
+template <uint8_t Pin> void shareCharge(lsh::core::PinTag<Pin> pin) noexcept
+{
+    const uint8_t mask = lsh::core::avr::readPinBitMask(pin);
+    *lsh::core::avr::modeRegisterForPin(pin) &= static_cast<uint8_t>(~mask);
+    *lsh::core::avr::outputRegisterForPin(pin) &= static_cast<uint8_t>(~mask);
+    // Channels 8..15 sit at 0x20 + n on the 6-bit multiplexer of the ATmega2560.
+    const uint8_t channel = channelFor(pin);
+    selectInput(channel < 8U ? channel : static_cast<uint8_t>(0x20U | (channel - 8U)));
+    ADCSRA = ADC_START;
+}
+
+/**
+ * @brief Stop the interrupt chain after the last key of a sweep.
+ */
+inline void finishSweep() noexcept
+{
+    ADCSRA = ADC_IDLE;
+}
+
+/**
+ * @brief Start one sweep from the loop.
+ *
+ * @details The port writes are read-modify-write and may share a port with
+ *          pins driven from other ISRs, so they run with interrupts off.
+ */
+template <uint8_t Pin> void startSweep(lsh::core::PinTag<Pin> firstPin) noexcept
+{
+    const uint8_t oldSREG = SREG;
+    cli();
+    precharge(firstPin);
+    SREG = oldSREG;
+}
+}  // namespace TouchSense
+
+/**
+ * @brief Baseline tracker and threshold detector of one touch key.
+ *
+ * @details Fed once per sweep from the loop. The baseline follows slow drift
+ *          (temperature, humidity, a dirty panel) at 1/16 count per sweep when
+ *          the reading rises and much faster when it falls, and freezes while
+ *          the key is touched so a long press is not learned away. A key is
+ *          pressed when the reading exceeds the baseline by the threshold and
+ *          released below half of it. The result feeds the regular click FSM
+ *          through `Clickable::clickDetection()`.
+ */
+class TouchKey
+{
+private:
+    static constexpr uint8_t FLAG_PRESSED = 0x01U;     //!< Reading above the baseline by the threshold.
+    static constexpr uint8_t FLAG_CALIBRATED = 0x02U;  //!< Baseline seeded from a first sample.
+    static constexpr uint8_t BASELINE_SHIFT = 4U;      //!< Baseline kept in 1/16 counts.
+    static constexpr uint8_t FALL_SHIFT = 2U;          //!< Falling readings close 1/4 of the gap per sweep.
+
+    uint16_t baseline_x16 = 0U;  //!< Untouched reading, in 1/16 ADC counts.
+    uint8_t flags = 0U;          //!< Packed detector state.
+
+public:
+    TouchKey() noexcept = default;
+
+#if LSH_USING_CPP17
+    TouchKey(const TouchKey &) = delete;
+    TouchKey(TouchKey &&) = delete;
+    auto operator=(const TouchKey &) -> TouchKey & = delete;
+    auto operator=(TouchKey &&) -> TouchKey & = delete;
+#endif  // LSH_USING_CPP17
+
+    /**
+     * @brief Fold one sample into the detector.
+     *
+     * @tparam Threshold Counts above the baseline that mean "touched".
+     * @param sample 10-bit ADC reading of the electrode.
+     */
+    template <uint8_t Threshold = constants::timings::TOUCH_THRESHOLD> void update(uint16_t sample) noexcept
+    {
+        static_assert(Threshold > 1U, "Touch threshold must leave room for hysteresis.");
+        const uint16_t scaled = static_cast<uint16_t>(sample << BASELINE_SHIFT);
+        if ((this->flags & FLAG_CALIBRATED) == 0U)
+        {
+            this->baseline_x16 = scaled;
+            this->flags = FLAG_CALIBRATED;
+            return;
+        }
+
+        const int16_t delta = static_cast<int16_t>(sample) - static_cast<int16_t>(this->baseline_x16 >> BASELINE_SHIFT);
+        if ((this->flags & FLAG_PRESSED) != 0U)
+        {
+            if (delta >= static_cast<int16_t>(Threshold / 2U))
+            {
+                return;
+            }
+            this->flags &= static_cast<uint8_t>(~FLAG_PRESSED);
+        }
+        else if (delta >= static_cast<int16_t>(Threshold))
+        {
+            this->flags |= FLAG_PRESSED;
+            return;
+        }
+
+        if (scaled > this->baseline_x16)
+        {
+            ++this->baseline_x16;
+        }
+        else
+        {
+            this->baseline_x16 = static_cast<uint16_t>(this->baseline_x16 - ((this->baseline_x16 - scaled) >> FALL_SHIFT));
+        }
+    }
+
+    /**
+     * @brief Return true while the key is touched.
+     */
+    [[nodiscard]] auto pressed() const noexcept -> bool
+    {
+        return (this->flags & FLAG_PRESSED) != 0U;
+    }
+};
+
+#endif  // LSH_CORE_PERIPHERALS_INPUT_TOUCH_KEY_HPP
@@ -127,6 +127,9 @@ auto Actuator::applyStateChange(bool state, uint32_t now_ms, uint8_t actuatorInd
     this->updateCachedStateFlag(state);
 #if LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME
     this->lastTimeSwitched = now_ms;
+#endif
+#if LSH_CORE_ACTUATOR_NEEDS_AUTO_OFF_START
+    this->autoOffStart_ms = now_ms;
 #endif
     // Keep the global packed shadow in sync so state serialization never has
     // to walk the actuator array just to rebuild protocol bytes. Static
@@ -271,7 +274,7 @@ auto Actuator::checkAutoOffTimerForIndex(uint8_t actuatorIndex, uint32_t now_ms,
 #if !CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES && LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME
     if ((this->flags & ACTUATOR_FLAG_ACTUAL_STATE) != 0U && autoOffTimer_ms != 0U)
     {
-        if (now_ms - this->lastTimeSwitched >= autoOffTimer_ms)
+        if (now_ms - this->autoOffStartTime() >= autoOffTimer_ms)
         {
             return this->setStateForIndex(actuatorIndex, false, now_ms);
         }
@@ -284,3 +287,30 @@ auto Actuator::checkAutoOffTimerForIndex(uint8_t actuatorIndex, uint32_t now_ms,
     return false;
 #endif
 }
+
+/**
+ * @brief Reports the running auto-off countdown without touching the actuator.
+ *
+ * @param now_ms caller-cached current time in milliseconds.
+ * @param autoOffTimer_ms auto-off timer of the actuator.
+ * @param remaining_ms receives the time left, `0` when the next sweep is already due.
+ * @return true if the actuator is ON with a non-zero timer, so a countdown is running.
+ * @return false otherwise, leaving `remaining_ms` untouched.
+ */
+auto Actuator::getAutoOffRemaining(uint32_t now_ms, uint32_t autoOffTimer_ms, uint32_t &remaining_ms) const -> bool
+{
+#if !CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES && LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME
+    if ((this->flags & ACTUATOR_FLAG_ACTUAL_STATE) == 0U || autoOffTimer_ms == 0U)
+    {
+        return false;
+    }
+    const uint32_t elapsed_ms = now_ms - this->autoOffStartTime();
+    remaining_ms = (elapsed_ms >= autoOffTimer_ms) ? 0U : autoOffTimer_ms - elapsed_ms;
+    return true;
+#else
+    static_cast<void>(now_ms);
+    static_cast<void>(autoOffTimer_ms);
+    static_cast<void>(remaining_ms);
+    return false;
+#endif
+}
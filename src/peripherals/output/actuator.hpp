@@ -39,6 +39,15 @@
 #define LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME 0
 #endif
 
+// Occupancy restarts auto-off countdowns without switching; when debounce also
+// reads the local switch time, the countdown needs a timestamp of its own.
+#if LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME && LSH_EFFECTIVE_ACTUATOR_DEBOUNCE_TIME_MS != 0U && \
+    LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS > 0 && LSH_STATIC_CONFIG_OCCUPANCY_INPUTS > 0
+#define LSH_CORE_ACTUATOR_NEEDS_AUTO_OFF_START 1
+#else
+#define LSH_CORE_ACTUATOR_NEEDS_AUTO_OFF_START 0
+#endif
+
 #if LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME || (CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES && LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS > 0)
 #define LSH_CORE_ACTUATOR_NEEDS_SWITCH_TIMESTAMP 1
 #else
@@ -98,6 +107,9 @@ private:
     uint8_t flags = 0U;  //!< Packed default/current/protection flags.
 #if LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME
     uint32_t lastTimeSwitched = 0U;  //!< Last time the actuator performed a switch
+#endif
+#if LSH_CORE_ACTUATOR_NEEDS_AUTO_OFF_START
+    uint32_t autoOffStart_ms = 0U;  //!< Auto-off countdown start, also moved by occupancy retriggers
 #endif
     /**
      * @brief Drive the physical output pin using the configured I/O backend.
@@ -109,6 +121,12 @@ private:
     void writePinState(bool state)
     {
 #ifdef CONFIG_USE_FAST_ACTUATORS
+#if LSH_STATIC_CONFIG_PRIORITY_INPUTS > 0 || LSH_STATIC_CONFIG_TOUCH_KEYS > 0
+        // Priority-input and touch ISRs write the same port registers; keep
+        // this read-modify-write from losing a bit they changed mid-way.
+        const uint8_t oldSREG = SREG;
+        cli();
+#endif
         if (!state)
         {
             *this->pinPort &= ~this->pinMask;
@@ -117,6 +135,9 @@ private:
         {
             *this->pinPort |= this->pinMask;
         }
+#if LSH_STATIC_CONFIG_PRIORITY_INPUTS > 0 || LSH_STATIC_CONFIG_TOUCH_KEYS > 0
+        SREG = oldSREG;
+#endif
 #else
         digitalWrite(this->pinNumber, static_cast<uint8_t>(state));
 #endif
@@ -171,6 +192,20 @@ private:
 #endif
     }
 
+#if LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME
+    /**
+     * @brief Return the local start of the running auto-off countdown.
+     */
+    [[nodiscard]] auto autoOffStartTime() const -> uint32_t
+    {
+#if LSH_CORE_ACTUATOR_NEEDS_AUTO_OFF_START
+        return this->autoOffStart_ms;
+#else
+        return this->lastTimeSwitched;
+#endif
+    }
+#endif
+
     /**
      * @brief Apply one state transition through the runtime-index path.
      *
@@ -193,16 +228,31 @@ private:
     template <uint8_t ActuatorIndex>
     [[nodiscard]] __attribute__((always_inline)) inline auto applyStateChangeStatic(bool state, uint32_t now_ms) -> bool
     {
-        static_assert(ActuatorIndex < CONFIG_MAX_ACTUATORS, "ActuatorIndex is outside the generated static profile.");
         if (!this->debounceAllowsSwitch(now_ms))
         {
             return false;
         }
+        return this->commitStateChangeStatic<ActuatorIndex>(state, now_ms);
+    }
 
+    /**
+     * @brief Switch the pin and publish the new state, without a debounce check.
+     *
+     * @details Shared tail of `applyStateChangeStatic()` and
+     *          `reconcileStateStatic()`; the latter must not be refused by
+     *          debounce because the pin already moved inside an ISR.
+     */
+    template <uint8_t ActuatorIndex>
+    [[nodiscard]] __attribute__((always_inline)) inline auto commitStateChangeStatic(bool state, uint32_t now_ms) -> bool
+    {
+        static_assert(ActuatorIndex < CONFIG_MAX_ACTUATORS, "ActuatorIndex is outside the generated static profile.");
         this->writePinState(state);
         this->updateCachedStateFlag(state);
 #if LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME
         this->lastTimeSwitched = now_ms;
+#endif
+#if LSH_CORE_ACTUATOR_NEEDS_AUTO_OFF_START
+        this->autoOffStart_ms = now_ms;
 #endif
         Actuators::updatePackedStateStatic<ActuatorIndex>(state);
 #if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES && LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS > 0
@@ -320,6 +370,31 @@ public:
         return this->applyStateChangeStatic<ActuatorIndex>(state, now_ms);
     }
 
+    /**
+     * @brief Drive the output OFF from a priority-input ISR.
+     *
+     * @details Touches only the pin. Flags, packed state and timers are left to
+     *          `reconcileStateStatic()`, which the main loop runs afterwards.
+     */
+    void driveOffFromIsr()
+    {
+        this->writePinState(false);
+    }
+
+    /**
+     * @brief Bring software state in line with a pin already driven by an ISR.
+     *
+     * @return true if the cached state changed and must be reported.
+     */
+    template <uint8_t ActuatorIndex> [[nodiscard]] auto reconcileStateStatic(bool state, uint32_t now_ms) -> bool
+    {
+        if (!this->wouldChangeState(state))
+        {
+            return false;
+        }
+        return this->commitStateChangeStatic<ActuatorIndex>(state, now_ms);
+    }
+
     void setIndex(uint8_t indexToSet);  // Set the actuator index on Actuators namespace Array
     auto setProtected(bool hasProtection)
         -> Actuator &;  // Set protection against global "turn-off" actions (e.g., a general super long click).
@@ -344,10 +419,38 @@ public:
         return this->setStateStatic<ActuatorIndex>((this->flags & ACTUATOR_FLAG_ACTUAL_STATE) == 0U, now_ms);
     }
 
+    /**
+     * @brief Restart the auto-off countdown of an actuator that is already ON.
+     *
+     * @details Occupancy inputs call this on every sample taken while the
+     *          sensor is active, so a light stays on for as long as the sensor
+     *          holds its output. Actuator debounce keeps its own switch time:
+     *          a retrigger is not a switch.
+     */
+    template <uint8_t ActuatorIndex> void restartAutoOffStatic(uint32_t now_ms)
+    {
+        static_assert(ActuatorIndex < CONFIG_MAX_ACTUATORS, "ActuatorIndex is outside the generated static profile.");
+        static_cast<void>(now_ms);
+        if ((this->flags & ACTUATOR_FLAG_ACTUAL_STATE) == 0U)
+        {
+            return;
+        }
+#if LSH_CORE_ACTUATOR_NEEDS_AUTO_OFF_START
+        this->autoOffStart_ms = now_ms;
+#elif LSH_CORE_ACTUATOR_NEEDS_LOCAL_SWITCH_TIME && LSH_EFFECTIVE_ACTUATOR_DEBOUNCE_TIME_MS == 0U
+        this->lastTimeSwitched = now_ms;  // Only auto-off reads it without debounce.
+#endif
+#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES && LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS > 0
+        Actuators::recordSwitchTime(ActuatorIndex, now_ms);
+#endif
+    }
+
     [[nodiscard]] auto checkAutoOffTimer(uint32_t now_ms, uint32_t autoOffTimer_ms)
         -> bool;  // Checks the provided auto-off timer using a caller-cached timestamp.
     [[nodiscard]] auto checkAutoOffTimerForIndex(uint8_t actuatorIndex, uint32_t now_ms, uint32_t autoOffTimer_ms)
         -> bool;  // Checks auto-off while providing the generated dense actuator index.
+    [[nodiscard]] auto getAutoOffRemaining(uint32_t now_ms, uint32_t autoOffTimer_ms, uint32_t &remaining_ms) const
+        -> bool;  // Reports the running auto-off countdown without touching the actuator.
 };
 
 #endif  // LSH_CORE_PERIPHERALS_OUTPUT_ACTUATOR_HPP
@@ -120,6 +120,12 @@ public:
     void setState(bool stateToSet)
     {
 #ifdef CONFIG_USE_FAST_INDICATORS
+#if LSH_STATIC_CONFIG_PRIORITY_INPUTS > 0 || LSH_STATIC_CONFIG_TOUCH_KEYS > 0
+        // The port may be shared with an actuator driven by a priority-input ISR
+        // or with a touch electrode charged by the ADC ISR.
+        const uint8_t oldSREG = SREG;
+        cli();
+#endif
         if (!stateToSet)
         {
             *this->pinPort &= ~this->pinMask;
@@ -128,6 +134,9 @@ public:
         {
             *this->pinPort |= this->pinMask;
         }
+#if LSH_STATIC_CONFIG_PRIORITY_INPUTS > 0 || LSH_STATIC_CONFIG_TOUCH_KEYS > 0
+        SREG = oldSREG;
+#endif
 #else
         digitalWrite(this->pinNumber, static_cast<uint8_t>(stateToSet));
 #endif
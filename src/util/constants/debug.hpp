@@ -66,6 +66,7 @@ constexpr const char CALLED[] PROGMEM = "called";
 constexpr const char FREE_MEMORY[] PROGMEM = "Free memory";                                       // NOLINT
 constexpr const char COMPILED_BY_GCC[] PROGMEM = "Compiled by GCC";                               // NOLINT
 constexpr const char EXEC_TIME[] PROGMEM = "Exec time";                                           // NOLINT
+constexpr const char WORST_ITERATION_US[] PROGMEM = "Worst iteration us";                         // NOLINT
 constexpr const char IS_CONNECTED[] PROGMEM = "Is connected";                                     // NOLINT
 constexpr const char CLICKABLE[] PROGMEM = "Clickable";                                           // NOLINT
 constexpr const char SHORT[] PROGMEM = "short";                                                   // NOLINT
@@ -43,6 +43,17 @@ static_assert(CONFIG_CLICKABLE_DEBOUNCE_TIME_MS <= UINT8_MAX, "CONFIG_CLICKABLE_
 static constexpr const uint8_t CLICKABLE_DEBOUNCE_TIME_MS = CONFIG_CLICKABLE_DEBOUNCE_TIME_MS;  //!< Clickable (button) debounce
 #endif  // CONFIG_CLICKABLE_DEBOUNCE_TIME_MS
 
+#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE
+#ifndef CONFIG_CLICKABLE_BOUNCE_SETTLE_TIME_MS
+static constexpr const uint8_t CLICKABLE_BOUNCE_SETTLE_TIME_MS = 50U;  //!< Quiet time that closes one bounce-profile edge window
+#else
+static_assert(CONFIG_CLICKABLE_BOUNCE_SETTLE_TIME_MS > 0, "CONFIG_CLICKABLE_BOUNCE_SETTLE_TIME_MS must be greater than zero.");
+static_assert(CONFIG_CLICKABLE_BOUNCE_SETTLE_TIME_MS < UINT8_MAX, "CONFIG_CLICKABLE_BOUNCE_SETTLE_TIME_MS must be below 255.");
+static constexpr const uint8_t CLICKABLE_BOUNCE_SETTLE_TIME_MS =
+    CONFIG_CLICKABLE_BOUNCE_SETTLE_TIME_MS;  //!< Quiet time that closes one bounce-profile edge window
+#endif  // CONFIG_CLICKABLE_BOUNCE_SETTLE_TIME_MS
+#endif  // CONFIG_CLICKABLE_BOUNCE_PROFILE
+
 #ifndef CONFIG_CLICKABLE_SCAN_INTERVAL_MS
 static constexpr const uint16_t CLICKABLE_SCAN_INTERVAL_MS =
     1U;  //!< Minimum elapsed time between two clickable scan passes. Default policy is about 1 kHz when the loop is free to run.
@@ -104,6 +115,40 @@ static constexpr const uint16_t ACTUATORS_AUTO_OFF_CHECK_INTERVAL_MS =
     CONFIG_ACTUATORS_AUTO_OFF_CHECK_INTERVAL_MS;  //!< Actuator auto off timer check interval, in ms.
 #endif  // CONFIG_ACTUATORS_AUTO_OFF_CHECK_INTERVAL_MS
 
+#ifndef CONFIG_OCCUPANCY_REPORT_INTERVAL_MS
+static constexpr const uint16_t OCCUPANCY_REPORT_INTERVAL_MS = 30000U;  //!< Default occupancy summary interval, in ms.
+#else
+static_assert(CONFIG_OCCUPANCY_REPORT_INTERVAL_MS > 0, "CONFIG_OCCUPANCY_REPORT_INTERVAL_MS must be greater than zero.");
+static_assert(CONFIG_OCCUPANCY_REPORT_INTERVAL_MS <= UINT16_MAX, "CONFIG_OCCUPANCY_REPORT_INTERVAL_MS must fit in uint16_t.");
+static constexpr const uint16_t OCCUPANCY_REPORT_INTERVAL_MS =
+    CONFIG_OCCUPANCY_REPORT_INTERVAL_MS;  //!< Occupancy summary interval, in ms.
+#endif  // CONFIG_OCCUPANCY_REPORT_INTERVAL_MS
+
+#ifndef CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS
+static constexpr const uint16_t TEMPERATURE_SAMPLE_INTERVAL_MS = 30000U;  //!< Default pause between two 1-Wire sensor cycles, in ms.
+#else
+static_assert(CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS > 0, "CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS must be greater than zero.");
+static_assert(CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS <= UINT16_MAX, "CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS must fit in uint16_t.");
+static constexpr const uint16_t TEMPERATURE_SAMPLE_INTERVAL_MS =
+    CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS;  //!< Pause between two 1-Wire sensor cycles, in ms.
+#endif  // CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS
+
+#ifndef CONFIG_ONE_WIRE_CONVERSION_TIME_MS
+static constexpr const uint16_t ONE_WIRE_CONVERSION_TIME_MS = 750U;  //!< Default wait after CONVERT T, 12-bit DS18B20 resolution.
+#else
+static_assert(CONFIG_ONE_WIRE_CONVERSION_TIME_MS > 0, "CONFIG_ONE_WIRE_CONVERSION_TIME_MS must be greater than zero.");
+static_assert(CONFIG_ONE_WIRE_CONVERSION_TIME_MS <= UINT16_MAX, "CONFIG_ONE_WIRE_CONVERSION_TIME_MS must fit in uint16_t.");
+static constexpr const uint16_t ONE_WIRE_CONVERSION_TIME_MS = CONFIG_ONE_WIRE_CONVERSION_TIME_MS;  //!< Wait after CONVERT T.
+#endif  // CONFIG_ONE_WIRE_CONVERSION_TIME_MS
+
+#ifndef CONFIG_TOUCH_THRESHOLD
+static constexpr const uint8_t TOUCH_THRESHOLD = 24U;  //!< Default ADC counts above the baseline that mean a touch.
+#else
+static_assert(CONFIG_TOUCH_THRESHOLD > 1, "CONFIG_TOUCH_THRESHOLD must be greater than one.");
+static_assert(CONFIG_TOUCH_THRESHOLD <= UINT8_MAX, "CONFIG_TOUCH_THRESHOLD must fit in uint8_t.");
+static constexpr const uint8_t TOUCH_THRESHOLD = CONFIG_TOUCH_THRESHOLD;  //!< ADC counts above the baseline that mean a touch.
+#endif  // CONFIG_TOUCH_THRESHOLD
+
 #ifndef CONFIG_LCNB_TIMEOUT_MS
 static constexpr const uint16_t LCNB_TIMEOUT_MS = 1000U;  //!< Default Long clicked network clickable (button) timeout
 #else
@@ -0,0 +1,403 @@
+/**
+ * @file    one_wire_sensor_model.cpp
+ * @author  Jacopo Labardi (labodj)
+ * @brief   Host bit-level DS18B20 model that drives OneWireBus through its timer and pin hooks.
+ *
+ * Copyright 2026 Jacopo Labardi
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Built and run by tests/test_one_wire_host_model.py. The simulated clock only
+// moves through delayMicroseconds(), the slot timer and the loop passes, so
+// every edge the driver makes is judged by the sensors at its exact time.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define OUTPUT 1U
+#define INPUT 0U
+#define LOW 0U
+
+namespace
+{
+constexpr uint8_t BUS_PINS = 3U;
+constexpr uint8_t FIRST_PIN = 5U;
+constexpr uint8_t MAX_MODEL_SENSORS = 4U;
+constexpr uint32_t RESET_MIN_US = 480U;
+constexpr uint32_t PRESENCE_DELAY_US = 30U;
+constexpr uint32_t PRESENCE_US = 120U;
+constexpr uint32_t WRITE_ZERO_MIN_US = 15U;
+constexpr uint32_t READ_ZERO_HOLD_US = 30U;
+constexpr uint32_t READ_WINDOW_US = 15U;
+constexpr uint16_t POWER_ON_READING = 0x0550U;
+
+uint32_t now_us = 0U;
+
+auto crc8(const uint8_t *data, uint8_t length) -> uint8_t
+{
+    uint8_t crc = 0U;
+    for (uint8_t index = 0U; index < length; ++index)
+    {
+        uint8_t value = data[index];
+        for (uint8_t bit = 0U; bit < 8U; ++bit)
+        {
+            const bool mix = ((crc ^ value) & 0x01U) != 0U;
+            crc = static_cast<uint8_t>(crc >> 1U);
+            if (mix)
+            {
+                crc ^= 0x8CU;
+            }
+            value = static_cast<uint8_t>(value >> 1U);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief One DS18B20 answering the reset, ROM and function commands bit by bit.
+ */
+struct SensorModel
+{
+    enum class State : uint8_t
+    {
+        Idle,
+        RomCommand,
+        MatchRom,
+        FunctionCommand,
+        SendScratchpad,
+    };
+
+    uint8_t rom[8] = {};
+    uint16_t reading = 0U;
+    bool corruptCrc = false;
+    bool converted = false;
+    State state = State::Idle;
+    uint8_t shift[9] = {};
+    uint8_t bitCount = 0U;
+    uint32_t presenceStart_us = 0U;
+    uint32_t holdUntil_us = 0U;
+
+    void onReset()
+    {
+        this->state = State::RomCommand;
+        this->bitCount = 0U;
+        this->shift[0] = 0U;
+        this->presenceStart_us = now_us + PRESENCE_DELAY_US;
+    }
+
+    void onReceivedBit(bool bit)
+    {
+        const uint8_t byteIndex = static_cast<uint8_t>(this->bitCount >> 3U);
+        if ((this->bitCount & 0x07U) == 0U)
+        {
+            this->shift[byteIndex] = 0U;
+        }
+        if (bit)
+        {
+            this->shift[byteIndex] |= static_cast<uint8_t>(1U << (this->bitCount & 0x07U));
+        }
+        ++this->bitCount;
+        const uint8_t needed = (this->state == State::MatchRom) ? 64U : 8U;
+        if (this->bitCount < needed)
+        {
+            return;
+        }
+        this->bitCount = 0U;
+        switch (this->state)
+        {
+        case State::RomCommand:
+            this->state = (this->shift[0] == 0xCCU) ? State::FunctionCommand : (this->shift[0] == 0x55U) ? State::MatchRom : State::Idle;
+            break;
+        case State::MatchRom:
+            this->state = State::FunctionCommand;
+            for (uint8_t index = 0U; index < 8U; ++index)
+            {
+                if (this->shift[index] != this->rom[index])
+                {
+                    this->state = State::Idle;
+                }
+            }
+            break;
+        case State::FunctionCommand:
+            if (this->shift[0] == 0x44U)
+            {
+                this->converted = true;
+                this->state = State::Idle;
+            }
+            else if (this->shift[0] == 0xBEU)
+            {
+                this->loadScratchpad();
+                this->state = State::SendScratchpad;
+            }
+            else
+            {
+                this->state = State::Idle;
+            }
+            break;
+        default:
+            this->state = State::Idle;
+            break;
+        }
+    }
+
+    void loadScratchpad()
+    {
+        const uint16_t value = this->converted ? this->reading : POWER_ON_READING;
+        const uint8_t bytes[8] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8U), 0x4BU, 0x46U, 0x7FU, 0xFFU, 0x0CU, 0x10U};
+        for (uint8_t index = 0U; index < 8U; ++index)
+        {
+            this->shift[index] = bytes[index];
+        }
+        this->shift[8] = static_cast<uint8_t>(crc8(bytes, 8U) ^ (this->corruptCrc ? 0x01U : 0x00U));
+    }
+
+    /**
+     * @brief React to the master pulling the line low.
+     */
+    void onFallingEdge()
+    {
+        if (this->state != State::SendScratchpad || this->bitCount >= 72U)
+        {
+            return;
+        }
+        const bool bit = ((this->shift[this->bitCount >> 3U] >> (this->bitCount & 0x07U)) & 0x01U) != 0U;
+        ++this->bitCount;
+        if (!bit)
+        {
+            this->holdUntil_us = now_us + READ_ZERO_HOLD_US;
+        }
+    }
+
+    /**
+     * @brief React to the master releasing the line after `low_us`.
+     */
+    void onRisingEdge(uint32_t low_us)
+    {
+        if (low_us >= RESET_MIN_US)
+        {
+            this->onReset();
+            return;
+        }
+        if (this->state == State::RomCommand || this->state == State::MatchRom || this->state == State::FunctionCommand)
+        {
+            this->onReceivedBit(low_us < WRITE_ZERO_MIN_US);
+        }
+    }
+
+    [[nodiscard]] auto pullsLow() const -> bool
+    {
+        const bool presence = this->presenceStart_us != 0U && now_us >= this->presenceStart_us &&
+                              now_us < this->presenceStart_us + PRESENCE_US;
+        return presence || now_us < this->holdUntil_us;
+    }
+};
+
+struct LineModel
+{
+    SensorModel sensors[MAX_MODEL_SENSORS];
+    uint8_t sensorCount = 0U;
+    bool masterLow = false;
+    uint32_t fallingEdge_us = 0U;
+    uint32_t lowestSample_us = UINT32_MAX;  //!< Earliest sample after a falling edge, in us.
+    uint32_t latestSample_us = 0U;          //!< Latest sample after a falling edge, in us.
+};
+
+LineModel lines[BUS_PINS];
+bool timerRunning = false;
+uint32_t timerDue_us = 0U;
+uint32_t timerCalls = 0U;
+
+auto lineFor(uint8_t pin) -> LineModel &
+{
+    return lines[pin - FIRST_PIN];
+}
+}  // namespace
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    LineModel &line = lineFor(pin);
+    const bool low = mode == OUTPUT;
+    if (low == line.masterLow)
+    {
+        return;
+    }
+    line.masterLow = low;
+    for (uint8_t index = 0U; index < line.sensorCount; ++index)
+    {
+        if (low)
+        {
+            line.sensors[index].onFallingEdge();
+        }
+        else
+        {
+            line.sensors[index].onRisingEdge(now_us - line.fallingEdge_us);
+        }
+    }
+    if (low)
+    {
+        line.fallingEdge_us = now_us;
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    static_cast<void>(pin);
+    static_cast<void>(value);
+}
+
+auto digitalRead(uint8_t pin) -> int
+{
+    LineModel &line = lineFor(pin);
+    bool low = line.masterLow;
+    for (uint8_t index = 0U; index < line.sensorCount; ++index)
+    {
+        low = low || line.sensors[index].pullsLow();
+    }
+    const uint32_t sample_us = now_us - line.fallingEdge_us;
+    if (sample_us < READ_WINDOW_US)
+    {
+        line.lowestSample_us = (sample_us < line.lowestSample_us) ? sample_us : line.lowestSample_us;
+        line.latestSample_us = (sample_us > line.latestSample_us) ? sample_us : line.latestSample_us;
+    }
+    return low ? 0 : 1;
+}
+
+void delayMicroseconds(unsigned int delay_us)
+{
+    now_us += delay_us;
+}
+
+#include "peripherals/input/one_wire_bus.hpp"
+
+namespace OneWireTimer
+{
+auto now() noexcept -> uint16_t
+{
+    return static_cast<uint16_t>(now_us);
+}
+
+void schedule(uint16_t delay_us) noexcept
+{
+    timerDue_us = now_us + delay_us;
+}
+
+void start(uint16_t delay_us) noexcept
+{
+    timerRunning = true;
+    schedule(delay_us);
+}
+
+void stop() noexcept
+{
+    timerRunning = false;
+}
+
+auto busy() noexcept -> bool
+{
+    return timerRunning;
+}
+}  // namespace OneWireTimer
+
+namespace
+{
+const uint8_t pairIds[3] = {10U, 11U, 12U};
+const uint8_t pairRoms[24] = {0x28U, 0xFFU, 0x64U, 0x1EU, 0x0FU, 0x16U, 0x03U, 0x90U, 0x28U, 0xAAU, 0x3CU, 0x51U,
+                              0x1AU, 0x13U, 0x02U, 0x5AU, 0x28U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U};
+const uint8_t loneIds[1] = {20U};
+const uint8_t absentIds[1] = {30U};
+int16_t pairReadings[3] = {};
+int16_t loneReadings[1] = {};
+int16_t absentReadings[1] = {};
+
+OneWireBus pairBus(::lsh::core::PinTag<5>{}, 3U, pairIds, pairRoms, pairReadings);
+OneWireBus loneBus(::lsh::core::PinTag<6>{}, 1U, loneIds, nullptr, loneReadings);
+OneWireBus absentBus(::lsh::core::PinTag<7>{}, 1U, absentIds, nullptr, absentReadings);
+
+void runTimerUntil(uint32_t until_us)
+{
+    while (timerRunning && timerDue_us <= until_us)
+    {
+        now_us = timerDue_us;
+        ++timerCalls;
+        pairBus.onTimer(::lsh::core::PinTag<5>{});
+        loneBus.onTimer(::lsh::core::PinTag<6>{});
+        absentBus.onTimer(::lsh::core::PinTag<7>{});
+    }
+}
+
+void report(const char *name, const OneWireBus &bus, uint32_t donePass)
+{
+    printf("%s done=%lu fresh=%u worst=%u", name, static_cast<unsigned long>(donePass), bus.freshCount(), bus.worstSlot());
+    for (uint8_t index = 0U; index < bus.count(); ++index)
+    {
+        if (bus.isFresh(index))
+        {
+            printf(" %u:%d", bus.sensorId(index), bus.reading(index));
+        }
+    }
+    printf("\n");
+}
+}  // namespace
+
+auto main() -> int
+{
+    const uint8_t romBytes[3][8] = {{0x28U, 0xFFU, 0x64U, 0x1EU, 0x0FU, 0x16U, 0x03U, 0x90U},
+                                    {0x28U, 0xAAU, 0x3CU, 0x51U, 0x1AU, 0x13U, 0x02U, 0x5AU},
+                                    {0x28U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U}};
+    const uint16_t pairValues[3] = {0x0191U, 0xFF5EU, 0x0200U};
+    LineModel &pair = lineFor(5U);
+    pair.sensorCount = 3U;
+    for (uint8_t index = 0U; index < 3U; ++index)
+    {
+        for (uint8_t byteIndex = 0U; byteIndex < 8U; ++byteIndex)
+        {
+            pair.sensors[index].rom[byteIndex] = romBytes[index][byteIndex];
+        }
+        pair.sensors[index].reading = pairValues[index];
+    }
+    pair.sensors[2].corruptCrc = true;
+    LineModel &lone = lineFor(6U);
+    lone.sensorCount = 1U;
+    lone.sensors[0].reading = 0x0028U;
+
+    uint32_t pairDone = 0U;
+    uint32_t loneDone = 0U;
+    uint32_t absentDone = 0U;
+    constexpr uint32_t PASS_US = 1000U;
+    constexpr uint32_t MAX_PASSES = 5000U;
+    for (uint32_t pass = 1U; pass <= MAX_PASSES && (pairDone == 0U || loneDone == 0U || absentDone == 0U); ++pass)
+    {
+        runTimerUntil(now_us + PASS_US);
+        now_us = (now_us > pass * PASS_US) ? now_us : pass * PASS_US;
+        if (pairBus.step(1U) && pairDone == 0U)
+        {
+            pairDone = pass;
+        }
+        if (loneBus.step(1U) && loneDone == 0U)
+        {
+            loneDone = pass;
+        }
+        if (absentBus.step(1U) && absentDone == 0U)
+        {
+            absentDone = pass;
+        }
+    }
+
+    report("pair", pairBus, pairDone);
+    report("lone", loneBus, loneDone);
+    report("absent", absentBus, absentDone);
+    printf("sample min=%lu max=%lu calls=%lu\n", static_cast<unsigned long>(pair.lowestSample_us),
+           static_cast<unsigned long>(pair.latestSample_us), static_cast<unsigned long>(timerCalls));
+    return 0;
+}
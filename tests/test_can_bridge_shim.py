@@ -0,0 +1,95 @@
+"""Regression tests for the SocketCAN shim of the CAN bridge transport."""
+
+from __future__ import annotations
+
+import re
+from pathlib import Path
+
+import pytest
+
+from tools import can_bridge_shim as shim
+
+CAN_FRAMING_HEADER = (
+    Path(__file__).resolve().parent.parent / "src" / "communication" / "can_framing.hpp"
+)
+
+
+@pytest.mark.parametrize("length", [1, 6, 7, 8, 14, 15, 120, 7 * 64 + 3])
+def test_segments_reassemble_into_the_original_payload(length: int) -> None:
+    """Every split, including a wrapped sequence, rebuilds the same bytes."""
+    payload = bytes(index & 0xFF for index in range(length))
+    frames = shim.segment_payload(payload)
+    reassembler = shim.Reassembler()
+
+    results = [reassembler.feed(frame) for frame in frames]
+
+    assert results[:-1] == [None] * (len(frames) - 1)
+    assert results[-1] == payload
+    assert all(len(frame) <= 1 + shim.SEGMENT_PAYLOAD_BYTES for frame in frames)
+    assert frames[0][0] & shim.SEGMENT_START
+    assert frames[-1][0] & shim.SEGMENT_END
+
+
+def test_reassembler_drops_a_payload_with_a_missing_segment() -> None:
+    """A lost frame discards the payload instead of splicing two halves."""
+    frames = shim.segment_payload(bytes(range(20)))
+    reassembler = shim.Reassembler()
+
+    assert reassembler.feed(frames[0]) is None
+    assert reassembler.feed(frames[2]) is None
+    assert reassembler.feed(shim.segment_payload(b"\x81\xa1p\x05")[0]) == (
+        b"\x81\xa1p\x05"
+    )
+
+
+def test_serial_framing_round_trips_delimiters_and_escapes() -> None:
+    """Payload bytes equal to the delimiter or escape survive the serial hop."""
+    payload = bytes([0x81, shim.FRAME_END, 0x00, shim.FRAME_ESCAPE, 0xFF])
+    stream = shim.frame_serial(payload) + shim.frame_serial(b"\x80")
+    deframer = shim.SerialDeframer()
+
+    assert deframer.feed(stream[:3]) == []
+    assert deframer.feed(stream[3:]) == [payload, b"\x80"]
+
+
+def test_identifier_and_priority_follow_the_controller_layout() -> None:
+    """Identifiers are `[priority:3][node:7][toBridge:1]`, classed by command."""
+    priorities = shim.load_priorities()
+    click = next(value for value, priority in priorities.items() if priority == 0)
+
+    bulk_from_last_node = 0x3FF
+    click_to_node_4 = 0x008
+
+    assert shim.can_identifier(3, 127, to_bridge=True) == bulk_from_last_node
+    assert shim.can_identifier(0, 4, to_bridge=False) == click_to_node_4
+    assert shim.payload_priority(bytes([0x81, 0xA1, 0x70, click]), priorities) == 0
+    assert shim.payload_priority(b"\x81\xa1p", priorities) == shim.PRIORITY_CONTROL
+    assert shim.payload_priority(b"\x82\xa1q\x00", priorities) == (
+        shim.PRIORITY_CONTROL
+    )
+
+
+def test_priority_classes_match_the_firmware_switch() -> None:
+    """The shim and `canPriorityFor()` put every command in the same class."""
+    header = CAN_FRAMING_HEADER.read_text(encoding="utf-8")
+    switch = header[header.index("canPriorityFor") :]
+    firmware: dict[str, int] = {}
+    pending: list[str] = []
+    classes = {
+        "CAN_PRIORITY_CLICK": shim.PRIORITY_CLICK,
+        "CAN_PRIORITY_STATE": shim.PRIORITY_STATE,
+        "CAN_PRIORITY_BULK": shim.PRIORITY_BULK,
+    }
+    for case, returned in re.findall(
+        r"case Command::(\w+):|return (CAN_PRIORITY_\w+);", switch
+    ):
+        if case:
+            pending.append(case)
+        elif returned in classes:
+            firmware.update(dict.fromkeys(pending, classes[returned]))
+            pending.clear()
+        else:
+            break
+
+    assert firmware == shim.PRIORITY_CLASSES
+    assert set(shim.load_priorities().values()) <= set(classes.values())
@@ -0,0 +1,110 @@
+"""Bit-level host run of the interrupt-timed 1-Wire driver against DS18B20 models."""
+
+from __future__ import annotations
+
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+
+REPO = Path(__file__).resolve().parent.parent
+MODEL_SOURCE = REPO / "tests" / "host" / "one_wire_sensor_model.cpp"
+# A read slot samples 13 us after its falling edge: 3 us low, 10 us settling.
+READ_SAMPLE_US = 13
+# DS18B20 data is only valid within 15 us of the falling edge.
+READ_WINDOW_US = 15
+CPP_FEATURES_STUB = """\
+#ifndef LSH_CORE_INTERNAL_CPP_FEATURES_HPP
+#define LSH_CORE_INTERNAL_CPP_FEATURES_HPP
+#define LSH_USING_CPP17 1
+#endif
+"""
+
+
+@pytest.fixture(scope="module")
+def model_output(tmp_path_factory: pytest.TempPathFactory) -> dict[str, list[str]]:
+    """Build and run the sensor model once, keyed by the first word per line."""
+    compiler = shutil.which("g++")
+    if compiler is None:
+        pytest.skip("g++ is not available")
+    work = tmp_path_factory.mktemp("one_wire_model")
+    # The ETL platform header is not needed by the bus driver on the host.
+    (work / "internal").mkdir()
+    (work / "internal" / "cpp_features.hpp").write_text(CPP_FEATURES_STUB)
+    binary = work / "one_wire_sensor_model"
+    subprocess.run(  # noqa: S603
+        [
+            compiler,
+            "-std=c++17",
+            "-Wall",
+            "-Wextra",
+            "-Werror",
+            f"-I{work}",
+            f"-I{REPO / 'src'}",
+            str(MODEL_SOURCE),
+            "-o",
+            str(binary),
+        ],
+        check=True,
+    )
+    result = subprocess.run(  # noqa: S603
+        [str(binary)], check=True, capture_output=True, text=True
+    )
+    return {line.split()[0]: line.split()[1:] for line in result.stdout.splitlines()}
+
+
+def fields(words: list[str]) -> dict[str, str]:
+    """Return the `key=value` words of one model line."""
+    return dict(word.split("=", 1) for word in words if "=" in word)
+
+
+def readings(words: list[str]) -> dict[int, int]:
+    """Return the fresh `id:raw` readings of one model line."""
+    pairs = (word.split(":") for word in words if ":" in word)
+    return {int(sensor): int(raw) for sensor, raw in pairs}
+
+
+def test_match_rom_bus_reads_each_sensor_and_drops_a_bad_crc(
+    model_output: dict[str, list[str]],
+) -> None:
+    """Converted readings come back per ROM; a corrupt scratchpad stays stale."""
+    words = model_output["pair"]
+
+    assert int(fields(words)["done"]) > 0
+    assert fields(words)["fresh"] == "2"
+    assert readings(words) == {10: 0x0191, 11: 0xFF5E - 0x10000}
+
+
+def test_lone_sensor_is_read_with_skip_rom(
+    model_output: dict[str, list[str]],
+) -> None:
+    """A bus without ROM codes reads its only sensor after the conversion."""
+    words = model_output["lone"]
+
+    assert fields(words)["fresh"] == "1"
+    assert readings(words) == {20: 0x0028}
+
+
+def test_bus_without_presence_closes_the_cycle_early(
+    model_output: dict[str, list[str]],
+) -> None:
+    """No presence answer skips the conversion wait and every read."""
+    words = model_output["absent"]
+    pair_done = int(fields(model_output["pair"])["done"])
+
+    assert 0 < int(fields(words)["done"]) < pair_done
+    assert fields(words)["fresh"] == "0"
+    assert readings(words) == {}
+
+
+def test_slot_handlers_stay_within_the_read_window(
+    model_output: dict[str, list[str]],
+) -> None:
+    """Interrupts are off for one read slot at most, sampled inside 15 us."""
+    sample = fields(model_output["sample"])
+
+    assert int(sample["min"]) == int(sample["max"]) == READ_SAMPLE_US
+    assert int(sample["max"]) < READ_WINDOW_US
+    for name in ("pair", "lone"):
+        assert int(fields(model_output[name])["worst"]) == READ_SAMPLE_US
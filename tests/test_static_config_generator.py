@@ -200,6 +200,10 @@ def test_public_schema_v2_keeps_simple_profiles_readable() -> None:
     rx_buffer_size = 256
 
     [features]
+    time_sync = true
+    echo_probe = true
+    health_ping = true
+    state_handover = true
     aggressive_constexpr_ctors = true
     etl_profile_override_header = "lsh_etl_profile_override.h"
 
@@ -253,6 +257,10 @@ def test_public_schema_v2_keeps_simple_profiles_readable() -> None:
     assert "CONFIG_CLICKABLE_DEBOUNCE_TIME_MS=8" in defines
     assert "CONFIG_COM_SERIAL_BAUD=500000" in defines
     assert "CONFIG_COM_SERIAL_FLUSH_AFTER_SEND=0" in defines
+    assert "CONFIG_BRIDGE_TIME_SYNC" in defines
+    assert "CONFIG_BRIDGE_ECHO_PROBE" in defines
+    assert "CONFIG_BRIDGE_HEALTH_PING" in defines
+    assert "CONFIG_STATE_HANDOVER" in defines
     assert "LSH_ENABLE_AGGRESSIVE_CONSTEXPR_CTORS" in defines
     assert 'LSH_ETL_PROFILE_OVERRIDE_HEADER="lsh_etl_profile_override.h"' in defines
     assert gen.raw_build_flags(project, device) == ["-D SERIAL_RX_BUFFER_SIZE=256"]
@@ -344,7 +352,8 @@ def test_groups_scenes_pulse_and_interlocks_are_static() -> None:
         "static uint16_t pulseRemaining_ms[CONFIG_PULSE_STORAGE_CAPACITY]"
         in static_header
     )
-    assert "static uint8_t activePulseActuators = 0U;" in static_header
+    assert "static uint8_t activePulseActuators" not in static_header
+    assert "if (hotLoopState::activePulseActuators() == 0U)" in static_header
     assert (
         "auto checkPulseTimers(uint16_t elapsed_ms) noexcept -> bool" in static_header
     )
@@ -356,6 +365,514 @@ def test_groups_scenes_pulse_and_interlocks_are_static() -> None:
     )
     assert "pulseRemaining_ms[0U] = 300U;" in static_header
     assert "actuator2_door_strikeActionSet(true, actionNow)" in static_header
+    assert "remaining_ms = pulseRemaining_ms[0U];" in static_header
+    assert "        actuatorId = 3U;" in static_header
+
+
+def test_actuator_fingerprint_changes_when_packed_bits_would_move() -> None:
+    """Reordered or re-IDed actuators must not accept a handed-over state."""
+
+    def fingerprint(first: tuple[int, str], second: tuple[int, str]) -> str:
+        actuators = f"""
+        [devices.panel.actuators.relay]
+        id = {first[0]}
+        pin = "{first[1]}"
+
+        [devices.panel.actuators.light]
+        id = {second[0]}
+        pin = "{second[1]}"
+        """
+        with tempfile.TemporaryDirectory() as tmpdir:
+            config_path = write_config(
+                Path(tmpdir),
+                minimal_profile(ProfileParts(actuators=actuators)),
+            )
+            files = gen.generated_files(gen.parse_project(config_path), ["panel"])
+        static_header = next(
+            content
+            for path, content in files.items()
+            if path.name == "panel_static_config.hpp"
+        )
+        body = static_header.split(
+            "auto actuatorTopologyFingerprint() noexcept -> uint32_t\n{\n"
+        )[1]
+        return body.split(";", 1)[0]
+
+    baseline = fingerprint((1, "6"), (2, "8"))
+    assert baseline.startswith("    return ")
+    assert baseline.endswith("UL")
+    assert fingerprint((1, "6"), (2, "8")) == baseline
+    assert fingerprint((2, "6"), (1, "8")) != baseline
+    assert fingerprint((1, "8"), (2, "6")) != baseline
+
+
+def test_priority_inputs_drive_pins_from_isr_and_reconcile_in_loop() -> None:
+    """Priority inputs write pins in an ISR and leave bookkeeping to the loop."""
+    clickables = """
+    [devices.panel.buttons.emergency]
+    id = 1
+    pin = "2"
+    short = false
+    priority_off = ["relay"]
+    """
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(ProfileParts(clickables=clickables)),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+
+    assert project.devices["panel"].clickables[0].priority_off_targets == ["relay"]
+    static_header = next(
+        content
+        for path, content in files.items()
+        if path.name == "panel_static_config.hpp"
+    )
+    assert "#define LSH_STATIC_CONFIG_PRIORITY_INPUTS 1" in static_header
+    assert "void button0_emergencyPriorityIsr() noexcept" in static_header
+    assert "    actuator0_relay.driveOffFromIsr();" in static_header
+    assert "priorityInputsPending |= 1U;" in static_header
+    assert "actuator0_relay.reconcileStateStatic<0U>(false, actionNow)" in static_header
+    assert (
+        "attachInterrupt(digitalPinToInterrupt(2), "
+        "button0_emergencyPriorityIsr, RISING);" in static_header
+    )
+
+
+def test_encoders_count_in_isrs_and_drain_levels_and_reports_in_loop() -> None:
+    """Encoder ISRs only count; the loop steps the level bar and reports detents."""
+    clickables = (
+        DEFAULT_CLICKABLE
+        + """
+    [devices.panel.encoders.knob]
+    pin_a = "2"
+    pin_b = "3"
+    levels = "relay"
+    network = true
+    """
+    )
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(ProfileParts(clickables=clickables)),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+
+    encoder = project.devices["panel"].encoders[0]
+    assert encoder.level_targets == ["relay"]
+    static_header = next(
+        content
+        for path, content in files.items()
+        if path.name == "panel_static_config.hpp"
+    )
+    assert "#define LSH_STATIC_CONFIG_NETWORK_ENCODERS 1" in static_header
+    assert "LSH_ENCODER(encoder0_knob, 2, 3);" in static_header
+    assert "detents = encoder0_knob.takeDetents<4U>();" in static_header
+    assert "actuator0_relayActionSet(level0 > 0, actionNow)" in static_header
+    assert "Serializer::serializeEncoderSteps(1U, " in static_header
+    assert (
+        "attachInterrupt(digitalPinToInterrupt(3), encoder0_knobIsr, CHANGE);"
+        in static_header
+    )
+
+
+def test_occupancy_holds_targets_and_reports_in_windows() -> None:
+    """Active sensors hold targets ON locally; the bridge gets windowed summaries."""
+    clickables = (
+        DEFAULT_CLICKABLE
+        + """
+    [devices.panel.occupancy.hall_pir]
+    pin = "4"
+    targets = "relay"
+    network = true
+    """
+    )
+    report_interval_ms = 10000
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(
+                ProfileParts(
+                    project_sections='[timing]\noccupancy_report_interval = "10s"',
+                    actuators=DEFAULT_ACTUATOR + 'auto_off = "5m"\n',
+                    clickables=clickables,
+                )
+            ),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+
+    assert project.devices["panel"].occupancy[0].targets == ["relay"]
+    assert (
+        project.common_defines["CONFIG_OCCUPANCY_REPORT_INTERVAL_MS"]
+        == report_interval_ms
+    )
+    static_header = next(
+        content
+        for path, content in files.items()
+        if path.name == "panel_static_config.hpp"
+    )
+    assert "#define LSH_STATIC_CONFIG_NETWORK_OCCUPANCY 1" in static_header
+    assert "LSH_OCCUPANCY(occupancy0_hall_pir, 4);" in static_header
+    assert "actuator0_relayActionSet(true, actionNow)" in static_header
+    assert "actuator0_relay.restartAutoOffStatic<0U>(actionNow);" in static_header
+    assert "Serializer::serializeOccupancy(1U, " in static_header
+
+
+def test_held_active_occupancy_restarts_the_countdown_on_every_sample() -> None:
+    """Only a rising edge switches ON; a held sensor keeps restarting auto-off."""
+    clickables = (
+        DEFAULT_CLICKABLE
+        + """
+    [devices.panel.occupancy.hall_pir]
+    pin = "4"
+    targets = "relay"
+    """
+    )
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(
+                ProfileParts(
+                    actuators=DEFAULT_ACTUATOR + 'auto_off = "5m"\n',
+                    clickables=clickables,
+                )
+            ),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+
+    static_header = next(
+        content
+        for path, content in files.items()
+        if path.name == "panel_static_config.hpp"
+    )
+    scan_start = static_header.index("auto scanOccupancy()")
+    scan = static_header[scan_start : static_header.index("\n}\n", scan_start)]
+    rising = scan.index("if (occupancy0_hall_pir.sampleRisingEdge(")
+    held = scan.index("if (occupancy0_hall_pir.active())")
+    set_on = scan.index("actuator0_relayActionSet(true, actionNow)")
+    restart = scan.index("actuator0_relay.restartAutoOffStatic<0U>(actionNow);")
+    assert rising < set_on < held < restart
+    assert scan.count("actuator0_relayActionSet(") == 1
+
+
+def test_temperature_sensors_on_one_pin_share_a_one_wire_bus() -> None:
+    """Sensors on one pin become one bus with flash ID and ROM tables."""
+    interval_ms = 60000
+    clickables = (
+        DEFAULT_CLICKABLE
+        + """
+    [devices.panel.temperature.room]
+    pin = "5"
+    rom = "28:FF:64:1E:0F:16:03:90"
+
+    [devices.panel.temperature.outdoor]
+    pin = "5"
+    rom = "28-AA-3C-51-1A-13-02-5A"
+
+    [devices.panel.temperature.boiler]
+    pin = "6"
+    """
+    )
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(
+                ProfileParts(
+                    project_sections=(
+                        f'[timing]\ntemperature_interval = "{interval_ms}ms"'
+                    ),
+                    clickables=clickables,
+                )
+            ),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+
+    sensors = project.devices["panel"].temperature
+    assert sensors[1].rom == [0x28, 0xAA, 0x3C, 0x51, 0x1A, 0x13, 0x02, 0x5A]
+    assert (
+        project.common_defines["CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS"] == interval_ms
+    )
+    static_header = next(
+        content
+        for path, content in files.items()
+        if path.name == "panel_static_config.hpp"
+    )
+    assert "#define LSH_STATIC_CONFIG_TEMPERATURE_SENSORS 3" in static_header
+    assert "#define LSH_STATIC_CONFIG_ONE_WIRE_BUSES 2" in static_header
+    assert (
+        "LSH_ONE_WIRE_BUS(oneWireBus0, 5, 2U, oneWireBus0Ids, oneWireBus0Roms, "
+        "oneWireBus0Readings);" in static_header
+    )
+    assert (
+        "LSH_ONE_WIRE_BUS(oneWireBus1, 6, 1U, oneWireBus1Ids, nullptr, "
+        "oneWireBus1Readings);" in static_header
+    )
+    assert "Serializer::serializeTemperatures(oneWireBus1)" in static_header
+    assert "    if (oneWireBus1.step(elapsed_ms) &&" in static_header
+    assert (
+        "ISR(TIMER5_COMPA_vect)\n{\n"
+        "    oneWireBus0.onTimer(::lsh::core::PinTag<(5)>{});\n"
+        "    oneWireBus1.onTimer(::lsh::core::PinTag<(6)>{});\n}"
+    ) in static_header
+
+
+def test_peer_actions_send_frames_to_the_target_controller() -> None:
+    """Peer clicks resolve the target address and IDs at generation time."""
+    clickables = (
+        DEFAULT_CLICKABLE
+        + """
+    peer = { device = "hall", targets = ["ceiling"] }
+
+    [devices.hall]
+    peer_link = { serial = "Serial2", address = 2 }
+
+    [devices.hall.actuators.ceiling]
+    id = 7
+    pin = "6"
+    """
+    )
+    device_fields = 'peer_link = { serial = "Serial3", address = 1 }'
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(
+                ProfileParts(device_fields=device_fields, clickables=clickables)
+            ),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel", "hall"])
+
+    peer = project.devices["panel"].clickables[0].peer
+    assert peer is not None
+    assert (peer.address, peer.actuator_ids) == (2, [7])
+    contents = {path.name: content for path, content in files.items()}
+    panel_static = contents["panel_static_config.hpp"]
+    assert "#define LSH_STATIC_CONFIG_PEER_ADDRESS 1" in panel_static
+    assert '#include "communication/peer_link.hpp"' in panel_static
+    assert (
+        "static_cast<void>(PeerLink::send(2U, 7U, PeerLink::Operation::TOGGLE));"
+        in panel_static
+    )
+    assert (
+        "#define LSH_STATIC_CONFIG_PEER_ADDRESS 2" in contents["hall_static_config.hpp"]
+    )
+    assert "LSH_PEER_SERIAL()" in contents["hall_config.hpp"]
+
+
+def test_can_link_selects_the_can_bridge_transport() -> None:
+    """A CAN link swaps the bridge UART for the MCP2515 transport defines."""
+    device_fields = """
+    features = { codec = "msgpack" }
+    can_link = { cs_pin = 53, int_pin = 2, node = 12, bitrate = 500 }
+    """
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(ProfileParts(device_fields=device_fields)),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+
+    device = project.devices["panel"]
+    defines = [render_define(define) for define in gen.merged_defines(project, device)]
+    assert "CONFIG_BRIDGE_CAN" in defines
+    assert "CONFIG_CAN_CS_PIN=53" in defines
+    assert "CONFIG_CAN_INT_PIN=2" in defines
+    assert "CONFIG_CAN_NODE_ID=12" in defines
+    assert "CONFIG_CAN_BITRATE_KBPS=500" in defines
+    contents = {path.name: content for path, content in files.items()}
+    panel_static = contents["panel_static_config.hpp"]
+    assert '#include "communication/bridge_transport.hpp"' in panel_static
+    assert "CONFIG_COM_SERIAL->" not in panel_static
+
+
+def test_touch_buttons_sweep_the_adc_and_feed_the_click_fsm() -> None:
+    """Touch pads share one ADC sweep and drive the regular click detection."""
+    clickables = """
+    [devices.panel.buttons.pad]
+    id = 1
+    pin = "A8"
+    short = "relay"
+    touch = true
+
+    [devices.panel.buttons.hob]
+    id = 2
+    pin = "A9"
+    short = "relay"
+    touch = { threshold = 40 }
+    """
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(ProfileParts(clickables=clickables)),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+
+    static_header = next(
+        content
+        for path, content in files.items()
+        if path.name == "panel_static_config.hpp"
+    )
+    assert "#define LSH_STATIC_CONFIG_TOUCH_KEYS 2" in static_header
+    assert "LSH_TOUCH_KEY(button0_padTouch);" in static_header
+    assert "button0_padTouch.update(touchSamples[0]);" in static_header
+    assert "button1_hobTouch.update<40U>(touchSamples[1]);" in static_header
+    assert "TouchSense::startSweep(::lsh::core::PinTag<(A8)>{});" in static_header
+    isr = static_header[static_header.index("ISR(ADC_vect)") :]
+    assert isr.index("if (step >= 4U)") < isr.index("touchStep = static_cast")
+    assert "TouchSense::precharge(::lsh::core::PinTag<(A9)>{});" in static_header
+    assert "    serviceTouchKeys();" in static_header
+    assert "(button1_hobTouch.pressed(), elapsed_ms);" in static_header
+
+
+def test_matrix_keys_scan_one_row_per_timer_tick() -> None:
+    """Matrix keys share row and column pins and read the debounced bitmap."""
+    clickables = """
+    [devices.panel.buttons.up]
+    id = 1
+    key = { row = 0, column = 1 }
+    short = "relay"
+
+    [devices.panel.buttons.down]
+    id = 2
+    key = { row = 2, column = 0 }
+    short = "relay"
+    """
+    device_fields = 'key_matrix = { rows = ["9", "10", "11"], columns = ["7", "8"] }'
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(
+                ProfileParts(device_fields=device_fields, clickables=clickables)
+            ),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+
+    static_header = next(
+        content
+        for path, content in files.items()
+        if path.name == "panel_static_config.hpp"
+    )
+    assert "#define LSH_STATIC_CONFIG_MATRIX_KEYS 2" in static_header
+    assert "LSH_MATRIX_BUTTON(button0_up);" in static_header
+    assert "LSH_KEY_MATRIX(keyMatrix, 3U, false);" in static_header
+    assert (
+        "    static_assert(!KeyMatrixIo::isCompareOutputPin((7)), "
+        '"The OC0B pin cannot be a key matrix line.");'
+    ) in static_header
+    assert "ISR(TIMER0_COMPB_vect)" in static_header
+    assert "KeyMatrixIo::columnBit(::lsh::core::PinTag<(8)>{}, 1U);" in static_header
+    assert (
+        "        KeyMatrixIo::releaseRow(::lsh::core::PinTag<(11)>{});\n"
+        "        KeyMatrixIo::driveRow(::lsh::core::PinTag<(9)>{});"
+    ) in static_header
+    assert "(keyMatrix.pressed<2U, 0U>(), elapsed_ms);" in static_header
+    assert "    startKeyMatrix();" in static_header
+
+
+def test_scan_slices_split_large_panels_across_scan_ticks() -> None:
+    """A dense panel scans one slice per tick, each with its own elapsed time."""
+    clickables = "".join(
+        f"""
+    [devices.panel.buttons.button_{index}]
+    pin = "{index + 2}"
+    short = "relay"
+    """
+        for index in range(120)
+    )
+    slice_count = 4
+    device_fields = f"""
+    scan_slices = {slice_count}
+
+    [devices.panel.features]
+    compact_buttons = true
+    """
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(
+                ProfileParts(device_fields=device_fields, clickables=clickables)
+            ),
+        )
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+
+    static_header = next(
+        content
+        for path, content in files.items()
+        if path.name == "panel_static_config.hpp"
+    )
+    slices = static_header.split("static auto scanClickableSlice")[1:]
+    assert len(slices) == slice_count
+    assert [body.count(".clickDetection<") for body in slices[:3]] == [30, 30, 30]
+    assert "static uint16_t clickableSliceAge_ms[4] = {};" in static_header
+    assert "static uint8_t clickableSliceTicks[4] = {};" in static_header
+    assert "        return scanClickableSlice3(sliceElapsed_ms, sliceTicks);" in (
+        static_header
+    )
+
+
+def test_bounce_profiles_become_per_button_debounce() -> None:
+    """Profiling builds expose the recorder; reports turn into debounce keys."""
+    debounce_ms = 8
+    clickables = (
+        DEFAULT_CLICKABLE
+        + f"""
+    debounce = "{debounce_ms}ms"
+    """
+    )
+    project_sections = """
+    [features]
+    bounce_profile = true
+    """
+    report = {
+        "panel": [
+            {"p": 24, "i": 1, "h": [12, 4, 9, 2, 0, 0], "x": 31, "w": 6},
+        ]
+    }
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        config_path = write_config(
+            Path(tmpdir),
+            minimal_profile(
+                ProfileParts(project_sections=project_sections, clickables=clickables)
+            ),
+        )
+        report_path = Path(tmpdir) / "bounces.json"
+        report_path.write_text(json.dumps(report), encoding="utf-8")
+        project = gen.parse_project(config_path)
+        files = gen.generated_files(project, ["panel"])
+        suggestion = gen.render_bounce_report(project, report_path)
+
+    assert project.devices["panel"].clickables[0].debounce_ms == debounce_ms
+    contents = {path.name: content for path, content in files.items()}
+    static_config = contents["panel_static_config.hpp"]
+    assert f", {debounce_ms}U>(elapsed_ms);" in static_config
+    assert "return &button0_button.getBounceProfile();" in static_config
+    defines = gen.merged_defines(project, project.devices["panel"])
+    assert "CONFIG_CLICKABLE_BOUNCE_PROFILE" in {define.name for define in defines}
+    assert suggestion == (
+        "[devices.panel.buttons.button]\n"
+        "# 27 edges, 31 bounces, longest window 6ms\n"
+        'debounce = "7ms"\n'
+    )
 
 
 def test_include_operand_defines_are_escaped_for_platformio_build_flags() -> None:
@@ -816,8 +1333,8 @@ def test_renders_extreme_static_profiles() -> None:
     id = 250
     pin = "9"
     short = false
-    long = { network = true, fallback = "do_nothing", after = "401ms" }
-    super_long = { network = true, fallback = "local", time_ms = 1200 }
+    long = { network = true, fallback = "none", after = "401ms", pending = "merge" }
+    super_long = { network = true, time_ms = 1200, pending = "queue" }
 
     [devices.panel.buttons.button_local]
     id = 2
@@ -841,6 +1358,7 @@ def test_renders_extreme_static_profiles() -> None:
                     [devices.panel.features]
                     codec = "msgpack"
                     fast_io = true
+                    compact_buttons = true
 
                     [devices.panel.timing]
                     actuator_debounce = "0ms"
@@ -862,6 +1380,24 @@ def test_renders_extreme_static_profiles() -> None:
     assert "#define LSH_STATIC_CONFIG_MAX_ACTUATOR_ID 255" in static_header
     assert "#define LSH_STATIC_CONFIG_ACTIVE_NETWORK_CLICKS 2" in static_header
     assert "button0_button_network.clickDetection<" in static_header
+    assert "Clickable::consumeElapsedTicks<3U>(elapsed_ms);" in static_header
+    assert (
+        "52U, 151U>(::lsh::core::PinTag<(9)>{}, elapsed_ms, elapsedTicks);"
+        in static_header
+    )
+    assert (
+        "0xC0U, 0x84U, 0xA1U, 0x70U, 0x03U, 0xA1U, 0x74U, 0x01U, 0xA1U, 0x69U, "
+        "0xCCU, 0xFAU,\n    0xA1U, 0x63U\n};" in static_header
+    )
+    assert (
+        "return writeGeneratedMsgPackMapPrefix("
+        "NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_1, timestamped);" in static_header
+    )
+    assert static_header.index(
+        "NETWORK_CLICK_REQUEST_JSON_PREFIX_0[]"
+    ) < static_header.index("DETAILS_JSON_PAYLOAD[]")
+    assert "if (slotIndex == 1U)\n    {\n        return 2U;" in static_header
+    assert "if (slotIndex == 0U)\n    {\n        return 1U;" in static_header
     assert "constants::clickDetection::makeFlags(false, true, true)" in static_header
     assert "setClickable" not in static_header
     assert "NoNetworkClickType::DO_NOTHING" not in static_header
@@ -1038,6 +1574,32 @@ def test_resource_names_are_independent_across_families() -> None:
             ),
             "long clicks need local targets or network=true",
         ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    clickables=DEFAULT_CLICKABLE.replace(
+                        'short = "relay"',
+                        'long = { targets = ["relay"], pending = "queue" }',
+                    ),
+                ),
+            ),
+            "pending requires network=true",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    device_fields="""
+                    [devices.panel.features]
+                    compact_buttons = true
+                    """,
+                    clickables=DEFAULT_CLICKABLE.replace(
+                        'short = "relay"',
+                        'long = { targets = ["relay"], after = "9s" }',
+                    ),
+                ),
+            ),
+            "compact_buttons cannot represent the 9000 ms click threshold",
+        ),
         (
             minimal_profile(
                 ProfileParts(
@@ -1164,6 +1726,256 @@ def test_resource_names_are_independent_across_families() -> None:
             ),
             "normalizes to duplicate device key",
         ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    actuators=DEFAULT_ACTUATOR + "protected = true\n",
+                    clickables=DEFAULT_CLICKABLE + 'priority_off = "relay"\n',
+                ),
+            ),
+            "protected actuators cannot be switched off by priority inputs",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    clickables=DEFAULT_CLICKABLE
+                    + """
+                    [devices.panel.encoders.knob]
+                    pin_a = "2"
+                    pin_b = "3"
+                    """,
+                ),
+            ),
+            "must declare levels, network = true, or both",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    clickables=DEFAULT_CLICKABLE
+                    + """
+                    [devices.panel.occupancy.hall_pir]
+                    pin = "4"
+                    targets = "relay"
+                    """,
+                ),
+            ),
+            "it is the occupancy hold time",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    clickables=DEFAULT_CLICKABLE
+                    + """
+                    [devices.panel.temperature.room]
+                    pin = "5"
+                    rom = "28:FF:64:1E:0F:16:03:90"
+
+                    [devices.panel.temperature.outdoor]
+                    pin = "5"
+                    """,
+                ),
+            ),
+            "shares pin 5 with other sensors and needs a rom",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    clickables=DEFAULT_CLICKABLE
+                    + """
+                    [devices.panel.temperature.room]
+                    pin = "5"
+                    rom = "28:FF:64:1E:0F:16:03:91"
+                    """,
+                ),
+            ),
+            "fails its CRC check",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(device_fields="can_link = { cs_pin = 10 }"),
+            ),
+            "can_link needs both cs_pin and int_pin",
+        ),
+        (
+            minimal_profile(ProfileParts(device_fields="scan_slices = 2")),
+            "scan_slices (2) cannot exceed the button count (1)",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    clickables=DEFAULT_CLICKABLE
+                    + 'touch = true\npriority_off = ["relay"]\n',
+                ),
+            ),
+            "cannot combine touch with priority_off",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    device_fields='key_matrix = { rows = ["4"], columns = ["5"] }',
+                    clickables="""
+                    [devices.panel.buttons.key]
+                    key = { row = 0, column = 1 }
+                    short = "relay"
+                    """,
+                ),
+            ),
+            "key (0, 1) lies outside the 1x1 matrix",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    controller_fields='hardware_include = "Controllino.h"',
+                    device_fields='key_matrix = { rows = ["D2"], columns = ["5"] }',
+                    clickables="""
+                    [devices.panel.buttons.key]
+                    key = { row = 0, column = 0 }
+                    short = "relay"
+                    """,
+                ),
+            ),
+            "pin CONTROLLINO_D2 is the OC0B pin",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    controller_fields='hardware_include = "<Controllino.h>"',
+                    device_fields='key_matrix = { rows = ["9"], columns = ["4"] }',
+                    clickables="""
+                    [devices.panel.buttons.key]
+                    key = { row = 0, column = 0 }
+                    short = "relay"
+                    """,
+                ),
+            ),
+            "pin 4 is the OC0B pin",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    device_fields='key_matrix = { rows = ["4"], columns = ["5"] }',
+                    clickables="""
+                    [devices.panel.buttons.key]
+                    key = { row = 0, column = 0 }
+                    short = "relay"
+                    """,
+                    extra_sections="""
+                    [devices.panel.temperature.room]
+                    pin = "5"
+                    """,
+                ),
+            ),
+            "pin 5 is also used by a 1-Wire bus",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    device_fields='key_matrix = { rows = ["4"], columns = ["A8"] }',
+                    clickables="""
+                    [devices.panel.buttons.key]
+                    key = { row = 0, column = 0 }
+                    short = "relay"
+
+                    [devices.panel.buttons.pad]
+                    pin = "A8"
+                    touch = true
+                    short = "relay"
+                    """,
+                ),
+            ),
+            "pin A8 is also used by a touch button",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    device_fields='key_matrix = { rows = ["4"], columns = ["5"] }',
+                    actuators="""
+                    [devices.panel.actuators.relay]
+                    pin = "6"
+                    auto_off = "10m"
+                    """,
+                    clickables="""
+                    [devices.panel.buttons.key]
+                    key = { row = 0, column = 0 }
+                    short = "relay"
+                    """,
+                    extra_sections="""
+                    [devices.panel.occupancy.hall_pir]
+                    pin = "4"
+                    targets = "relay"
+                    """,
+                ),
+            ),
+            "pin 4 is also used by an occupancy input",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    device_fields='peer_link = { serial = "Serial3", address = 1 }',
+                    clickables=DEFAULT_CLICKABLE
+                    + 'peer = { device = "attic", target = "relay" }\n',
+                ),
+            ),
+            "references unknown device 'attic'",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    device_fields='peer_link = { serial = "Serial", address = 1 }',
+                ),
+            ),
+            "peer_link.serial must differ from the debug serial",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    device_fields='peer_link = { serial = "Serial3", address = 1 }',
+                    clickables=DEFAULT_CLICKABLE
+                    + """
+                    peer = { device = "hall", targets = ["ceiling"] }
+
+                    [devices.hall]
+                    peer_link = { serial = "Serial2", address = 2, baud = 9600 }
+
+                    [devices.hall.actuators.ceiling]
+                    id = 7
+                    pin = "6"
+                    """,
+                ),
+            ),
+            "listens at 9600 baud, but devices.panel.peer_link sends at 115200",
+        ),
+        (
+            minimal_profile(
+                ProfileParts(
+                    device_fields='peer_link = { serial = "Serial3", address = 1 }',
+                    clickables=DEFAULT_CLICKABLE
+                    + """
+                    peer = { device = "hall", targets = ["ceiling"] }
+
+                    [devices.hall]
+                    peer_link = { serial = "Serial2", address = 2 }
+
+                    [devices.hall.actuators.ceiling]
+                    id = 7
+                    pin = "6"
+
+                    [devices.attic]
+                    peer_link = { serial = "Serial2", address = 3 }
+
+                    [devices.attic.actuators.lamp]
+                    id = 1
+                    pin = "7"
+
+                    [devices.attic.buttons.switch]
+                    pin = "A1"
+                    short = "lamp"
+                    peer = { device = "hall", targets = ["ceiling"] }
+                    """,
+                ),
+            ),
+            "devices.hall.peer_link already receives from devices.panel",
+        ),
     ],
 )
 def test_rejects_malformed_profiles_before_generation(
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""Expose one lsh-core CAN node as the framed serial stream lsh-bridge expects.
+
+The controller side of `CONFIG_BRIDGE_CAN` carries each MsgPack payload
+unescaped over standard CAN frames, see `src/communication/can_framing.hpp`.
+This shim listens on a Linux SocketCAN interface (a real adapter or `vcan0`),
+reassembles the frames of one node and replays them on a pseudo-terminal with
+the usual `0xC0`-delimited framing. Bytes written to the pseudo-terminal go
+the other way. Point lsh-bridge, or any serial test harness, at the printed
+pty path.
+
+    sudo ip link add dev vcan0 type vcan && sudo ip link set up vcan0
+    python3 tools/can_bridge_shim.py vcan0 --node 1
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import select
+import socket
+import struct
+import sys
+from pathlib import Path
+
+REPO_ROOT = Path(__file__).resolve().parent.parent
+PROTOCOL_SPEC = REPO_ROOT / "vendor" / "lsh-protocol" / "shared" / "lsh_protocol.json"
+
+FRAME_END = 0xC0
+FRAME_ESCAPE = 0xDB
+FRAME_ESCAPED_END = 0xDC
+FRAME_ESCAPED_ESCAPE = 0xDD
+
+PRIORITY_CLICK = 0
+PRIORITY_STATE = 1
+PRIORITY_CONTROL = 2
+PRIORITY_BULK = 3
+
+SEGMENT_START = 0x80
+SEGMENT_END = 0x40
+SEGMENT_SEQUENCE_MASK = 0x3F
+SEGMENT_PAYLOAD_BYTES = 7
+PRIORITY_HEADER_BYTES = 4  # `[fixmap][0xA1]['p'][command]`
+MAX_NODE = 127
+
+PRIORITY_CLASSES = {
+    "NETWORK_CLICK_REQUEST": PRIORITY_CLICK,
+    "NETWORK_CLICK_ACK": PRIORITY_CLICK,
+    "FAILOVER": PRIORITY_CLICK,
+    "FAILOVER_CLICK": PRIORITY_CLICK,
+    "NETWORK_CLICK_CONFIRM": PRIORITY_CLICK,
+    "ACTUATORS_STATE": PRIORITY_STATE,
+    "SET_STATE": PRIORITY_STATE,
+    "SET_SINGLE_ACTUATOR": PRIORITY_STATE,
+    "ENCODER_STEPS": PRIORITY_STATE,
+    "OCCUPANCY": PRIORITY_STATE,
+    "DEVICE_DETAILS": PRIORITY_BULK,
+    "RTT_HISTOGRAM": PRIORITY_BULK,
+    "TIMERS_STATE": PRIORITY_BULK,
+    "BOUNCE_PROFILE": PRIORITY_BULK,
+    "TEMPERATURES": PRIORITY_BULK,
+}
+
+CAN_FRAME_FORMAT = "=IB3x8s"
+CAN_FRAME_SIZE = struct.calcsize(CAN_FRAME_FORMAT)
+CAN_SFF_MASK = 0x7FF
+
+
+def load_priorities(spec_path: Path = PROTOCOL_SPEC) -> dict[int, int]:
+    """Map every command value that is not a control command to its class."""
+    spec = json.loads(spec_path.read_text(encoding="utf-8"))
+    return {
+        command["value"]: PRIORITY_CLASSES[command["name"]]
+        for command in spec["commands"]
+        if command["name"] in PRIORITY_CLASSES
+    }
+
+
+def can_identifier(priority: int, node: int, *, to_bridge: bool) -> int:
+    """Build the 11-bit identifier `[priority:3][node:7][toBridge:1]`."""
+    return ((priority & 0x07) << 8) | ((node & MAX_NODE) << 1) | int(to_bridge)
+
+
+def payload_priority(payload: bytes, priorities: dict[int, int]) -> int:
+    """Return the arbitration class of one `[fixmap][0xA1]['p'][cmd]` payload."""
+    if len(payload) < PRIORITY_HEADER_BYTES or payload[1:3] != b"\xa1p":
+        return PRIORITY_CONTROL
+    return priorities.get(payload[3], PRIORITY_CONTROL)
+
+
+def segment_payload(payload: bytes) -> list[bytes]:
+    """Split one payload into CAN data fields with their segment header."""
+    chunks = [
+        payload[offset : offset + SEGMENT_PAYLOAD_BYTES]
+        for offset in range(0, len(payload), SEGMENT_PAYLOAD_BYTES)
+    ]
+    frames = []
+    for sequence, chunk in enumerate(chunks):
+        header = sequence & SEGMENT_SEQUENCE_MASK
+        if sequence == 0:
+            header |= SEGMENT_START
+        if sequence == len(chunks) - 1:
+            header |= SEGMENT_END
+        frames.append(bytes([header]) + chunk)
+    return frames
+
+
+def frame_serial(payload: bytes) -> bytes:
+    """Wrap one payload in the serial delimiters and escapes."""
+    body = bytearray([FRAME_END])
+    for byte in payload:
+        if byte == FRAME_END:
+            body += bytes([FRAME_ESCAPE, FRAME_ESCAPED_END])
+        elif byte == FRAME_ESCAPE:
+            body += bytes([FRAME_ESCAPE, FRAME_ESCAPED_ESCAPE])
+        else:
+            body.append(byte)
+    body.append(FRAME_END)
+    return bytes(body)
+
+
+class Reassembler:
+    """Rebuild payloads from the segments of one controller."""
+
+    def __init__(self) -> None:
+        """Start without a payload in progress."""
+        self._payload = bytearray()
+        self._sequence = 0
+        self._assembling = False
+
+    def feed(self, data: bytes) -> bytes | None:
+        """Fold one data field and return the payload it completes, if any."""
+        if not data:
+            return None
+        header = data[0]
+        if header & SEGMENT_START:
+            self._payload.clear()
+            self._sequence = 0
+            self._assembling = True
+        if not self._assembling or header & SEGMENT_SEQUENCE_MASK != self._sequence:
+            self._assembling = False
+            return None
+        self._payload += data[1:]
+        self._sequence = (self._sequence + 1) & SEGMENT_SEQUENCE_MASK
+        if not header & SEGMENT_END:
+            return None
+        self._assembling = False
+        return bytes(self._payload)
+
+
+class SerialDeframer:
+    """Extract payloads from the delimited serial stream written by the bridge."""
+
+    def __init__(self) -> None:
+        """Start outside any frame."""
+        self._payload = bytearray()
+        self._escape = False
+
+    def feed(self, chunk: bytes) -> list[bytes]:
+        """Consume raw serial bytes and return every completed payload."""
+        payloads = []
+        for byte in chunk:
+            if byte == FRAME_END:
+                if self._payload:
+                    payloads.append(bytes(self._payload))
+                self._payload.clear()
+                self._escape = False
+            elif byte == FRAME_ESCAPE:
+                self._escape = True
+            elif self._escape:
+                self._escape = False
+                self._payload.append(
+                    FRAME_END if byte == FRAME_ESCAPED_END else FRAME_ESCAPE
+                )
+            else:
+                self._payload.append(byte)
+        return payloads
+
+
+def run(interface: str, node: int) -> None:
+    """Bridge one SocketCAN interface and a fresh pseudo-terminal until killed."""
+    priorities = load_priorities()
+    can_socket = socket.socket(socket.AF_CAN, socket.SOCK_RAW, socket.CAN_RAW)
+    can_socket.bind((interface,))
+    master, slave = os.openpty()
+    sys.stdout.write(f"node {node} on {interface} <-> {os.ttyname(slave)}\n")
+    sys.stdout.flush()
+
+    reassembler = Reassembler()
+    deframer = SerialDeframer()
+    while True:
+        readable, _, _ = select.select([can_socket, master], [], [])
+        if can_socket in readable:
+            raw = can_socket.recv(CAN_FRAME_SIZE)
+            can_id, length, data = struct.unpack(CAN_FRAME_FORMAT, raw)
+            is_standard = can_id & socket.CAN_EFF_FLAG == 0
+            from_node = (can_id >> 1) & MAX_NODE == node and can_id & 0x01
+            if is_standard and from_node:
+                payload = reassembler.feed(data[:length])
+                if payload:
+                    os.write(master, frame_serial(payload))
+        if master in readable:
+            for payload in deframer.feed(os.read(master, 256)):
+                priority = payload_priority(payload, priorities)
+                can_id = can_identifier(priority, node, to_bridge=False)
+                for data in segment_payload(payload):
+                    frame = struct.pack(
+                        CAN_FRAME_FORMAT, can_id & CAN_SFF_MASK, len(data), data
+                    )
+                    can_socket.send(frame)
+
+
+def main(argv: list[str] | None = None) -> int:
+    """Parse arguments and run the shim."""
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("interface", help="SocketCAN interface, e.g. can0 or vcan0.")
+    parser.add_argument(
+        "--node", type=int, default=1, help=f"Controller node address, 1..{MAX_NODE}."
+    )
+    args = parser.parse_args(argv)
+    if not 1 <= args.node <= MAX_NODE:
+        parser.error(f"--node must be in 1..{MAX_NODE}.")
+    if not hasattr(socket, "AF_CAN"):
+        parser.error("SocketCAN is only available on Linux.")
+    try:
+        run(args.interface, args.node)
+    except KeyboardInterrupt:
+        return 0
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
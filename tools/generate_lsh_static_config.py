@@ -35,6 +35,7 @@ from tools.lsh_static_config import (
     project_schema,
     project_schema_json,
     raw_build_flags,
+    render_bounce_report,
     render_device_config,
     render_diagnostics,
     render_escaped_build_flag_define,
@@ -75,6 +76,7 @@ __all__ = [
     "project_schema",
     "project_schema_json",
     "raw_build_flags",
+    "render_bounce_report",
     "render_device_config",
     "render_diagnostics",
     "render_escaped_build_flag_define",
@@ -2,6 +2,7 @@
 
 from __future__ import annotations
 
+from .bounce_report import render_bounce_report
 from .cli import main, parse_args
 from .doctor import diagnose_project, render_diagnostics
 from .emitter import generate, write_if_changed
@@ -69,6 +70,7 @@ __all__ = [
     "project_schema",
     "project_schema_json",
     "raw_build_flags",
+    "render_bounce_report",
     "render_device_config",
     "render_diagnostics",
     "render_escaped_build_flag_define",
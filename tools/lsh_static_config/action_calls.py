@@ -109,7 +109,6 @@ def render_pulse_storage(device: DeviceConfig) -> list[str]:
         return []
     return [
         "static uint16_t pulseRemaining_ms[CONFIG_PULSE_STORAGE_CAPACITY] = {};",
-        "static uint8_t activePulseActuators = 0U;",
     ]
 
 
@@ -173,7 +172,7 @@ def render_pulse_set_lines(
         "        {",
         "            if (!pulseWasActive)",
         "            {",
-        "                ++activePulseActuators;",
+        "                ++hotLoopState::activePulseActuators();",
         "            }",
         f"            pulseRemaining_ms[{u8(pulse_index)}] = {u16(pulse_ms)};",
         "        }",
@@ -183,7 +182,7 @@ def render_pulse_set_lines(
         f"        if (pulseRemaining_ms[{u8(pulse_index)}] != 0U)",
         "        {",
         f"            pulseRemaining_ms[{u8(pulse_index)}] = 0U;",
-        "            --activePulseActuators;",
+        "            --hotLoopState::activePulseActuators();",
         "        }",
         (
             f"        anyActuatorChangedState |= {object_name}"
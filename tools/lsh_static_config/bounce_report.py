@@ -0,0 +1,93 @@
+"""Turn captured BOUNCE_PROFILE payloads into per-button debounce settings."""
+
+from __future__ import annotations
+
+import json
+from typing import TYPE_CHECKING
+
+from .errors import fail
+from .platformio import resolve_device_key
+
+if TYPE_CHECKING:
+    from pathlib import Path
+
+    from .models import DeviceConfig, ProjectConfig
+
+BOUNCE_PROFILE_COMMAND = 24
+BOUNCE_PROFILE_BUCKETS = 6
+SATURATED_WINDOW_MS = 255
+DEFAULT_SCAN_INTERVAL_MS = 1
+
+
+def render_bounce_report(project: ProjectConfig, report_path: Path) -> str:
+    """Render TOML button snippets with the minimum safe debounce per input.
+
+    The report is a JSON object keyed by device, each value a list of
+    BOUNCE_PROFILE payloads as captured from the bridge. The suggested
+    debounce is the longest recorded edge window plus one scan interval, the
+    profile resolution. Inputs without edges, or whose window saturated, are
+    listed as comments so they are not tuned from unusable data.
+    """
+    try:
+        raw = json.loads(report_path.read_text(encoding="utf-8"))
+    except (OSError, ValueError) as exc:
+        fail(f"cannot read bounce report {report_path}: {exc}")
+    if not isinstance(raw, dict):
+        fail("bounce report must be a JSON object keyed by device.")
+
+    lines: list[str] = []
+    for requested, payloads in raw.items():
+        device = project.devices[resolve_device_key(project, str(requested))]
+        if not isinstance(payloads, list):
+            fail(f"bounce report entry {requested!r} must be a list of payloads.")
+        for payload in payloads:
+            lines.extend(_render_button(project, device, payload, str(requested)))
+    return "\n".join(lines).rstrip("\n") + "\n" if lines else ""
+
+
+def _render_button(
+    project: ProjectConfig,
+    device: DeviceConfig,
+    payload: object,
+    path: str,
+) -> list[str]:
+    """Render the debounce suggestion of one BOUNCE_PROFILE payload."""
+    if not isinstance(payload, dict) or payload.get("p") != BOUNCE_PROFILE_COMMAND:
+        fail(f"bounce report entry {path!r} holds a non BOUNCE_PROFILE payload.")
+    histogram = payload.get("h")
+    window_ms = payload.get("w")
+    if (
+        not isinstance(histogram, list)
+        or len(histogram) != BOUNCE_PROFILE_BUCKETS
+        or not all(isinstance(count, int) for count in histogram)
+        or not isinstance(window_ms, int)
+    ):
+        fail(f"bounce report entry {path!r} holds a malformed payload.")
+    clickable = next(
+        (item for item in device.clickables if item.clickable_id == payload.get("i")),
+        None,
+    )
+    if clickable is None:
+        fail(f"devices.{device.key} has no button with ID {payload.get('i')!r}.")
+
+    table = f"[devices.{device.key}.buttons.{clickable.name}]"
+    edges = sum(histogram)
+    if edges == 0:
+        return [f"# {table}: no edges recorded, keep the default debounce.", ""]
+    if window_ms >= SATURATED_WINDOW_MS:
+        return [f"# {table}: edge window saturated, check the wiring.", ""]
+    scan_interval = device.defines.get(
+        "CONFIG_CLICKABLE_SCAN_INTERVAL_MS",
+        project.common_defines.get("CONFIG_CLICKABLE_SCAN_INTERVAL_MS"),
+    )
+    margin_ms = (
+        scan_interval if isinstance(scan_interval, int) else DEFAULT_SCAN_INTERVAL_MS
+    )
+    debounce_ms = min(window_ms + max(margin_ms, 1), SATURATED_WINDOW_MS)
+    bounces = payload.get("x", 0)
+    return [
+        table,
+        f"# {edges} edges, {bounces} bounces, longest window {window_ms}ms",
+        f'debounce = "{debounce_ms}ms"',
+        "",
+    ]
@@ -7,6 +7,7 @@ import sys
 from pathlib import Path
 from typing import TYPE_CHECKING, cast
 
+from .bounce_report import render_bounce_report
 from .doctor import diagnose_project, render_diagnostics
 from .emitter import generate
 from .errors import ConfigError, fail
@@ -124,6 +125,12 @@ def parse_args(argv: Sequence[str]) -> argparse.Namespace:
         action="store_true",
         help="print non-fatal configuration advice and exit",
     )
+    parser.add_argument(
+        "--bounce-report",
+        metavar="PATH",
+        type=Path,
+        help="print per-button debounce settings from captured bounce profiles",
+    )
     parser.add_argument(
         "--format-config",
         action="store_true",
@@ -248,6 +255,9 @@ def _dispatch_project_command(
     if args.doctor:
         sys.stdout.write(render_diagnostics(diagnose_project(project)))
         return 0
+    if args.bounce_report is not None:
+        sys.stdout.write(render_bounce_report(project, args.bounce_report))
+        return 0
     selected = _selected_devices(project, args.device)
     return generate(project, selected, check=args.check)
 
@@ -535,6 +535,44 @@ def render_get_network_click_type(profile: StaticProfileData) -> list[str]:
     return lines
 
 
+def render_get_network_click_queue_depth(
+    device: DeviceConfig,
+    profile: StaticProfileData,
+) -> list[str]:
+    """Render fixed network-click slot to follow-up queue depth lookup."""
+    values = [
+        (
+            device.clickables[clickable_index].long
+            if click_type == "LONG"
+            else device.clickables[clickable_index].super_long
+        ).queue_depth
+        for clickable_index, click_type in profile.network_click_slots
+    ]
+    lines = [
+        "auto getNetworkClickQueueDepth(uint8_t slotIndex) noexcept -> uint8_t",
+        "{",
+    ]
+    if not values or all(value == 0 for value in values):
+        lines.extend(["    static_cast<void>(slotIndex);", "    return 0U;", "}"])
+        return lines
+
+    for value in sorted(set(values), reverse=True):
+        if value == 0:
+            continue
+        indexes = [index for index, item in enumerate(values) if item == value]
+        lines.extend(
+            [
+                f"    if ({render_values_condition('slotIndex', indexes)})",
+                "    {",
+                f"        return {u8(value)};",
+                "    }",
+                "",
+            ]
+        )
+    lines.extend(["    return 0U;", "}"])
+    return lines
+
+
 def render_is_clickable_configuration_valid(
     device: DeviceConfig,
     profile: StaticProfileData,
@@ -570,8 +608,10 @@ def render_is_clickable_configuration_valid(
             or bool(profile.long_step_sets[clickable_index])
             or super_long_local
         )
-        has_network_action = (clickable.long.enabled and clickable.long.network) or (
-            clickable.super_long.enabled and clickable.super_long.network
+        has_network_action = (
+            (clickable.long.enabled and clickable.long.network)
+            or (clickable.super_long.enabled and clickable.super_long.network)
+            or clickable.peer is not None
         )
         if has_enabled_click and (has_local_action or has_network_action):
             valid_indexes.append(clickable_index)
@@ -15,11 +15,15 @@ from .constants import (
     DEFAULT_SUPER_LONG_CLICK_MS,
 )
 from .cpp import u8, u16
+from .key_matrix import matrix_key_level
+from .peer_links import render_peer_send_lines
 from .topology import (
     actuator_name_at,
     clickable_object_name,
     unprotected_actuator_indexes,
 )
+from .touch import touch_key_object_name, touch_keys
+from .validation import compact_click_tick_shift, compact_click_ticks
 
 if TYPE_CHECKING:
     from collections.abc import Callable, Sequence
@@ -32,6 +36,11 @@ def click_action_time_ms(action: ClickAction, default_ms: int) -> int:
     return action.time_ms if action.time_ms is not None else default_ms
 
 
+def uses_compact_clickables(device: DeviceConfig) -> bool:
+    """Return true when clickables keep press ages in shared coarse ticks."""
+    return device.defines.get("CONFIG_COMPACT_CLICKABLES") is True
+
+
 def render_detection_flags(clickable: ClickableConfig) -> str:
     """Render a compile-time clickable FSM flag expression."""
     return (
@@ -313,11 +322,42 @@ def render_scan_clickable(
         clickable.super_long,
         DEFAULT_SUPER_LONG_CLICK_MS,
     )
-    click_detection_call = (
-        f"{object_name}.clickDetection<"
-        f"{render_detection_flags(clickable)}, {u16(long_time_ms)}, "
-        f"{u16(super_long_time_ms)}>(elapsed_ms);"
+    # Buttons without their own debounce keep the global default argument.
+    debounce_arg = (
+        "" if clickable.debounce_ms is None else f", {u8(clickable.debounce_ms)}"
+    )
+    # Touch and matrix buttons feed the FSM from a sampled level, not a pin read.
+    sampled_level = (
+        f"{touch_key_object_name(clickable_index, clickable)}.pressed()"
+        if clickable.touch
+        else matrix_key_level(clickable)
     )
+    if uses_compact_clickables(device):
+        pin_tag = f"::lsh::core::PinTag<({clickable.pin})>{{}}"
+        tick_shift = compact_click_tick_shift(device)
+        long_ticks = (
+            compact_click_ticks(long_time_ms, tick_shift)
+            if clickable.long.enabled
+            else 0
+        )
+        super_long_ticks = (
+            compact_click_ticks(super_long_time_ms, tick_shift)
+            if clickable.super_long.enabled
+            else 0
+        )
+        click_detection_call = (
+            f"{object_name}.clickDetection<"
+            f"{render_detection_flags(clickable)}, {u16(long_ticks)}, "
+            f"{u16(super_long_ticks)}{debounce_arg}>"
+            f"({sampled_level or pin_tag}, elapsed_ms, elapsedTicks);"
+        )
+    else:
+        click_detection_call = (
+            f"{object_name}.clickDetection<"
+            f"{render_detection_flags(clickable)}, {u16(long_time_ms)}, "
+            f"{u16(super_long_time_ms)}{debounce_arg}>"
+            f"({sampled_level + ', ' if sampled_level else ''}elapsed_ms);"
+        )
     assignment_line = f"    const auto {result_name} = {click_detection_call}"
     if len(f"    {assignment_line}") <= CLANG_FORMAT_COLUMN_LIMIT:
         detection_lines = [assignment_line]
@@ -334,6 +374,7 @@ def render_scan_clickable(
                 "    case ClickResult::SHORT_CLICK_QUICK:",
                 "    {",
                 *render_click_debug_log(clickable, "SHORT"),
+                *render_peer_send_lines(clickable),
                 *render_short_local_action(device, profile, clickable_index),
                 "    }",
                 "    break;",
@@ -392,25 +433,206 @@ def render_scan_clickables(
     device: DeviceConfig, profile: StaticProfileData
 ) -> list[str]:
     """Render the generated, topology-specialized clickable scanner."""
-    lines = ["auto scanClickables(uint16_t elapsed_ms) noexcept -> uint8_t", "{"]
+    signature = "auto scanClickables(uint16_t elapsed_ms) noexcept -> uint8_t"
     if not device.clickables:
-        lines.extend(["    static_cast<void>(elapsed_ms);", "    return 0U;", "}"])
-        return lines
-
-    lines.extend(
-        [
-            "    using constants::ClickResult;",
-            "    using namespace Debug;",
-            "    uint8_t scanResultFlags = 0U;",
-            "",
+        return [
+            signature,
+            "{",
+            "    static_cast<void>(elapsed_ms);",
+            "    return 0U;",
+            "}",
         ]
+    if device.scan_slices > 1:
+        return render_sliced_scan_clickables(device, profile)
+
+    lines = [signature, "{", *render_scan_locals()]
+    if touch_keys(device):
+        lines.append("    serviceTouchKeys();")
+    if uses_compact_clickables(device):
+        lines.append(render_consume_elapsed_ticks(device))
+    lines.extend(render_scan_blocks(device, profile, range(len(device.clickables))))
+    lines.append("}")
+    return lines
+
+
+def render_scan_locals() -> list[str]:
+    """Render the declarations every scan body starts with."""
+    return [
+        "    using constants::ClickResult;",
+        "    using namespace Debug;",
+        "    uint8_t scanResultFlags = 0U;",
+    ]
+
+
+def render_consume_elapsed_ticks(device: DeviceConfig) -> str:
+    """Render the shared compact tick update of one scan pass."""
+    return (
+        "    const uint8_t elapsedTicks = Clickable::consumeElapsedTicks<"
+        f"{u8(compact_click_tick_shift(device))}>(elapsed_ms);"
     )
-    for clickable_index in range(len(device.clickables)):
-        if clickable_index != 0:
+
+
+def render_scan_blocks(
+    device: DeviceConfig,
+    profile: StaticProfileData,
+    clickable_indexes: Sequence[int],
+) -> list[str]:
+    """Render the scan blocks of some clickables and the final result."""
+    lines = [""]
+    for position, clickable_index in enumerate(clickable_indexes):
+        if position != 0:
             lines.append("")
         lines.extend(
             line if line.startswith("#") else f"    {line}" if line else ""
             for line in render_scan_clickable(device, profile, clickable_index)
         )
-    lines.extend(["", "    return scanResultFlags;", "}"])
+    lines.extend(["", "    return scanResultFlags;"])
+    return lines
+
+
+def scan_slice_ranges(device: DeviceConfig) -> list[range]:
+    """Split the clickables into contiguous slices of nearly equal size."""
+    count = len(device.clickables)
+    slices = device.scan_slices
+    return [
+        range(slice_index * count // slices, (slice_index + 1) * count // slices)
+        for slice_index in range(slices)
+    ]
+
+
+def render_sliced_scan_clickables(
+    device: DeviceConfig, profile: StaticProfileData
+) -> list[str]:
+    """Render a scanner that runs one slice of the clickables per scan tick.
+
+    Every slice keeps its own age, grown by each pass and consumed only when the
+    slice runs, so debounce and click thresholds still see the exact time since
+    that slice was last sampled. The longest pass shrinks by the slice count.
+    """
+    compact = uses_compact_clickables(device)
+    slices = device.scan_slices
+    slice_args = "sliceElapsed_ms, sliceTicks" if compact else "sliceElapsed_ms"
+    slice_params = (
+        "uint16_t elapsed_ms, uint8_t elapsedTicks"
+        if compact
+        else "uint16_t elapsed_ms"
+    )
+    lines = [f"static uint16_t clickableSliceAge_ms[{slices}] = {{}};"]
+    if compact:
+        lines.append(f"static uint8_t clickableSliceTicks[{slices}] = {{}};")
+    lines.append("static uint8_t clickableScanSlice = 0U;")
+    for slice_index, clickable_indexes in enumerate(scan_slice_ranges(device)):
+        lines.extend(
+            [
+                "",
+                (
+                    f"[[nodiscard]] static auto scanClickableSlice{slice_index}"
+                    f"({slice_params}) noexcept -> uint8_t"
+                ),
+                "{",
+                *render_scan_locals(),
+                *render_scan_blocks(device, profile, clickable_indexes),
+                "}",
+            ]
+        )
+
+    lines.extend(
+        ["", "auto scanClickables(uint16_t elapsed_ms) noexcept -> uint8_t", "{"]
+    )
+    if touch_keys(device):
+        lines.append("    serviceTouchKeys();")
+    if compact:
+        lines.append(render_consume_elapsed_ticks(device))
+    lines.extend(
+        [
+            f"    for (uint8_t index = 0U; index < {u8(slices)}; ++index)",
+            "    {",
+            (
+                "        clickableSliceAge_ms[index] = "
+                "timeUtils::addElapsedTimeSaturated("
+                "clickableSliceAge_ms[index], elapsed_ms);"
+            ),
+        ]
+    )
+    if compact:
+        lines.extend(
+            [
+                (
+                    "        const uint16_t agedTicks = static_cast<uint16_t>("
+                    "clickableSliceTicks[index] + elapsedTicks);"
+                ),
+                (
+                    "        clickableSliceTicks[index] = agedTicks > UINT8_MAX ? "
+                    "UINT8_MAX : static_cast<uint8_t>(agedTicks);"
+                ),
+            ]
+        )
+    lines.extend(
+        [
+            "    }",
+            "    const uint8_t slice = clickableScanSlice;",
+            (
+                f"    clickableScanSlice = (slice + 1U < {u8(slices)}) ? "
+                "static_cast<uint8_t>(slice + 1U) : 0U;"
+            ),
+            "    const uint16_t sliceElapsed_ms = clickableSliceAge_ms[slice];",
+            "    clickableSliceAge_ms[slice] = 0U;",
+        ]
+    )
+    if compact:
+        lines.extend(
+            [
+                "    const uint8_t sliceTicks = clickableSliceTicks[slice];",
+                "    clickableSliceTicks[slice] = 0U;",
+            ]
+        )
+    lines.extend(["    switch (slice)", "    {"])
+    for slice_index in range(slices - 1):
+        lines.extend(
+            [
+                f"    case {u8(slice_index)}:",
+                f"        return scanClickableSlice{slice_index}({slice_args});",
+            ]
+        )
+    lines.extend(
+        [
+            "    default:",
+            f"        return scanClickableSlice{slices - 1}({slice_args});",
+            "    }",
+            "}",
+        ]
+    )
+    return lines
+
+
+def render_get_bounce_profile(device: DeviceConfig) -> list[str]:
+    """Render the BOUNCE_PROFILE reader, compiled only in profiling builds."""
+    lines = [
+        "#ifdef CONFIG_CLICKABLE_BOUNCE_PROFILE",
+        (
+            "auto getBounceProfile(uint8_t clickableIndex) noexcept "
+            "-> const BounceProfile *"
+        ),
+        "{",
+    ]
+    if not device.clickables:
+        lines.extend(
+            [
+                "    static_cast<void>(clickableIndex);",
+                "    return nullptr;",
+                "}",
+                "#endif",
+            ]
+        )
+        return lines
+    lines.extend(["    switch (clickableIndex)", "    {"])
+    for clickable_index, clickable in enumerate(device.clickables):
+        object_name = clickable_object_name(clickable_index, clickable)
+        lines.extend(
+            [
+                f"    case {clickable_index}U:",
+                f"        return &{object_name}.getBounceProfile();",
+            ]
+        )
+    lines.extend(["    default:", "        return nullptr;", "    }", "}", "#endif"])
     return lines
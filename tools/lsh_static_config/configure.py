@@ -5,6 +5,9 @@ from __future__ import annotations
 from typing import TYPE_CHECKING
 
 from .cpp import u8
+from .encoders import render_encoder_attach_lines
+from .key_matrix import render_key_matrix_start_lines
+from .priority_inputs import render_priority_input_attach_lines
 from .topology import (
     actuator_object_name,
     clickable_object_name,
@@ -130,6 +133,9 @@ def render_configure(device: DeviceConfig) -> list[str]:
     _append_configure_section(lines, _clickable_registration_lines(device))
     _append_configure_section(lines, _indicator_registration_lines(device))
     _append_configure_section(lines, _protected_actuator_lines(device))
+    _append_configure_section(lines, render_priority_input_attach_lines(device))
+    _append_configure_section(lines, render_encoder_attach_lines(device))
+    _append_configure_section(lines, render_key_matrix_start_lines(device))
 
     lines.append("}")
     return lines
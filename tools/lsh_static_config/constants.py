@@ -9,9 +9,17 @@ UINT16_MAX = 65535
 UINT32_MAX = 4294967295
 DEFAULT_LONG_CLICK_MS = 400
 DEFAULT_SUPER_LONG_CLICK_MS = 1000
+MAX_COMPACT_CLICK_TICK_SHIFT = 5
 MAX_INLINE_SUM_TERMS = 2
 CLANG_FORMAT_COLUMN_LIMIT = 140
 PROTOCOL_DEVICE_DETAILS = 1
+PROTOCOL_NETWORK_CLICK_REQUEST = 3
+PROTOCOL_CLICK_TYPES = {
+    "LONG": 1,
+    "SUPER_LONG": 2,
+}
+FNV1A32_OFFSET_BASIS = 0x811C9DC5
+FNV1A32_PRIME = 0x01000193
 MSGPACK_FRAME_END = 0xC0
 MSGPACK_FRAME_ESCAPE = 0xDB
 MSGPACK_FRAME_ESCAPED_END = 0xDC
@@ -24,6 +32,7 @@ IDENTIFIER_RE = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
 MACRO_RE = re.compile(r"^[A-Za-z_][A-Za-z0-9_]*$")
 DURATION_RE = re.compile(r"^\s*(\d+)\s*(ms|s|m|h)?\s*$", re.IGNORECASE)
 WIRE_PROTOCOL_MAJOR_RE = re.compile(r"WIRE_PROTOCOL_MAJOR\s*=\s*(\d+)U")
+ONE_WIRE_ROM_RE = re.compile(r"^[0-9A-Fa-f]{2}(?:[:-]?[0-9A-Fa-f]{2}){7}$")
 SAFE_CPP_EXPR_FORBIDDEN = set("{};#\"'\n\r")
 
 LONG_CLICK_TYPES = {
@@ -42,6 +51,26 @@ NETWORK_FALLBACKS = {
     "do_nothing": "DO_NOTHING",
 }
 
+NETWORK_PENDING_POLICIES = {
+    "drop": "DROP",
+    "merge": "MERGE",
+    "queue": "QUEUE",
+}
+DEFAULT_NETWORK_QUEUE_DEPTH = 2
+MAX_NETWORK_QUEUE_DEPTH = 15
+MAX_PRIORITY_INPUTS = 8
+MAX_TOUCH_KEYS = 16
+MAX_SCAN_SLICES = 16
+MAX_KEY_MATRIX_ROWS = 16
+MAX_KEY_MATRIX_COLUMNS = 8
+CONTROLLINO_OC0B_PINS = frozenset({"4", "CONTROLLINO_D2"})
+DEFAULT_ENCODER_STEPS_PER_DETENT = 4
+MAX_ENCODER_STEPS_PER_DETENT = 8
+MAX_ONE_WIRE_SENSORS_PER_BUS = 8
+MAX_PEER_ADDRESS = 254
+DEFAULT_PEER_SERIAL_BAUD = 115200
+PEER_OPERATIONS = {"TOGGLE", "ON", "OFF"}
+
 INDICATOR_MODES = {
     "any": "ANY",
     "all": "ALL",
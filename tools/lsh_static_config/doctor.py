@@ -16,6 +16,11 @@ SEMANTIC_DEFINE_HINTS = {
     "CONFIG_USE_FAST_CLICKABLES": "features.fast_buttons",
     "CONFIG_USE_FAST_ACTUATORS": "features.fast_actuators",
     "CONFIG_USE_FAST_INDICATORS": "features.fast_indicators",
+    "CONFIG_COMPACT_CLICKABLES": "features.compact_buttons",
+    "CONFIG_BRIDGE_HEALTH_PING": "features.health_ping",
+    "CONFIG_HOT_STATE_LAYOUT": "features.hot_state_layout",
+    "CONFIG_STATE_HANDOVER": "features.state_handover",
+    "CONFIG_CLICKABLE_BOUNCE_PROFILE": "features.bounce_profile",
     "CONFIG_ACTUATOR_DEBOUNCE_TIME_MS": "timing.actuator_debounce",
     "CONFIG_CLICKABLE_DEBOUNCE_TIME_MS": "timing.button_debounce",
     "CONFIG_CLICKABLE_SCAN_INTERVAL_MS": "timing.scan_interval",
@@ -27,6 +32,14 @@ SEMANTIC_DEFINE_HINTS = {
     "CONFIG_BRIDGE_BOOT_RETRY_INTERVAL_MS": "timing.bridge_boot_retry",
     "CONFIG_BRIDGE_AWAIT_STATE_TIMEOUT_MS": "timing.bridge_state_timeout",
     "CONFIG_DEBUG_SERIAL_BAUD": "serial.debug_baud",
+    "CONFIG_PEER_SERIAL_BAUD": "devices.<key>.peer_link.baud",
+    "CONFIG_BRIDGE_CAN": "devices.<key>.can_link",
+    "CONFIG_CAN_CS_PIN": "devices.<key>.can_link.cs_pin",
+    "CONFIG_CAN_INT_PIN": "devices.<key>.can_link.int_pin",
+    "CONFIG_CAN_NODE_ID": "devices.<key>.can_link.node",
+    "CONFIG_CAN_BITRATE_KBPS": "devices.<key>.can_link.bitrate",
+    "CONFIG_CAN_CRYSTAL_MHZ": "devices.<key>.can_link.crystal_mhz",
+    "CONFIG_CAN_TX_TIMEOUT_US": "devices.<key>.can_link.tx_timeout_us",
     "CONFIG_COM_SERIAL_BAUD": "serial.bridge_baud",
     "CONFIG_COM_SERIAL_TIMEOUT_MS": "serial.timeout",
     "CONFIG_COM_SERIAL_MSGPACK_FRAME_IDLE_TIMEOUT_MS": (
@@ -38,6 +51,8 @@ SEMANTIC_DEFINE_HINTS = {
     "CONFIG_DELAY_AFTER_RECEIVE_MS": "timing.post_receive_delay",
     "CONFIG_NETWORK_CLICK_CHECK_INTERVAL_MS": "timing.network_click_check_interval",
     "CONFIG_ACTUATORS_AUTO_OFF_CHECK_INTERVAL_MS": "timing.auto_off_check_interval",
+    "CONFIG_OCCUPANCY_REPORT_INTERVAL_MS": "timing.occupancy_report_interval",
+    "CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS": "timing.temperature_interval",
     "CONFIG_LSH_BENCH": "features.bench",
     "CONFIG_BENCH_ITERATIONS": "features.bench_iterations",
 }
@@ -0,0 +1,168 @@
+"""Render rotary encoder objects, their pin ISRs and the main-loop drain."""
+
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from .action_calls import render_cached_time_for_helper, render_set_state_call
+from .cpp import u8
+from .topology import actuator_name_at, encoder_object_name, target_indexes
+
+if TYPE_CHECKING:
+    from .models import DeviceConfig, EncoderConfig
+
+
+def encoder_isr_name(encoder_index: int, encoder: EncoderConfig) -> str:
+    """Return the generated ISR name shared by both pins of one encoder."""
+    return f"{encoder_object_name(encoder_index, encoder)}Isr"
+
+
+def has_network_encoders(device: DeviceConfig) -> bool:
+    """Return true when at least one encoder reports detents to the bridge."""
+    return any(encoder.network for encoder in device.encoders)
+
+
+def _pin_tags(encoder: EncoderConfig) -> str:
+    """Render the compile-time pin tag pair of one encoder."""
+    return (
+        f"::lsh::core::PinTag<({encoder.pin_a})>{{}}, "
+        f"::lsh::core::PinTag<({encoder.pin_b})>{{}}"
+    )
+
+
+def render_encoder_declarations(device: DeviceConfig) -> list[str]:
+    """Render one encoder object and one pin-only ISR per encoder."""
+    lines = [
+        f"LSH_ENCODER({encoder_object_name(index, encoder)}, "
+        f"{encoder.pin_a}, {encoder.pin_b});"
+        for index, encoder in enumerate(device.encoders)
+    ]
+    for index, encoder in enumerate(device.encoders):
+        lines.extend(
+            [
+                "",
+                f"void {encoder_isr_name(index, encoder)}() noexcept",
+                "{",
+                (
+                    f"    {encoder_object_name(index, encoder)}"
+                    f".onPinChange({_pin_tags(encoder)});"
+                ),
+                "}",
+            ]
+        )
+    return lines
+
+
+def _level_target_indexes(device: DeviceConfig, encoder: EncoderConfig) -> list[int]:
+    """Return dense actuator indexes of one encoder level bar, lowest first."""
+    actuator_indexes = {
+        actuator.name: index for index, actuator in enumerate(device.actuators)
+    }
+    return target_indexes(encoder.level_targets, actuator_indexes)
+
+
+def _render_level_lines(
+    device: DeviceConfig,
+    encoder_index: int,
+    encoder: EncoderConfig,
+) -> list[str]:
+    """Render the clamped level step for one encoder detent batch."""
+    indexes = _level_target_indexes(device, encoder)
+    if not indexes:
+        return []
+    level = f"level{encoder_index}"
+    lines = [f"        int16_t {level} = detents;"]
+    lines.extend(
+        f"        {level} += static_cast<int16_t>"
+        f"({actuator_name_at(device, index)}.getState());"
+        for index in indexes
+    )
+    lines.extend(
+        "        anyActuatorChangedState |= "
+        + render_set_state_call(
+            device,
+            actuator_index,
+            f"{level} > {rank}",
+            cached_time=True,
+        )
+        + ";"
+        for rank, actuator_index in enumerate(indexes)
+    )
+    return lines
+
+
+def _render_network_lines(encoder_index: int, encoder: EncoderConfig) -> list[str]:
+    """Render the batched bridge report of one network encoder."""
+    object_name = encoder_object_name(encoder_index, encoder)
+    return [
+        f"    if ({object_name}.networkSteps() != 0)",
+        "    {",
+        "        if (!BridgeSync::allowsMutatingCommands() ||",
+        (
+            f"            Serializer::serializeEncoderSteps({u8(encoder.encoder_id)}, "
+            f"{object_name}.networkSteps()))"
+        ),
+        "        {",
+        f"            {object_name}.clearNetworkSteps();",
+        "        }",
+        "    }",
+    ]
+
+
+def render_drain_encoders(device: DeviceConfig) -> list[str]:
+    """Render the main-loop drain that turns ISR transitions into actions."""
+    lines = ["auto drainEncoders() noexcept -> bool", "{"]
+    if not device.encoders:
+        lines.extend(["    return false;", "}"])
+        return lines
+
+    if any(encoder.level_targets for encoder in device.encoders):
+        lines.extend(render_cached_time_for_helper())
+    lines.extend(
+        ["    bool anyActuatorChangedState = false;", "    int8_t detents = 0;"]
+    )
+    for encoder_index, encoder in enumerate(device.encoders):
+        object_name = encoder_object_name(encoder_index, encoder)
+        lines.extend(
+            [
+                "",
+                (
+                    f"    detents = {object_name}"
+                    f".takeDetents<{u8(encoder.steps_per_detent)}>();"
+                ),
+                "    if (detents != 0)",
+                "    {",
+            ]
+        )
+        lines.extend(_render_level_lines(device, encoder_index, encoder))
+        if encoder.network:
+            lines.append(f"        {object_name}.addNetworkSteps(detents);")
+        lines.append("    }")
+        if encoder.network:
+            lines.extend(_render_network_lines(encoder_index, encoder))
+    lines.extend(["    return anyActuatorChangedState;", "}"])
+    return lines
+
+
+def render_encoder_attach_lines(device: DeviceConfig) -> list[str]:
+    """Render configure() statements that attach both pin ISRs of every encoder."""
+    lines: list[str] = []
+    for index, encoder in enumerate(device.encoders):
+        isr_name = encoder_isr_name(index, encoder)
+        for pin in (encoder.pin_a, encoder.pin_b):
+            lines.extend(
+                [
+                    "#ifdef NOT_AN_INTERRUPT",
+                    f"static_assert(digitalPinToInterrupt({pin}) != NOT_AN_INTERRUPT,",
+                    (
+                        f'              "Encoder {encoder.name} needs two pins '
+                        'with external interrupts.");'
+                    ),
+                    "#endif",
+                    (
+                        f"attachInterrupt(digitalPinToInterrupt({pin}), "
+                        f"{isr_name}, CHANGE);"
+                    ),
+                ]
+            )
+    return lines
@@ -29,6 +29,8 @@ CLICK_ACTION_FIELD_ORDER = (
     "scene",
     "network",
     "fallback",
+    "pending",
+    "queue_depth",
 )
 
 
@@ -7,7 +7,18 @@ from typing import TYPE_CHECKING
 
 from .configure import render_configure
 from .cpp import header_guard, render_banner, str_literal
-from .payloads import render_static_payload_arrays, render_static_payload_writer_helper
+from .encoders import has_network_encoders, render_encoder_declarations
+from .key_matrix import render_key_matrix_declarations, render_key_matrix_isr
+from .occupancy import has_network_occupancy, render_occupancy_declarations
+from .one_wire import render_one_wire_declarations, render_one_wire_isr
+from .payloads import (
+    render_msgpack_map_prefix_writer_helper,
+    render_network_click_request_arrays,
+    render_static_payload_arrays,
+    render_static_payload_writer_helper,
+)
+from .peer_links import has_peer_actions
+from .priority_inputs import render_priority_input_isrs
 from .profile import collect_static_profile_data
 from .resource_macros import render_static_resource_macros
 from .static_accessors import render_static_config_accessors
@@ -16,11 +27,18 @@ from .topology import (
     clickable_object_name,
     indicator_object_name,
 )
+from .touch import render_touch_declarations, render_touch_isr
 
 if TYPE_CHECKING:
     from collections.abc import Sequence
 
-    from .models import ActuatorConfig, DeviceConfig, ProjectConfig
+    from .models import (
+        ActuatorConfig,
+        ClickableConfig,
+        DeviceConfig,
+        ProjectConfig,
+        StaticProfileData,
+    )
 
 
 def render_user_config(project: ProjectConfig) -> str:
@@ -101,19 +119,41 @@ def render_device_config(device: DeviceConfig, project: ProjectConfig) -> str:
             f"    return {device.debug_serial};",
             "}",
             "",
-            f"#endif  // {guard}",
-            "",
         ],
     )
+    if device.peer_serial is not None:
+        lines.extend(
+            [
+                "static constexpr auto LSH_PEER_SERIAL() -> HardwareSerial *",
+                "{",
+                f"    return {device.peer_serial};",
+                "}",
+                "",
+            ]
+        )
+    lines.extend([f"#endif  // {guard}", ""])
     return "\n".join(lines)
 
 
-def render_object_declarations(device: DeviceConfig) -> list[str]:
-    """Render static Actuator, Clickable and Indicator object declarations."""
+def render_object_declarations(
+    device: DeviceConfig,
+    profile: StaticProfileData,
+) -> list[str]:
+    """Render static Actuator, Clickable, Indicator and input declarations."""
     lines = ["namespace", "{"]
+    # Hot tables first: within one flash section the linker keeps definition
+    # order, so request prefixes read on a long press land below the handshake
+    # payloads.
+    request_arrays = render_network_click_request_arrays(profile)
+    if request_arrays:
+        lines.extend(request_arrays)
+        lines.append("")
     lines.extend(render_static_payload_arrays(device))
     lines.append("")
     lines.extend(render_static_payload_writer_helper())
+    if request_arrays:
+        lines.append("")
+        lines.extend(render_msgpack_map_prefix_writer_helper())
     if device.actuators or device.clickables or device.indicators:
         lines.append("")
     lines.extend(
@@ -123,7 +163,7 @@ def render_object_declarations(device: DeviceConfig) -> list[str]:
     if device.actuators and device.clickables:
         lines.append("")
     lines.extend(
-        f"LSH_BUTTON({clickable_object_name(index, clickable)}, {clickable.pin});"
+        render_clickable_declaration(index, clickable)
         for index, clickable in enumerate(device.clickables)
     )
     if device.clickables and device.indicators:
@@ -132,7 +172,26 @@ def render_object_declarations(device: DeviceConfig) -> list[str]:
         f"LSH_INDICATOR({indicator_object_name(index, indicator)}, {indicator.pin});"
         for index, indicator in enumerate(device.indicators)
     )
+    for section in (
+        render_encoder_declarations(device),
+        render_occupancy_declarations(device),
+        render_one_wire_declarations(device),
+        render_priority_input_isrs(device),
+        render_touch_declarations(device),
+        render_key_matrix_declarations(device),
+    ):
+        if section:
+            lines.append("")
+            lines.extend(section)
     lines.append("}  // namespace")
+    for isr_lines in (
+        render_one_wire_isr(device),
+        render_touch_isr(device),
+        render_key_matrix_isr(device),
+    ):
+        if isr_lines:
+            lines.append("")
+            lines.extend(isr_lines)
     return lines
 
 
@@ -146,6 +205,14 @@ def render_actuator_declaration(index: int, actuator: ActuatorConfig) -> str:
     return f"LSH_ACTUATOR({object_name}, {actuator.pin});"
 
 
+def render_clickable_declaration(index: int, clickable: ClickableConfig) -> str:
+    """Render one generated clickable object declaration."""
+    object_name = clickable_object_name(index, clickable)
+    if clickable.matrix_key is not None:
+        return f"LSH_MATRIX_BUTTON({object_name});"
+    return f"LSH_BUTTON({object_name}, {clickable.pin});"
+
+
 def render_static_config(device: DeviceConfig, project: ProjectConfig) -> str:
     """Render the two-pass static profile consumed by lsh-core."""
     lines = render_banner(device.static_config_include, project.source_path)
@@ -180,11 +247,30 @@ def render_static_config(device: DeviceConfig, project: ProjectConfig) -> str:
     lines.extend(
         [
             '#include "communication/bridge_serial.hpp"',
+            '#include "communication/bridge_transport.hpp"',
+        ]
+    )
+    if (
+        has_network_encoders(device)
+        or has_network_occupancy(device)
+        or device.temperature
+    ):
+        lines.extend(
+            [
+                '#include "communication/bridge_sync.hpp"',
+                '#include "communication/serializer.hpp"',
+            ]
+        )
+    if has_peer_actions(device):
+        lines.append('#include "communication/peer_link.hpp"')
+    lines.extend(
+        [
             '#include "config/static_config.hpp"',
             '#include "core/network_clicks.hpp"',
             '#include "device/actuator_manager.hpp"',
             '#include "device/clickable_manager.hpp"',
             '#include "device/indicator_manager.hpp"',
+            '#include "internal/hot_loop_state.hpp"',
             '#include "lsh_user_macros.hpp"',
             '#include "util/constants/click_detection.hpp"',
             '#include "util/constants/click_results.hpp"',
@@ -195,7 +281,7 @@ def render_static_config(device: DeviceConfig, project: ProjectConfig) -> str:
             "",
             "#if defined(__AVR__)",
             "#include <avr/pgmspace.h>",
-            "#define LSH_STATIC_CONFIG_PROGMEM PROGMEM",
+            "#define LSH_STATIC_CONFIG_PROGMEM LSH_HOT_PROGMEM",
             "#define LSH_STATIC_CONFIG_READ_BYTE(address) pgm_read_byte(address)",
             "#else",
             "#define LSH_STATIC_CONFIG_PROGMEM",
@@ -204,7 +290,7 @@ def render_static_config(device: DeviceConfig, project: ProjectConfig) -> str:
             "",
         ],
     )
-    lines.extend(render_object_declarations(device))
+    lines.extend(render_object_declarations(device, profile))
     lines.extend(["", "namespace lsh::core::static_config", "{"])
     lines.extend(render_static_config_accessors(device, profile))
     lines.extend(["}  // namespace lsh::core::static_config", ""])
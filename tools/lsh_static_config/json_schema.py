@@ -6,6 +6,12 @@ import json
 import tomllib
 from typing import TYPE_CHECKING, cast
 
+from .constants import (
+    MAX_KEY_MATRIX_COLUMNS,
+    MAX_KEY_MATRIX_ROWS,
+    MAX_NETWORK_QUEUE_DEPTH,
+    MAX_SCAN_SLICES,
+)
 from .errors import fail
 from .presets import PRESETS
 
@@ -200,6 +206,12 @@ def _click_action_schema(
                     "time_ms": {"type": "integer", "minimum": 1},
                     "network": {"type": "boolean"},
                     "fallback": {"enum": ["local", "do_nothing", "none"]},
+                    "pending": {"enum": ["drop", "merge", "queue"]},
+                    "queue_depth": {
+                        "type": "integer",
+                        "minimum": 1,
+                        "maximum": MAX_NETWORK_QUEUE_DEPTH,
+                    },
                 },
             },
         ]
@@ -249,6 +261,9 @@ def _project_device_schema(device: TomlTable) -> JsonObject:
             "groups": group_names,
             "scenes": scene_names,
             "buttons": _resource_names(device.get("buttons"), tables_only=True),
+            "encoders": _resource_names(device.get("encoders"), tables_only=True),
+            "occupancy": _resource_names(device.get("occupancy"), tables_only=True),
+            "temperature": _resource_names(device.get("temperature"), tables_only=True),
             "indicators": _resource_names(device.get("indicators"), tables_only=True),
         },
     )
@@ -305,6 +320,14 @@ def _device_schema(
             "disable_rtc": {"type": "boolean"},
             "disable_eth": {"type": "boolean"},
             "controllino_pin_aliases": {"type": "boolean"},
+            "peer_link": _peer_link_schema(),
+            "can_link": _can_link_schema(),
+            "scan_slices": {
+                "type": "integer",
+                "minimum": 1,
+                "maximum": MAX_SCAN_SLICES,
+            },
+            "key_matrix": _key_matrix_schema(),
             "features": _features_schema(),
             "timing": _timing_schema(duration, positive_duration),
             "serial": _serial_schema(duration, positive_duration),
@@ -330,7 +353,19 @@ def _device_schema(
             ),
             "buttons": _named_resource_map(
                 names.get("buttons"),
-                _button_schema(click_action),
+                _button_schema(click_action, scene_target_value),
+            ),
+            "encoders": _named_resource_map(
+                names.get("encoders"),
+                _encoder_schema(scene_target_value),
+            ),
+            "occupancy": _named_resource_map(
+                names.get("occupancy"),
+                _occupancy_schema(scene_target_value),
+            ),
+            "temperature": _named_resource_map(
+                names.get("temperature"),
+                _temperature_schema(),
             ),
             "indicators": _named_resource_map(
                 names.get("indicators"),
@@ -393,6 +428,13 @@ def _features_schema() -> JsonObject:
             "fast_indicators": {"type": "boolean"},
             "bench": {"type": "boolean"},
             "bench_iterations": {"type": "integer", "minimum": 1},
+            "time_sync": {"type": "boolean"},
+            "echo_probe": {"type": "boolean"},
+            "compact_buttons": {"type": "boolean"},
+            "health_ping": {"type": "boolean"},
+            "hot_state_layout": {"type": "boolean"},
+            "state_handover": {"type": "boolean"},
+            "bounce_profile": {"type": "boolean"},
             "aggressive_constexpr_ctors": {
                 "oneOf": [{"type": "boolean"}, {"const": "auto"}]
             },
@@ -422,6 +464,8 @@ def _timing_schema(duration: object, positive_duration: object) -> JsonObject:
             "post_receive_delay": duration,
             "network_click_check_interval": positive_duration,
             "auto_off_check_interval": positive_duration,
+            "occupancy_report_interval": positive_duration,
+            "temperature_interval": positive_duration,
         },
     }
 
@@ -521,18 +565,180 @@ def _scene_schema(target_value: JsonObject) -> JsonObject:
     }
 
 
-def _button_schema(click_action: object) -> JsonObject:
+def _button_schema(click_action: object, priority_target: JsonObject) -> JsonObject:
     """Return the button-resource schema."""
     return {
         "type": "object",
         "additionalProperties": False,
-        "required": ["pin"],
+        "oneOf": [{"required": ["pin"]}, {"required": ["key"]}],
         "properties": {
             "id": {"type": "integer", "minimum": 1, "maximum": 255},
             "pin": {"type": "string", "minLength": 1},
+            "key": {
+                "type": "object",
+                "additionalProperties": False,
+                "required": ["row", "column"],
+                "properties": {
+                    "row": {
+                        "type": "integer",
+                        "minimum": 0,
+                        "maximum": MAX_KEY_MATRIX_ROWS - 1,
+                    },
+                    "column": {
+                        "type": "integer",
+                        "minimum": 0,
+                        "maximum": MAX_KEY_MATRIX_COLUMNS - 1,
+                    },
+                },
+            },
             "short": click_action,
             "long": click_action,
             "super_long": click_action,
+            "priority_off": priority_target,
+            "peer": _peer_action_schema(),
+            "debounce": _duration_schema(),
+            "touch": {
+                "oneOf": [
+                    {"type": "boolean"},
+                    {
+                        "type": "object",
+                        "additionalProperties": False,
+                        "properties": {
+                            "threshold": {
+                                "type": "integer",
+                                "minimum": 2,
+                                "maximum": 255,
+                            },
+                        },
+                    },
+                ]
+            },
+        },
+    }
+
+
+def _peer_link_schema() -> JsonObject:
+    """Return the device-level controller-to-controller link schema."""
+    return {
+        "type": "object",
+        "additionalProperties": False,
+        "required": ["serial", "address"],
+        "properties": {
+            "serial": {"type": "string", "minLength": 1},
+            "address": {"type": "integer", "minimum": 1, "maximum": 254},
+            "baud": {"type": "integer", "minimum": 1},
+        },
+    }
+
+
+def _key_matrix_schema() -> JsonObject:
+    """Return the device-level row/column key matrix schema."""
+    pin = {"type": "string", "minLength": 1}
+    return {
+        "type": "object",
+        "additionalProperties": False,
+        "required": ["rows", "columns"],
+        "properties": {
+            "rows": {
+                "type": "array",
+                "items": pin,
+                "minItems": 1,
+                "maxItems": MAX_KEY_MATRIX_ROWS,
+            },
+            "columns": {
+                "type": "array",
+                "items": pin,
+                "minItems": 1,
+                "maxItems": MAX_KEY_MATRIX_COLUMNS,
+            },
+            "diodes": {"type": "boolean"},
+        },
+    }
+
+
+def _can_link_schema() -> JsonObject:
+    """Return the device-level MCP2515 CAN bridge transport schema."""
+    return {
+        "type": "object",
+        "additionalProperties": False,
+        "required": ["cs_pin", "int_pin"],
+        "properties": {
+            "cs_pin": {"type": "integer", "minimum": 0, "maximum": 255},
+            "int_pin": {"type": "integer", "minimum": 0, "maximum": 255},
+            "node": {"type": "integer", "minimum": 1, "maximum": 127},
+            "bitrate": {"type": "integer", "minimum": 1, "maximum": 1000},
+            "crystal_mhz": {"type": "integer", "minimum": 1, "maximum": 40},
+            "tx_timeout_us": {"type": "integer", "minimum": 1, "maximum": 65535},
+        },
+    }
+
+
+def _peer_action_schema() -> JsonObject:
+    """Return the button short-click action sent to another controller."""
+    target_name = {"type": "string", "minLength": 1}
+    return {
+        "type": "object",
+        "additionalProperties": False,
+        "required": ["device"],
+        "properties": {
+            "device": {"type": "string", "minLength": 1},
+            "action": {"enum": ["toggle", "on", "off"], "default": "toggle"},
+            "target": target_name,
+            "targets": {"type": "array", "minItems": 1, "items": target_name},
+        },
+    }
+
+
+def _encoder_schema(level_target: JsonObject) -> JsonObject:
+    """Return the rotary-encoder-resource schema."""
+    return {
+        "type": "object",
+        "additionalProperties": False,
+        "required": ["pin_a", "pin_b"],
+        "properties": {
+            "id": {"type": "integer", "minimum": 1, "maximum": 255},
+            "pin_a": {"type": "string", "minLength": 1},
+            "pin_b": {"type": "string", "minLength": 1},
+            "steps_per_detent": {
+                "type": "integer",
+                "minimum": 1,
+                "maximum": 8,
+                "default": 4,
+            },
+            "levels": level_target,
+            "network": {"type": "boolean", "default": False},
+        },
+    }
+
+
+def _occupancy_schema(target: JsonObject) -> JsonObject:
+    """Return the occupancy-input-resource schema."""
+    return {
+        "type": "object",
+        "additionalProperties": False,
+        "required": ["pin"],
+        "properties": {
+            "id": {"type": "integer", "minimum": 1, "maximum": 255},
+            "pin": {"type": "string", "minLength": 1},
+            "targets": target,
+            "network": {"type": "boolean", "default": False},
+        },
+    }
+
+
+def _temperature_schema() -> JsonObject:
+    """Return the 1-Wire temperature-sensor-resource schema."""
+    return {
+        "type": "object",
+        "additionalProperties": False,
+        "required": ["pin"],
+        "properties": {
+            "id": {"type": "integer", "minimum": 1, "maximum": 255},
+            "pin": {"type": "string", "minLength": 1},
+            "rom": {
+                "type": "string",
+                "pattern": "^[0-9A-Fa-f]{2}([:-]?[0-9A-Fa-f]{2}){7}$",
+            },
         },
     }
 
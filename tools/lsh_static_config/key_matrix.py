@@ -0,0 +1,98 @@
+"""Render the key matrix, its row-scan interrupt and the matrix button reads."""
+
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from .cpp import u8
+
+if TYPE_CHECKING:
+    from .models import ClickableConfig, DeviceConfig
+
+KEY_MATRIX_OBJECT_NAME = "keyMatrix"
+
+
+def matrix_key_level(clickable: ClickableConfig) -> str | None:
+    """Return the debounced matrix read of one button, if it is a matrix key."""
+    if clickable.matrix_key is None:
+        return None
+    row, column = clickable.matrix_key
+    return f"{KEY_MATRIX_OBJECT_NAME}.pressed<{u8(row)}, {u8(column)}>()"
+
+
+def _pin_tag(pin: str) -> str:
+    """Render the compile-time pin tag of one matrix line."""
+    return f"::lsh::core::PinTag<({pin})>{{}}"
+
+
+def render_key_matrix_declarations(device: DeviceConfig) -> list[str]:
+    """Render the matrix object and the setup that starts its scan.
+
+    `startKeyMatrix()` leaves every row high impedance except the first one
+    and then enables the timer interrupt, which samples one row per tick.
+    """
+    matrix = device.key_matrix
+    if matrix is None:
+        return []
+
+    diodes = "true" if matrix.diodes else "false"
+    lines = [
+        f"LSH_KEY_MATRIX({KEY_MATRIX_OBJECT_NAME}, {u8(len(matrix.rows))}, {diodes});",
+        "",
+        "void startKeyMatrix() noexcept",
+        "{",
+    ]
+    lines.extend(
+        (
+            f"    static_assert(!KeyMatrixIo::isCompareOutputPin(({pin})), "
+            '"The OC0B pin cannot be a key matrix line.");'
+        )
+        for pin in [*matrix.rows, *matrix.columns]
+    )
+    lines.extend(
+        f"    KeyMatrixIo::pullUpColumn({_pin_tag(pin)});" for pin in matrix.columns
+    )
+    lines.extend(f"    KeyMatrixIo::idleRow({_pin_tag(pin)});" for pin in matrix.rows)
+    lines.extend(
+        [
+            f"    KeyMatrixIo::driveRow({_pin_tag(matrix.rows[0])});",
+            "    KeyMatrixIo::startTimer();",
+            "}",
+        ]
+    )
+    return lines
+
+
+def render_key_matrix_start_lines(device: DeviceConfig) -> list[str]:
+    """Render the configure() call that starts the matrix scan."""
+    return ["startKeyMatrix();"] if device.key_matrix is not None else []
+
+
+def render_key_matrix_isr(device: DeviceConfig) -> list[str]:
+    """Render the Timer0 compare-B interrupt that samples one row per tick."""
+    matrix = device.key_matrix
+    if matrix is None:
+        return []
+
+    lines = ["ISR(TIMER0_COMPB_vect)", "{", "    uint8_t columns = 0U;"]
+    lines.extend(
+        f"    columns |= KeyMatrixIo::columnBit({_pin_tag(pin)}, {u8(column)});"
+        for column, pin in enumerate(matrix.columns)
+    )
+    if len(matrix.rows) == 1:
+        lines.extend([f"    {KEY_MATRIX_OBJECT_NAME}.sample(columns);", "}"])
+        return lines
+
+    lines.extend([f"    switch ({KEY_MATRIX_OBJECT_NAME}.sample(columns))", "    {"])
+    for row, pin in enumerate(matrix.rows):
+        next_pin = matrix.rows[(row + 1) % len(matrix.rows)]
+        lines.extend(
+            [
+                f"    case {u8(row)}:",
+                f"        KeyMatrixIo::releaseRow({_pin_tag(pin)});",
+                f"        KeyMatrixIo::driveRow({_pin_tag(next_pin)});",
+                "        break;",
+            ]
+        )
+    lines.extend(["    default:", "        break;", "    }", "}"])
+    return lines
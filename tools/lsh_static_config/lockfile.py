@@ -1,6 +1,7 @@
 """Stable public-ID lockfile support for schema v2 profiles.
 
-The user-facing TOML may omit actuator and button IDs while sketching a device.
+The user-facing TOML may omit actuator, button, encoder, occupancy and temperature
+sensor IDs while sketching a device.
 This module keeps those IDs stable across later edits by storing the assigned
 wire IDs in a small generated lockfile beside `lsh_devices.toml`.
 """
@@ -20,7 +21,13 @@ if TYPE_CHECKING:
     from .models import TomlTable, TomlValue
 
 LOCK_SCHEMA_VERSION = 1
-LOCKED_RESOURCE_GROUPS = ("actuators", "buttons")
+LOCKED_RESOURCE_GROUPS = (
+    "actuators",
+    "buttons",
+    "encoders",
+    "occupancy",
+    "temperature",
+)
 
 
 @dataclass(frozen=True)
@@ -88,7 +95,7 @@ def _apply_group_lock(
     locked_group: TomlTable,
     path: str,
 ) -> tuple[dict[str, int], list[str]]:
-    """Apply one actuator/button lock table and return the new lock entries."""
+    """Apply one locked resource table and return the new lock entries."""
     if raw_resources is None:
         return {}, []
     resources = _table(raw_resources, path)
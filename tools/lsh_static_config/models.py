@@ -40,6 +40,8 @@ class ClickAction:
     click_type: str = "NORMAL"
     network: bool = False
     fallback: str = "LOCAL_FALLBACK"
+    pending: str = "DROP"
+    queue_depth: int = 0
     time_ms: int | None = None
 
 
@@ -69,6 +71,66 @@ class ClickableConfig:
     short_enabled: bool = False
     long: ClickAction = field(default_factory=ClickAction)
     super_long: ClickAction = field(default_factory=ClickAction)
+    priority_off_targets: list[str] = field(default_factory=list)
+    peer: PeerAction | None = None
+    debounce_ms: int | None = None
+    touch: bool = False
+    touch_threshold: int | None = None
+    matrix_key: tuple[int, int] | None = None
+
+
+@dataclass
+class PeerAction:
+    """Short-click action executed by another controller over the peer link."""
+
+    device: str
+    operation: str = "TOGGLE"
+    targets: list[str] = field(default_factory=list)
+    address: int = 0
+    actuator_ids: list[int] = field(default_factory=list)
+
+
+@dataclass
+class EncoderConfig:
+    """Normalized rotary encoder declaration from TOML."""
+
+    name: str
+    encoder_id: int
+    pin_a: str
+    pin_b: str
+    steps_per_detent: int = 4
+    level_targets: list[str] = field(default_factory=list)
+    network: bool = False
+
+
+@dataclass
+class OccupancyConfig:
+    """Normalized occupancy (PIR or presence) input declaration from TOML."""
+
+    name: str
+    occupancy_id: int
+    pin: str
+    targets: list[str] = field(default_factory=list)
+    network: bool = False
+
+
+@dataclass
+class TemperatureSensorConfig:
+    """Normalized 1-Wire temperature sensor declaration from TOML."""
+
+    name: str
+    sensor_id: int
+    pin: str
+    rom: list[int] | None = None
+
+
+@dataclass
+class KeyMatrixConfig:
+    """Row and column pins of the device key matrix."""
+
+    rows: list[str]
+    columns: list[str]
+    diodes: bool = False
 
 
 @dataclass
@@ -95,10 +157,17 @@ class DeviceConfig:
     static_config_include: str
     disable_rtc: bool = False
     disable_eth: bool = False
+    peer_serial: str | None = None
+    peer_address: int = 0
+    scan_slices: int = 1
+    key_matrix: KeyMatrixConfig | None = None
     defines: DefineMap = field(default_factory=dict)
     raw_build_flags: list[str] = field(default_factory=list)
     actuators: list[ActuatorConfig] = field(default_factory=list)
     clickables: list[ClickableConfig] = field(default_factory=list)
+    encoders: list[EncoderConfig] = field(default_factory=list)
+    occupancy: list[OccupancyConfig] = field(default_factory=list)
+    temperature: list[TemperatureSensorConfig] = field(default_factory=list)
     indicators: list[IndicatorConfig] = field(default_factory=list)
 
 
@@ -0,0 +1,104 @@
+"""Render occupancy inputs, their hold scan and the bridge summary."""
+
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from .action_calls import render_cached_time_for_helper, render_set_state_call
+from .cpp import u8
+from .topology import actuator_name_at, occupancy_object_name, target_indexes
+
+if TYPE_CHECKING:
+    from .models import DeviceConfig, OccupancyConfig
+
+
+def has_network_occupancy(device: DeviceConfig) -> bool:
+    """Return true when at least one occupancy input reports to the bridge."""
+    return any(occupancy.network for occupancy in device.occupancy)
+
+
+def _pin_tag(occupancy: OccupancyConfig) -> str:
+    """Render the compile-time pin tag of one occupancy input."""
+    return f"::lsh::core::PinTag<({occupancy.pin})>{{}}"
+
+
+def render_occupancy_declarations(device: DeviceConfig) -> list[str]:
+    """Render one occupancy input object per declared sensor."""
+    return [
+        f"LSH_OCCUPANCY({occupancy_object_name(index, occupancy)}, {occupancy.pin});"
+        for index, occupancy in enumerate(device.occupancy)
+    ]
+
+
+def _render_target_lines(
+    device: DeviceConfig,
+    occupancy: OccupancyConfig,
+    object_name: str,
+) -> list[str]:
+    """Render the rising-edge ON request and the held-level countdown restart."""
+    actuator_indexes = {
+        actuator.name: index for index, actuator in enumerate(device.actuators)
+    }
+    indexes = target_indexes(occupancy.targets, actuator_indexes)
+    lines = [f"    if ({object_name}.sampleRisingEdge({_pin_tag(occupancy)}))", "    {"]
+    lines.extend(
+        "        anyActuatorChangedState |= "
+        + render_set_state_call(device, actuator_index, "true", cached_time=True)
+        + ";"
+        for actuator_index in indexes
+    )
+    lines.extend(["    }", f"    if ({object_name}.active())", "    {"])
+    lines.extend(
+        (
+            f"        {actuator_name_at(device, actuator_index)}"
+            f".restartAutoOffStatic<{u8(actuator_index)}>(actionNow);"
+        )
+        for actuator_index in indexes
+    )
+    lines.append("    }")
+    return lines
+
+
+def render_scan_occupancy(device: DeviceConfig) -> list[str]:
+    """Render the per-millisecond sample that holds local auto-off timers."""
+    lines = ["auto scanOccupancy() noexcept -> bool", "{"]
+    if not device.occupancy:
+        lines.extend(["    return false;", "}"])
+        return lines
+
+    if any(occupancy.targets for occupancy in device.occupancy):
+        lines.extend(render_cached_time_for_helper())
+    lines.append("    bool anyActuatorChangedState = false;")
+    for index, occupancy in enumerate(device.occupancy):
+        object_name = occupancy_object_name(index, occupancy)
+        if not occupancy.targets:
+            lines.append(
+                f"    static_cast<void>({object_name}"
+                f".sampleRisingEdge({_pin_tag(occupancy)}));"
+            )
+            continue
+        lines.extend(_render_target_lines(device, occupancy, object_name))
+    lines.extend(["    return anyActuatorChangedState;", "}"])
+    return lines
+
+
+def render_report_occupancy(device: DeviceConfig) -> list[str]:
+    """Render the windowed bridge summary of every network occupancy input."""
+    lines = ["void reportOccupancy() noexcept", "{"]
+    for index, occupancy in enumerate(device.occupancy):
+        if not occupancy.network:
+            continue
+        object_name = occupancy_object_name(index, occupancy)
+        lines.extend(
+            [
+                f"    {object_name}.closeSummaryWindow(",
+                f"        !{object_name}.summaryChanged() ||",
+                "        (BridgeSync::allowsMutatingCommands() &&",
+                (
+                    f"         Serializer::serializeOccupancy("
+                    f"{u8(occupancy.occupancy_id)}, {object_name}.occupied())));"
+                ),
+            ]
+        )
+    lines.append("}")
+    return lines
@@ -0,0 +1,97 @@
+"""Render 1-Wire temperature buses, their flash tables and the loop poll."""
+
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from .cpp import u8
+from .payloads import render_byte_array
+from .topology import one_wire_bus_object_name, one_wire_buses
+
+if TYPE_CHECKING:
+    from .models import DeviceConfig, TemperatureSensorConfig
+
+
+def _pin_tag(bus: list[TemperatureSensorConfig]) -> str:
+    """Render the compile-time pin tag shared by every sensor of one bus."""
+    return f"::lsh::core::PinTag<({bus[0].pin})>{{}}"
+
+
+def render_one_wire_declarations(device: DeviceConfig) -> list[str]:
+    """Render the ID/ROM tables, reading storage and object of every bus.
+
+    A lone sensor without ROM code is addressed with SKIP ROM, so its bus
+    gets no ROM table at all.
+    """
+    lines: list[str] = []
+    for bus_index, bus in enumerate(one_wire_buses(device)):
+        object_name = one_wire_bus_object_name(bus_index)
+        lines.extend(
+            render_byte_array(f"{object_name}Ids", [sensor.sensor_id for sensor in bus])
+        )
+        roms = "nullptr"
+        if all(sensor.rom is not None for sensor in bus):
+            roms = f"{object_name}Roms"
+            lines.extend(
+                render_byte_array(
+                    roms, [byte for sensor in bus for byte in sensor.rom or ()]
+                )
+            )
+        lines.extend(
+            [
+                f"int16_t {object_name}Readings[{len(bus)}] = {{}};",
+                (
+                    f"LSH_ONE_WIRE_BUS({object_name}, {bus[0].pin}, {u8(len(bus))}, "
+                    f"{object_name}Ids, {roms}, {object_name}Readings);"
+                ),
+            ]
+        )
+    return lines
+
+
+def render_poll_one_wire(device: DeviceConfig) -> list[str]:
+    """Render the per-pass bus step and the report of every finished cycle."""
+    lines = ["void pollOneWire(uint16_t elapsed_ms) noexcept", "{"]
+    buses = one_wire_buses(device)
+    if not buses:
+        lines.extend(["    static_cast<void>(elapsed_ms);", "}"])
+        return lines
+
+    for bus_index in range(len(buses)):
+        object_name = one_wire_bus_object_name(bus_index)
+        lines.extend(
+            [
+                (
+                    f"    if ({object_name}.step(elapsed_ms) && "
+                    f"{object_name}.freshCount() != 0U &&"
+                ),
+                "        BridgeSync::allowsMutatingCommands())",
+                "    {",
+                (
+                    "        static_cast<void>("
+                    f"Serializer::serializeTemperatures({object_name}));"
+                ),
+                "    }",
+            ]
+        )
+    lines.append("}")
+    return lines
+
+
+def render_one_wire_isr(device: DeviceConfig) -> list[str]:
+    """Render the Timer5 compare-A interrupt that runs the bus bit slots.
+
+    Buses take turns on the timer, so only the bus with a transfer in flight
+    does anything; the others return at their first check.
+    """
+    buses = one_wire_buses(device)
+    if not buses:
+        return []
+
+    lines = ["ISR(TIMER5_COMPA_vect)", "{"]
+    lines.extend(
+        f"    {one_wire_bus_object_name(bus_index)}.onTimer({_pin_tag(bus)});"
+        for bus_index, bus in enumerate(buses)
+    )
+    lines.append("}")
+    return lines
@@ -8,12 +8,23 @@ from pathlib import Path, PurePosixPath
 from typing import cast
 
 from .constants import (
+    DEFAULT_ENCODER_STEPS_PER_DETENT,
+    DEFAULT_NETWORK_QUEUE_DEPTH,
     DURATION_RE,
     IDENTIFIER_RE,
     INDICATOR_MODES,
     LONG_CLICK_TYPES,
     MACRO_RE,
+    MAX_ENCODER_STEPS_PER_DETENT,
+    MAX_KEY_MATRIX_COLUMNS,
+    MAX_KEY_MATRIX_ROWS,
+    MAX_NETWORK_QUEUE_DEPTH,
+    MAX_PEER_ADDRESS,
+    MAX_SCAN_SLICES,
     NETWORK_FALLBACKS,
+    NETWORK_PENDING_POLICIES,
+    ONE_WIRE_ROM_RE,
+    PEER_OPERATIONS,
     SAFE_CPP_EXPR_FORBIDDEN,
     SUPER_LONG_CLICK_TYPES,
     UINT8_MAX,
@@ -28,13 +39,19 @@ from .models import (
     ClickAction,
     DefineMap,
     DeviceConfig,
+    EncoderConfig,
     GeneratorSettings,
     IndicatorConfig,
+    KeyMatrixConfig,
+    OccupancyConfig,
+    PeerAction,
     ProjectConfig,
+    TemperatureSensorConfig,
     TomlArray,
     TomlTable,
     TomlValue,
 )
+from .peer_links import resolve_peer_actions
 from .public_schema import normalize_public_schema
 from .validation import validate_device, validate_project
 
@@ -371,9 +388,35 @@ def _apply_click_action_table(
             fail(f"{path}.fallback must be one of: {choices}.")
         action.fallback = NETWORK_FALLBACKS[raw_fallback]
 
+    _apply_click_pending_policy(action, table, path)
     _apply_click_timing(action, table, path)
 
 
+def _apply_click_pending_policy(
+    action: ClickAction, table: TomlTable, path: str
+) -> None:
+    """Resolve what a press does while the same network click is still open."""
+    if "pending" in table:
+        raw_pending = expect_string(table["pending"], f"{path}.pending").lower()
+        if raw_pending not in NETWORK_PENDING_POLICIES:
+            choices = ", ".join(sorted(NETWORK_PENDING_POLICIES))
+            fail(f"{path}.pending must be one of: {choices}.")
+        action.pending = NETWORK_PENDING_POLICIES[raw_pending]
+        if not action.network:
+            fail(f"{path}.pending requires network=true.")
+
+    if "queue_depth" in table:
+        if action.pending != "QUEUE":
+            fail(f'{path}.queue_depth requires pending = "queue".')
+        action.queue_depth = expect_int(
+            table["queue_depth"], f"{path}.queue_depth", 1, MAX_NETWORK_QUEUE_DEPTH
+        )
+    elif action.pending == "QUEUE":
+        action.queue_depth = DEFAULT_NETWORK_QUEUE_DEPTH
+    elif action.pending == "MERGE":
+        action.queue_depth = 1
+
+
 def _validate_click_action(action: ClickAction, path: str, action_name: str) -> None:
     """Reject actions that would be enabled but inert or contradictory."""
     if not action.enabled:
@@ -516,10 +559,16 @@ def parse_clickables(raw: TomlValue | None, path: str) -> list[ClickableConfig]:
                 get_string(table, "name", item_path), f"{item_path}.name"
             ),
             clickable_id=expect_int(table.get("id"), f"{item_path}.id", 1, UINT8_MAX),
-            pin=validate_cpp_expr(
+            pin=""
+            if "matrix_key" in table
+            else validate_cpp_expr(
                 get_string(table, "pin", item_path), f"{item_path}.pin"
             ),
         )
+        if "matrix_key" in table:
+            clickable.matrix_key = parse_matrix_key(
+                table["matrix_key"], f"{item_path}.key"
+            )
         (
             clickable.short_enabled,
             clickable.short_targets,
@@ -531,10 +580,169 @@ def parse_clickables(raw: TomlValue | None, path: str) -> list[ClickableConfig]:
         clickable.super_long = parse_click_action(
             table.get("super_long"), f"{item_path}.super_long", "super_long"
         )
+        if "priority_off" in table:
+            clickable.priority_off_targets = parse_targets(
+                table["priority_off"], f"{item_path}.priority_off"
+            )
+        if "peer" in table:
+            # The peer frame leaves on the short click, so the button needs
+            # short detection even without a local short action.
+            clickable.peer = parse_peer_action(table["peer"], f"{item_path}.peer")
+            clickable.short_enabled = True
+        if "debounce" in table:
+            clickable.debounce_ms = parse_duration_ms(
+                table["debounce"], f"{item_path}.debounce", UINT8_MAX
+            )
+        clickable.touch = get_bool(table, "touch", item_path, default=False)
+        if "touch_threshold" in table:
+            clickable.touch_threshold = expect_int(
+                table["touch_threshold"], f"{item_path}.touch.threshold", 2, UINT8_MAX
+            )
         clickables.append(clickable)
     return clickables
 
 
+def parse_matrix_key(raw: TomlValue, path: str) -> tuple[int, int]:
+    """Parse the row and column of one key matrix button."""
+    table = expect_table(raw, path)
+    return (
+        expect_int(table.get("row"), f"{path}.row", 0, MAX_KEY_MATRIX_ROWS - 1),
+        expect_int(
+            table.get("column"), f"{path}.column", 0, MAX_KEY_MATRIX_COLUMNS - 1
+        ),
+    )
+
+
+def parse_key_matrix(raw: TomlValue, path: str) -> KeyMatrixConfig:
+    """Parse the row and column pins of one device key matrix."""
+    table = expect_table(raw, path)
+    pins: dict[str, list[str]] = {}
+    for key, limit in (
+        ("rows", MAX_KEY_MATRIX_ROWS),
+        ("columns", MAX_KEY_MATRIX_COLUMNS),
+    ):
+        items = expect_list(table.get(key), f"{path}.{key}")
+        if not 1 <= len(items) <= limit:
+            fail(f"{path}.{key} must list 1..{limit} pins.")
+        pins[key] = [
+            validate_cpp_expr(
+                expect_string(pin, f"{path}.{key}[{index}]"), f"{path}.{key}[{index}]"
+            )
+            for index, pin in enumerate(items)
+        ]
+    return KeyMatrixConfig(
+        rows=pins["rows"],
+        columns=pins["columns"],
+        diodes=get_bool(table, "diodes", path, default=False),
+    )
+
+
+def parse_peer_action(raw: TomlValue, path: str) -> PeerAction:
+    """Parse one short-click action executed by another controller."""
+    table = expect_table(raw, path)
+    operation = get_string(table, "action", path, "TOGGLE").upper()
+    if operation not in PEER_OPERATIONS:
+        choices = ", ".join(sorted(PEER_OPERATIONS))
+        fail(f"{path}.action must be one of: {choices}.")
+    targets = parse_targets(table.get("targets"), f"{path}.targets")
+    if not targets:
+        fail(f"{path}.targets must contain at least one actuator.")
+    return PeerAction(
+        device=get_string(table, "device", path).lower(),
+        operation=operation,
+        targets=targets,
+    )
+
+
+def parse_encoders(raw: TomlValue | None, path: str) -> list[EncoderConfig]:
+    """Parse all rotary encoder entries for one device."""
+    encoders: list[EncoderConfig] = []
+    for index, item in enumerate(expect_list(raw or [], path)):
+        table = expect_table(item, f"{path}[{index}]")
+        item_path = f"{path}[{index}]"
+        encoder = EncoderConfig(
+            name=validate_identifier(
+                get_string(table, "name", item_path), f"{item_path}.name"
+            ),
+            encoder_id=expect_int(table.get("id"), f"{item_path}.id", 1, UINT8_MAX),
+            pin_a=validate_cpp_expr(
+                get_string(table, "pin_a", item_path), f"{item_path}.pin_a"
+            ),
+            pin_b=validate_cpp_expr(
+                get_string(table, "pin_b", item_path), f"{item_path}.pin_b"
+            ),
+            steps_per_detent=expect_int(
+                table.get("steps_per_detent", DEFAULT_ENCODER_STEPS_PER_DETENT),
+                f"{item_path}.steps_per_detent",
+                1,
+                MAX_ENCODER_STEPS_PER_DETENT,
+            ),
+            network=get_bool(table, "network", item_path, default=False),
+        )
+        if "levels" in table:
+            encoder.level_targets = parse_targets(
+                table["levels"], f"{item_path}.levels"
+            )
+        encoders.append(encoder)
+    return encoders
+
+
+def parse_occupancy(raw: TomlValue | None, path: str) -> list[OccupancyConfig]:
+    """Parse all occupancy input entries for one device."""
+    inputs: list[OccupancyConfig] = []
+    for index, item in enumerate(expect_list(raw or [], path)):
+        table = expect_table(item, f"{path}[{index}]")
+        item_path = f"{path}[{index}]"
+        occupancy = OccupancyConfig(
+            name=validate_identifier(
+                get_string(table, "name", item_path), f"{item_path}.name"
+            ),
+            occupancy_id=expect_int(table.get("id"), f"{item_path}.id", 1, UINT8_MAX),
+            pin=validate_cpp_expr(
+                get_string(table, "pin", item_path), f"{item_path}.pin"
+            ),
+            network=get_bool(table, "network", item_path, default=False),
+        )
+        if "targets" in table:
+            occupancy.targets = parse_targets(table["targets"], f"{item_path}.targets")
+        inputs.append(occupancy)
+    return inputs
+
+
+def parse_one_wire_rom(value: TomlValue | None, path: str) -> list[int]:
+    """Parse a 64-bit 1-Wire ROM code written family byte first."""
+    if not isinstance(value, str) or not ONE_WIRE_ROM_RE.fullmatch(value):
+        fail(
+            f"{path} must be 16 hex digits, optionally separated by ':' or '-', "
+            'for example "28:FF:64:1E:0F:16:03:9C".'
+        )
+    digits = value.replace(":", "").replace("-", "")
+    return [int(digits[index : index + 2], 16) for index in range(0, 16, 2)]
+
+
+def parse_temperature(
+    raw: TomlValue | None, path: str
+) -> list[TemperatureSensorConfig]:
+    """Parse all 1-Wire temperature sensor entries for one device."""
+    sensors: list[TemperatureSensorConfig] = []
+    for index, item in enumerate(expect_list(raw or [], path)):
+        table = expect_table(item, f"{path}[{index}]")
+        item_path = f"{path}[{index}]"
+        sensor = TemperatureSensorConfig(
+            name=validate_identifier(
+                get_string(table, "name", item_path), f"{item_path}.name"
+            ),
+            sensor_id=expect_int(table.get("id"), f"{item_path}.id", 1, UINT8_MAX),
+            pin=validate_cpp_expr(
+                get_string(table, "pin", item_path), f"{item_path}.pin"
+            ),
+        )
+        if "rom" in table:
+            sensor.rom = parse_one_wire_rom(table["rom"], f"{item_path}.rom")
+        sensors.append(sensor)
+    return sensors
+
+
 def parse_indicators(raw: TomlValue | None, path: str) -> list[IndicatorConfig]:
     """Parse all indicator entries for one device."""
     indicators: list[IndicatorConfig] = []
@@ -689,6 +897,29 @@ def parse_project(path: Path) -> ProjectConfig:
             ),
             disable_rtc=get_bool(table, "disable_rtc", device_path, default=False),
             disable_eth=get_bool(table, "disable_eth", device_path, default=False),
+            peer_serial=normalize_serial(
+                get_string(table, "peer_serial", device_path),
+                f"{device_path}.peer_serial",
+            )
+            if "peer_serial" in table
+            else None,
+            peer_address=expect_int(
+                table.get("peer_address", 0),
+                f"{device_path}.peer_address",
+                0,
+                MAX_PEER_ADDRESS,
+            ),
+            scan_slices=expect_int(
+                table.get("scan_slices", 1),
+                f"{device_path}.scan_slices",
+                1,
+                MAX_SCAN_SLICES,
+            ),
+            key_matrix=parse_key_matrix(
+                table["key_matrix"], f"{device_path}.key_matrix"
+            )
+            if "key_matrix" in table
+            else None,
             defines=parse_define_table(table.get("defines"), f"{device_path}.defines"),
             raw_build_flags=parse_raw_build_flags(
                 table.get("raw_build_flags"), f"{device_path}.raw_build_flags"
@@ -699,6 +930,13 @@ def parse_project(path: Path) -> ProjectConfig:
             clickables=parse_clickables(
                 table.get("clickables"), f"{device_path}.clickables"
             ),
+            encoders=parse_encoders(table.get("encoders"), f"{device_path}.encoders"),
+            occupancy=parse_occupancy(
+                table.get("occupancy"), f"{device_path}.occupancy"
+            ),
+            temperature=parse_temperature(
+                table.get("temperature"), f"{device_path}.temperature"
+            ),
             indicators=parse_indicators(
                 table.get("indicators"), f"{device_path}.indicators"
             ),
@@ -723,4 +961,5 @@ def parse_project(path: Path) -> ProjectConfig:
         auto_id_paths=public_schema.auto_id_paths,
     )
     validate_project(project)
+    resolve_peer_actions(project)
     return project
@@ -14,7 +14,9 @@ from .constants import (
     MSGPACK_FRAME_ESCAPED_END,
     MSGPACK_FRAME_ESCAPED_ESCAPE,
     MSGPACK_POSITIVE_FIXINT_MAX,
+    PROTOCOL_CLICK_TYPES,
     PROTOCOL_DEVICE_DETAILS,
+    PROTOCOL_NETWORK_CLICK_REQUEST,
     UINT8_MAX,
     UINT16_MAX,
     UINT32_MAX,
@@ -25,7 +27,7 @@ from .errors import fail
 if TYPE_CHECKING:
     from collections.abc import Sequence
 
-    from .models import DeviceConfig
+    from .models import DeviceConfig, StaticProfileData
 
 
 def wire_protocol_major() -> int:
@@ -156,6 +158,40 @@ def encode_serial_msgpack_details_payload(device: DeviceConfig) -> list[int]:
     return frame_msgpack_payload(encode_msgpack_details_payload(device))
 
 
+def encode_json_network_click_request_prefix(
+    clickable_id: int,
+    click_type: str,
+) -> list[int]:
+    """Return NETWORK_CLICK_REQUEST JSON bytes up to the correlation value."""
+    return list(
+        (
+            f'{{"p":{PROTOCOL_NETWORK_CLICK_REQUEST},'
+            f'"t":{PROTOCOL_CLICK_TYPES[click_type]},'
+            f'"i":{clickable_id},"c":'
+        ).encode("ascii")
+    )
+
+
+def encode_serial_msgpack_network_click_request_prefix(
+    clickable_id: int,
+    click_type: str,
+) -> list[int]:
+    """Return framed NETWORK_CLICK_REQUEST MsgPack bytes up to the correlation value.
+
+    Byte 0 is the frame delimiter and byte 1 the fixmap header, so the runtime
+    can stream the same template with one extra key when it appends `m`.
+    """
+    payload: list[int] = [0x84]
+    payload.extend(msgpack_string("p"))
+    payload.extend(msgpack_uint(PROTOCOL_NETWORK_CLICK_REQUEST))
+    payload.extend(msgpack_string("t"))
+    payload.extend(msgpack_uint(PROTOCOL_CLICK_TYPES[click_type]))
+    payload.extend(msgpack_string("i"))
+    payload.extend(msgpack_uint(clickable_id))
+    payload.extend(msgpack_string("c"))
+    return frame_msgpack_payload(payload)[:-1]
+
+
 def render_byte_array(name: str, values: Sequence[int]) -> list[str]:
     """Render one generated byte array with compact hex literals."""
     if len(values) > UINT16_MAX:
@@ -191,6 +227,70 @@ def render_static_payload_arrays(device: DeviceConfig) -> list[str]:
     return lines
 
 
+def render_network_click_request_arrays(profile: StaticProfileData) -> list[str]:
+    """Render one pre-framed NETWORK_CLICK_REQUEST prefix per network-click slot."""
+    if not profile.network_click_slots:
+        return []
+
+    lines = ["// clang-format off"]
+    for slot_index, (clickable_index, click_type) in enumerate(
+        profile.network_click_slots
+    ):
+        clickable_id = profile.clickable_ids[clickable_index]
+        lines.extend(
+            render_byte_array(
+                f"NETWORK_CLICK_REQUEST_JSON_PREFIX_{slot_index}",
+                encode_json_network_click_request_prefix(clickable_id, click_type),
+            )
+        )
+        lines.append("")
+        lines.extend(
+            render_byte_array(
+                f"NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_{slot_index}",
+                encode_serial_msgpack_network_click_request_prefix(
+                    clickable_id, click_type
+                ),
+            )
+        )
+        lines.append("")
+    lines[-1] = "// clang-format on"
+    return lines
+
+
+def render_msgpack_map_prefix_writer_helper() -> list[str]:
+    """Render the loop writer that streams a framed MsgPack map template.
+
+    The fixmap header is bumped in flight when the caller appends one more key.
+
+    Request templates are streamed through loops instead of the unrolled
+    writer: one unrolled copy per network-click slot would cost far more flash
+    than the UART write it saves.
+    """
+    return [
+        (
+            "template <uint16_t PayloadSize> "
+            "auto writeGeneratedMsgPackMapPrefix("
+            "const uint8_t (&payload)[PayloadSize], bool extraKey) noexcept -> bool"
+        ),
+        "{",
+        "    // Byte 0 is the frame delimiter, byte 1 the fixmap header.",
+        "    for (uint16_t byteIndex = 0U; byteIndex < PayloadSize; ++byteIndex)",
+        "    {",
+        ("        uint8_t byte = LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex]);"),
+        "        if (byteIndex == 1U && extraKey)",
+        "        {",
+        "            ++byte;",
+        "        }",
+        "        if (BridgeTransport::write(byte) != 1U)",
+        "        {",
+        "            return false;",
+        "        }",
+        "    }",
+        "    return true;",
+        "}",
+    ]
+
+
 def render_static_payload_writer_helper() -> list[str]:
     """Render a direct PROGMEM/RAM byte writer for generated static payloads."""
     return [
@@ -204,7 +304,7 @@ def render_static_payload_writer_helper() -> list[str]:
         "    static auto write(const uint8_t (&payload)[PayloadSize]) noexcept -> bool",
         "    {",
         (
-            "        return CONFIG_COM_SERIAL->HardwareSerial::write("
+            "        return BridgeTransport::write("
             "LSH_STATIC_CONFIG_READ_BYTE(&payload[ByteIndex])) == 1U &&"
         ),
         (
@@ -235,7 +335,7 @@ def render_static_payload_writer_helper() -> list[str]:
         "    for (uint16_t byteIndex = 0U; byteIndex < PayloadSize; ++byteIndex)",
         "    {",
         (
-            "        if (CONFIG_COM_SERIAL->HardwareSerial::write("
+            "        if (BridgeTransport::write("
             "LSH_STATIC_CONFIG_READ_BYTE(&payload[byteIndex])) != 1U)"
         ),
         "        {",
@@ -0,0 +1,121 @@
+"""Resolve and render direct controller-to-controller click actions."""
+
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from .constants import DEFAULT_PEER_SERIAL_BAUD
+from .cpp import u8
+from .errors import fail
+from .validation import validate_target_set
+
+if TYPE_CHECKING:
+    from .models import ClickableConfig, DeviceConfig, ProjectConfig
+
+
+def has_peer_actions(device: DeviceConfig) -> bool:
+    """Return true when at least one button sends frames over the peer link."""
+    return any(clickable.peer is not None for clickable in device.clickables)
+
+
+def resolve_peer_actions(project: ProjectConfig) -> None:
+    """Validate peer links and bind every peer action to address and IDs."""
+    _validate_peer_links(project)
+
+    senders: dict[str, str] = {}
+    for device in project.devices.values():
+        for clickable in device.clickables:
+            if clickable.peer is None:
+                continue
+            _resolve_peer_action(project, device, clickable)
+            # One TX may drive several RX pins, but one RX pin listens to one TX.
+            previous_sender = senders.setdefault(clickable.peer.device, device.key)
+            if previous_sender != device.key:
+                fail(
+                    f"devices.{clickable.peer.device}.peer_link already receives "
+                    f"from devices.{previous_sender}; a UART receiver cannot "
+                    f"also listen to devices.{device.key}."
+                )
+
+
+def _validate_peer_links(project: ProjectConfig) -> None:
+    """Check that every declared peer link has a usable UART and address."""
+    owners: dict[int, str] = {}
+    for device in project.devices.values():
+        path = f"devices.{device.key}"
+        if (device.peer_serial is None) != (device.peer_address == 0):
+            fail(f"{path}.peer_link needs both serial and address.")
+        if device.peer_serial is None:
+            continue
+        if device.peer_serial == device.com_serial:
+            fail(f"{path}.peer_link.serial must differ from the bridge serial.")
+        if device.peer_serial == device.debug_serial:
+            fail(f"{path}.peer_link.serial must differ from the debug serial.")
+        previous_owner = owners.get(device.peer_address)
+        if previous_owner is not None:
+            fail(
+                f"{path}.peer_link.address {device.peer_address} is already "
+                f"used by devices.{previous_owner}."
+            )
+        owners[device.peer_address] = device.key
+
+
+def _resolve_peer_action(
+    project: ProjectConfig,
+    device: DeviceConfig,
+    clickable: ClickableConfig,
+) -> None:
+    """Bind one button's peer action to the target controller."""
+    peer = clickable.peer
+    if peer is None:
+        return
+    path = f"devices.{device.key}.clickables.{clickable.name}.peer"
+    if device.peer_serial is None:
+        fail(f"{path} needs devices.{device.key}.peer_link.")
+    target_device = project.devices.get(peer.device)
+    if target_device is None:
+        fail(f"{path}.device references unknown device {peer.device!r}.")
+    if target_device.key == device.key:
+        fail(f"{path}.device must name another controller.")
+    if target_device.peer_serial is None:
+        fail(f"{path}.device {peer.device!r} has no peer_link.")
+    sender_baud = _peer_baud(project, device)
+    target_baud = _peer_baud(project, target_device)
+    if sender_baud != target_baud:
+        fail(
+            f"{path}.device {peer.device!r} listens at {target_baud} baud, "
+            f"but devices.{device.key}.peer_link sends at {sender_baud} baud."
+        )
+
+    actuator_ids = {
+        actuator.name: actuator.actuator_id for actuator in target_device.actuators
+    }
+    validate_target_set(peer.targets, set(actuator_ids), f"{path}.targets")
+    peer.address = target_device.peer_address
+    peer.actuator_ids = [actuator_ids[target] for target in peer.targets]
+
+
+def _peer_baud(project: ProjectConfig, device: DeviceConfig) -> object:
+    """Return the effective peer UART baud rate of one controller."""
+    return device.defines.get(
+        "CONFIG_PEER_SERIAL_BAUD",
+        project.common_defines.get("CONFIG_PEER_SERIAL_BAUD", DEFAULT_PEER_SERIAL_BAUD),
+    )
+
+
+def render_peer_send_lines(
+    clickable: ClickableConfig,
+    *,
+    indent: str = "        ",
+) -> list[str]:
+    """Render the non-blocking peer frames sent by one short click."""
+    peer = clickable.peer
+    if peer is None:
+        return []
+    return [
+        (
+            f"{indent}static_cast<void>(PeerLink::send({u8(peer.address)}, "
+            f"{u8(actuator_id)}, PeerLink::Operation::{peer.operation}));"
+        )
+        for actuator_id in peer.actuator_ids
+    ]
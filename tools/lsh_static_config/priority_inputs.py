@@ -0,0 +1,134 @@
+"""Render interrupt-level priority inputs and their main-loop reconciliation."""
+
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from .action_calls import pulse_slot_map, render_cached_time_for_helper
+from .cpp import u8
+from .topology import actuator_name_at, clickable_object_name, target_indexes
+
+if TYPE_CHECKING:
+    from .models import ClickableConfig, DeviceConfig
+
+
+def priority_inputs(device: DeviceConfig) -> list[tuple[int, ClickableConfig]]:
+    """Return dense clickable indexes that own an interrupt-level OFF action."""
+    return [
+        (clickable_index, clickable)
+        for clickable_index, clickable in enumerate(device.clickables)
+        if clickable.priority_off_targets
+    ]
+
+
+def priority_input_isr_name(clickable_index: int, clickable: ClickableConfig) -> str:
+    """Return the generated ISR name for one priority input."""
+    return f"{clickable_object_name(clickable_index, clickable)}PriorityIsr"
+
+
+def _priority_target_indexes(
+    device: DeviceConfig,
+    clickable: ClickableConfig,
+) -> list[int]:
+    """Return dense actuator indexes driven OFF by one priority input."""
+    actuator_indexes = {
+        actuator.name: index for index, actuator in enumerate(device.actuators)
+    }
+    return target_indexes(clickable.priority_off_targets, actuator_indexes)
+
+
+def render_priority_input_isrs(device: DeviceConfig) -> list[str]:
+    """Render the pending mask and one pin-only ISR per priority input."""
+    entries = priority_inputs(device)
+    if not entries:
+        return []
+
+    lines = ["volatile uint8_t priorityInputsPending = 0U;"]
+    for bit, (clickable_index, clickable) in enumerate(entries):
+        isr_name = priority_input_isr_name(clickable_index, clickable)
+        lines.extend(["", f"void {isr_name}() noexcept", "{"])
+        lines.extend(
+            f"    {actuator_name_at(device, actuator_index)}.driveOffFromIsr();"
+            for actuator_index in _priority_target_indexes(device, clickable)
+        )
+        lines.extend(
+            [
+                f"    priorityInputsPending |= {u8(1 << bit)};",
+                "}",
+            ]
+        )
+    return lines
+
+
+def render_reconcile_priority_inputs(device: DeviceConfig) -> list[str]:
+    """Render the main-loop bookkeeping for OFF writes already done by ISRs."""
+    entries = priority_inputs(device)
+    lines = ["auto reconcilePriorityInputs() noexcept -> bool", "{"]
+    if not entries:
+        lines.extend(["    return false;", "}"])
+        return lines
+
+    pulse_slots = pulse_slot_map(device)
+    lines.extend(
+        [
+            "    if (priorityInputsPending == 0U)",
+            "    {",
+            "        return false;",
+            "    }",
+            "",
+            "    noInterrupts();",
+            "    const uint8_t pending = priorityInputsPending;",
+            "    priorityInputsPending = 0U;",
+            "    interrupts();",
+            "",
+        ]
+    )
+    lines.extend(render_cached_time_for_helper())
+    lines.append("    bool anyActuatorChangedState = false;")
+    for bit, (_clickable_index, clickable) in enumerate(entries):
+        lines.extend([f"    if ((pending & {u8(1 << bit)}) != 0U)", "    {"])
+        for actuator_index in _priority_target_indexes(device, clickable):
+            pulse_index = pulse_slots.get(actuator_index)
+            if pulse_index is not None:
+                lines.extend(
+                    [
+                        f"        if (pulseRemaining_ms[{u8(pulse_index)}] != 0U)",
+                        "        {",
+                        f"            pulseRemaining_ms[{u8(pulse_index)}] = 0U;",
+                        "            --hotLoopState::activePulseActuators();",
+                        "        }",
+                    ]
+                )
+            lines.append(
+                "        anyActuatorChangedState |= "
+                f"{actuator_name_at(device, actuator_index)}"
+                f".reconcileStateStatic<{u8(actuator_index)}>(false, actionNow);"
+            )
+        lines.append("    }")
+    lines.extend(["    return anyActuatorChangedState;", "}"])
+    return lines
+
+
+def render_priority_input_attach_lines(device: DeviceConfig) -> list[str]:
+    """Render configure() statements that attach every priority input ISR."""
+    lines: list[str] = []
+    for clickable_index, clickable in priority_inputs(device):
+        lines.extend(
+            [
+                "#ifdef NOT_AN_INTERRUPT",
+                (
+                    f"static_assert(digitalPinToInterrupt({clickable.pin}) != "
+                    "NOT_AN_INTERRUPT,"
+                ),
+                (
+                    f'              "Priority input {clickable.name} needs a pin '
+                    'with an external interrupt.");'
+                ),
+                "#endif",
+                (
+                    f"attachInterrupt(digitalPinToInterrupt({clickable.pin}), "
+                    f"{priority_input_isr_name(clickable_index, clickable)}, RISING);"
+                ),
+            ]
+        )
+    return lines
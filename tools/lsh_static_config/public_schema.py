@@ -40,6 +40,13 @@ FEATURE_DEFINE_MAP = {
     "fast_actuators": "CONFIG_USE_FAST_ACTUATORS",
     "fast_indicators": "CONFIG_USE_FAST_INDICATORS",
     "bench": "CONFIG_LSH_BENCH",
+    "time_sync": "CONFIG_BRIDGE_TIME_SYNC",
+    "echo_probe": "CONFIG_BRIDGE_ECHO_PROBE",
+    "compact_buttons": "CONFIG_COMPACT_CLICKABLES",
+    "health_ping": "CONFIG_BRIDGE_HEALTH_PING",
+    "hot_state_layout": "CONFIG_HOT_STATE_LAYOUT",
+    "state_handover": "CONFIG_STATE_HANDOVER",
+    "bounce_profile": "CONFIG_CLICKABLE_BOUNCE_PROFILE",
 }
 
 TIMING_DEFINE_MAP = {
@@ -62,6 +69,8 @@ TIMING_DEFINE_MAP = {
         "CONFIG_ACTUATORS_AUTO_OFF_CHECK_INTERVAL_MS",
         False,
     ),
+    "occupancy_report_interval": ("CONFIG_OCCUPANCY_REPORT_INTERVAL_MS", False),
+    "temperature_interval": ("CONFIG_TEMPERATURE_SAMPLE_INTERVAL_MS", False),
 }
 
 SERIAL_DEFINE_MAP = {
@@ -123,6 +132,7 @@ class ActionAliasContext:
 
     groups: dict[str, list[str]]
     scenes: dict[str, list[TomlTable]]
+    actuator_names: set[str]
 
 
 @dataclass(frozen=True)
@@ -400,6 +410,13 @@ def _apply_features(table: TomlTable, defines: TomlTable, path: str) -> None:
             "fast_indicators",
             "bench",
             "bench_iterations",
+            "time_sync",
+            "echo_probe",
+            "compact_buttons",
+            "health_ping",
+            "hot_state_layout",
+            "state_handover",
+            "bounce_profile",
             "aggressive_constexpr_ctors",
             "etl_profile_override_header",
         },
@@ -594,6 +611,10 @@ def _normalize_device(
             "disable_rtc",
             "disable_eth",
             "controllino_pin_aliases",
+            "peer_link",
+            "can_link",
+            "scan_slices",
+            "key_matrix",
             "features",
             "timing",
             "serial",
@@ -602,6 +623,9 @@ def _normalize_device(
             "groups",
             "scenes",
             "buttons",
+            "encoders",
+            "occupancy",
+            "temperature",
             "indicators",
         },
         path,
@@ -634,6 +658,25 @@ def _normalize_device(
         device_raw_flags,
         f"{path}.advanced",
     )
+    if "peer_link" in table:
+        _apply_peer_link(
+            _expect_table(table["peer_link"], f"{path}.peer_link"),
+            device,
+            device_defines,
+            f"{path}.peer_link",
+        )
+    if "can_link" in table:
+        _apply_can_link(
+            _expect_table(table["can_link"], f"{path}.can_link"),
+            device_defines,
+            f"{path}.can_link",
+        )
+    if "key_matrix" in table:
+        device["key_matrix"] = _normalize_key_matrix(
+            _expect_table(table["key_matrix"], f"{path}.key_matrix"),
+            f"{path}.key_matrix",
+            pin_aliases=pin_aliases,
+        )
     if device_defines:
         device["defines"] = device_defines
     if device_raw_flags:
@@ -653,7 +696,11 @@ def _normalize_device(
         groups=groups,
         actuator_names=actuator_names,
     )
-    aliases = ActionAliasContext(groups=groups, scenes=scenes)
+    aliases = ActionAliasContext(
+        groups=groups,
+        scenes=scenes,
+        actuator_names=actuator_names,
+    )
 
     device["actuators"] = _normalize_actuators(
         table.get("actuators"),
@@ -667,6 +714,25 @@ def _normalize_device(
         timing_defaults=_merge_timing_defaults(inherited_timing, local_timing),
         aliases=aliases,
     )
+    device["encoders"] = _normalize_encoders(
+        table.get("encoders"),
+        f"{path}.encoders",
+        pin_aliases=pin_aliases,
+        groups=groups,
+        actuator_names=actuator_names,
+    )
+    device["occupancy"] = _normalize_occupancy(
+        table.get("occupancy"),
+        f"{path}.occupancy",
+        pin_aliases=pin_aliases,
+        groups=groups,
+        actuator_names=actuator_names,
+    )
+    device["temperature"] = _normalize_temperature(
+        table.get("temperature"),
+        f"{path}.temperature",
+        pin_aliases=pin_aliases,
+    )
     device["indicators"] = _normalize_indicators(
         table.get("indicators"),
         f"{path}.indicators",
@@ -689,6 +755,7 @@ def _copy_device_scalar_fields(
         "debug_serial",
         "config_include",
         "static_config_include",
+        "scan_slices",
     ):
         if key in table:
             device[key] = table[key]
@@ -709,6 +776,49 @@ def _copy_device_scalar_fields(
     return device
 
 
+def _apply_peer_link(
+    table: TomlTable,
+    device: TomlTable,
+    defines: TomlTable,
+    path: str,
+) -> None:
+    """Map the controller-to-controller link table to device fields."""
+    _reject_unknown_keys(table, {"serial", "address", "baud"}, path)
+    device["peer_serial"] = _expect_string(table.get("serial"), f"{path}.serial")
+    device["peer_address"] = _expect_int(
+        table.get("address"), f"{path}.address", minimum=1
+    )
+    if "baud" in table:
+        defines["CONFIG_PEER_SERIAL_BAUD"] = _expect_int(
+            table["baud"], f"{path}.baud", minimum=1
+        )
+
+
+CAN_LINK_DEFINE_MAP = {
+    "cs_pin": ("CONFIG_CAN_CS_PIN", 0, 255),
+    "int_pin": ("CONFIG_CAN_INT_PIN", 0, 255),
+    "node": ("CONFIG_CAN_NODE_ID", 1, 127),
+    "bitrate": ("CONFIG_CAN_BITRATE_KBPS", 1, 1000),
+    "crystal_mhz": ("CONFIG_CAN_CRYSTAL_MHZ", 1, 40),
+    "tx_timeout_us": ("CONFIG_CAN_TX_TIMEOUT_US", 1, 65535),
+}
+
+
+def _apply_can_link(table: TomlTable, defines: TomlTable, path: str) -> None:
+    """Map the MCP2515 CAN bridge transport table to compile-time defines."""
+    _reject_unknown_keys(table, set(CAN_LINK_DEFINE_MAP), path)
+    if "cs_pin" not in table or "int_pin" not in table:
+        fail(f"{path} needs both cs_pin and int_pin.")
+    defines["CONFIG_BRIDGE_CAN"] = True
+    for field_name, (define_name, minimum, maximum) in CAN_LINK_DEFINE_MAP.items():
+        if field_name not in table:
+            continue
+        value = _expect_int(table[field_name], f"{path}.{field_name}", minimum)
+        if value > maximum:
+            fail(f"{path}.{field_name} must be at most {maximum}.")
+        defines[define_name] = value
+
+
 def _device_pin_aliases(
     table: TomlTable,
     defaults: PublicDefaults,
@@ -797,38 +907,228 @@ def _normalize_clickables(
         item_path = f"{path}.{name}"
         _reject_unknown_keys(
             table,
-            {"id", "pin", "short", "long", "super_long"},
+            {
+                "id",
+                "pin",
+                "short",
+                "long",
+                "super_long",
+                "priority_off",
+                "peer",
+                "debounce",
+                "touch",
+                "key",
+            },
             item_path,
         )
-        normalized.append(
-            {
-                "name": name,
-                "id": table["id"],
-                "pin": _normalize_pin(
-                    _expect_string(table.get("pin"), f"{item_path}.pin"),
-                    controllino_aliases=pin_aliases,
-                ),
-                "short": _normalize_short_action(
-                    table.get("short"),
-                    f"{item_path}.short",
-                    aliases=aliases,
-                ),
-                "long": _normalize_timed_action(
-                    table.get("long"),
-                    f"{item_path}.long",
-                    "long",
-                    default_ms=timing_defaults.long_click_ms,
-                    aliases=aliases,
-                ),
-                "super_long": _normalize_timed_action(
-                    table.get("super_long"),
-                    f"{item_path}.super_long",
-                    "super_long",
-                    default_ms=timing_defaults.super_long_click_ms,
-                    aliases=aliases,
-                ),
-            }
+        item: TomlTable = {
+            "name": name,
+            "id": table["id"],
+            "short": _normalize_short_action(
+                table.get("short"),
+                f"{item_path}.short",
+                aliases=aliases,
+            ),
+            "long": _normalize_timed_action(
+                table.get("long"),
+                f"{item_path}.long",
+                "long",
+                default_ms=timing_defaults.long_click_ms,
+                aliases=aliases,
+            ),
+            "super_long": _normalize_timed_action(
+                table.get("super_long"),
+                f"{item_path}.super_long",
+                "super_long",
+                default_ms=timing_defaults.super_long_click_ms,
+                aliases=aliases,
+            ),
+        }
+        if "priority_off" in table:
+            item["priority_off"] = _target_or_group_list(
+                table["priority_off"],
+                f"{item_path}.priority_off",
+                groups=aliases.groups,
+                actuator_names=aliases.actuator_names,
+            )
+        if "peer" in table:
+            item["peer"] = _normalize_peer_action(table["peer"], f"{item_path}.peer")
+        if "debounce" in table:
+            item["debounce"] = table["debounce"]
+        if "touch" in table:
+            _normalize_touch(table["touch"], item, f"{item_path}.touch")
+        if "key" in table:
+            if "pin" in table:
+                fail(f"{item_path} must set either pin or key, not both.")
+            item["matrix_key"] = _normalize_matrix_key(table["key"], f"{item_path}.key")
+        else:
+            item["pin"] = _normalize_pin(
+                _expect_string(table.get("pin"), f"{item_path}.pin"),
+                controllino_aliases=pin_aliases,
+            )
+        normalized.append(item)
+    return normalized
+
+
+def _normalize_touch(raw: TomlValue, item: TomlTable, path: str) -> None:
+    """Normalize `touch = true` or `touch = { threshold = N }` on one button."""
+    if isinstance(raw, bool):
+        item["touch"] = raw
+        return
+    table = _expect_table(raw, path)
+    _reject_unknown_keys(table, {"threshold"}, path)
+    item["touch"] = True
+    if "threshold" in table:
+        item["touch_threshold"] = table["threshold"]
+
+
+def _normalize_matrix_key(raw: TomlValue, path: str) -> TomlTable:
+    """Normalize `key = { row = R, column = C }` on one button."""
+    table = _expect_table(raw, path)
+    _reject_unknown_keys(table, {"row", "column"}, path)
+    return {
+        "row": _expect_int(table.get("row"), f"{path}.row"),
+        "column": _expect_int(table.get("column"), f"{path}.column"),
+    }
+
+
+def _normalize_key_matrix(
+    table: TomlTable,
+    path: str,
+    *,
+    pin_aliases: bool,
+) -> TomlTable:
+    """Normalize the device key matrix pins and diode option."""
+    _reject_unknown_keys(table, {"rows", "columns", "diodes"}, path)
+    matrix: TomlTable = {}
+    for key in ("rows", "columns"):
+        matrix[key] = [
+            _normalize_pin(
+                _expect_string(pin, f"{path}.{key}[{index}]"),
+                controllino_aliases=pin_aliases,
+            )
+            for index, pin in enumerate(_expect_list(table.get(key), f"{path}.{key}"))
+        ]
+    matrix["diodes"] = _get_bool(table, "diodes", path, default=False)
+    return matrix
+
+
+def _normalize_peer_action(raw: TomlValue, path: str) -> TomlTable:
+    """Normalize one short-click action executed by another controller."""
+    table = _expect_table(raw, path)
+    _reject_unknown_keys(table, {"device", "action", "target", "targets"}, path)
+    action = _get_optional_action(table, path) or "toggle"
+    if action not in {"toggle", "on", "off"}:
+        fail(f'{path}.action must be "toggle", "on" or "off".')
+    targets = _optional_targets(table, path)
+    if not targets:
+        fail(f"{path} must name at least one target actuator.")
+    return {
+        "device": _expect_string(table.get("device"), f"{path}.device"),
+        "action": action.upper(),
+        "targets": targets,
+    }
+
+
+def _normalize_encoders(
+    raw: TomlValue | None,
+    path: str,
+    *,
+    pin_aliases: bool,
+    groups: dict[str, list[str]],
+    actuator_names: set[str],
+) -> list[TomlTable]:
+    """Normalize named rotary encoder tables and assign omitted public IDs."""
+    resources = _named_resource_tables(raw, path)
+    _assign_missing_ids(resources, "id", path)
+    normalized: list[TomlTable] = []
+    for name, table in resources:
+        item_path = f"{path}.{name}"
+        _reject_unknown_keys(
+            table,
+            {"id", "pin_a", "pin_b", "steps_per_detent", "levels", "network"},
+            item_path,
         )
+        item: TomlTable = {"name": name, "id": table["id"]}
+        for key in ("pin_a", "pin_b"):
+            item[key] = _normalize_pin(
+                _expect_string(table.get(key), f"{item_path}.{key}"),
+                controllino_aliases=pin_aliases,
+            )
+        for key in ("steps_per_detent", "network"):
+            if key in table:
+                item[key] = table[key]
+        if "levels" in table:
+            item["levels"] = _target_or_group_list(
+                table["levels"],
+                f"{item_path}.levels",
+                groups=groups,
+                actuator_names=actuator_names,
+            )
+        normalized.append(item)
+    return normalized
+
+
+def _normalize_occupancy(
+    raw: TomlValue | None,
+    path: str,
+    *,
+    pin_aliases: bool,
+    groups: dict[str, list[str]],
+    actuator_names: set[str],
+) -> list[TomlTable]:
+    """Normalize named occupancy input tables and assign omitted public IDs."""
+    resources = _named_resource_tables(raw, path)
+    _assign_missing_ids(resources, "id", path)
+    normalized: list[TomlTable] = []
+    for name, table in resources:
+        item_path = f"{path}.{name}"
+        _reject_unknown_keys(table, {"id", "pin", "targets", "network"}, item_path)
+        item: TomlTable = {
+            "name": name,
+            "id": table["id"],
+            "pin": _normalize_pin(
+                _expect_string(table.get("pin"), f"{item_path}.pin"),
+                controllino_aliases=pin_aliases,
+            ),
+        }
+        if "network" in table:
+            item["network"] = table["network"]
+        if "targets" in table:
+            item["targets"] = _target_or_group_list(
+                table["targets"],
+                f"{item_path}.targets",
+                groups=groups,
+                actuator_names=actuator_names,
+            )
+        normalized.append(item)
+    return normalized
+
+
+def _normalize_temperature(
+    raw: TomlValue | None,
+    path: str,
+    *,
+    pin_aliases: bool,
+) -> list[TomlTable]:
+    """Normalize named 1-Wire sensor tables and assign omitted public IDs."""
+    resources = _named_resource_tables(raw, path)
+    _assign_missing_ids(resources, "id", path)
+    normalized: list[TomlTable] = []
+    for name, table in resources:
+        item_path = f"{path}.{name}"
+        _reject_unknown_keys(table, {"id", "pin", "rom"}, item_path)
+        item: TomlTable = {
+            "name": name,
+            "id": table["id"],
+            "pin": _normalize_pin(
+                _expect_string(table.get("pin"), f"{item_path}.pin"),
+                controllino_aliases=pin_aliases,
+            ),
+        }
+        if "rom" in table:
+            item["rom"] = _expect_string(table["rom"], f"{item_path}.rom")
+        normalized.append(item)
     return normalized
 
 
@@ -1066,6 +1366,8 @@ def _normalize_timed_action(  # noqa: PLR0911
             "time_ms",
             "network",
             "fallback",
+            "pending",
+            "queue_depth",
             "scene",
         },
         path,
@@ -1129,7 +1431,15 @@ def _apply_action_default_time(
 def _copy_timed_action_fields(table: TomlTable, path: str) -> TomlTable:
     """Copy timed-action fields that do not need target/action translation."""
     normalized: TomlTable = {}
-    for key in ("enabled", "network", "time", "time_ms", "type"):
+    for key in (
+        "enabled",
+        "network",
+        "pending",
+        "queue_depth",
+        "time",
+        "time_ms",
+        "type",
+    ):
         if key in table:
             normalized[key] = table[key]
     if "after" in table:
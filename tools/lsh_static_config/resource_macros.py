@@ -4,6 +4,8 @@ from __future__ import annotations
 
 from typing import TYPE_CHECKING
 
+from .topology import one_wire_buses
+
 if TYPE_CHECKING:
     from .models import DeviceConfig, StaticProfileData
 
@@ -29,6 +31,26 @@ def static_resource_macros(
         "LSH_STATIC_CONFIG_INDICATOR_ACTUATOR_LINKS": profile.indicator_links,
         "LSH_STATIC_CONFIG_AUTO_OFF_ACTUATORS": len(profile.auto_off_indexes),
         "LSH_STATIC_CONFIG_PULSE_ACTUATORS": len(profile.pulse_indexes),
+        "LSH_STATIC_CONFIG_PRIORITY_INPUTS": sum(
+            1 for clickable in device.clickables if clickable.priority_off_targets
+        ),
+        "LSH_STATIC_CONFIG_TOUCH_KEYS": sum(
+            1 for clickable in device.clickables if clickable.touch
+        ),
+        "LSH_STATIC_CONFIG_MATRIX_KEYS": sum(
+            1 for clickable in device.clickables if clickable.matrix_key is not None
+        ),
+        "LSH_STATIC_CONFIG_ENCODERS": len(device.encoders),
+        "LSH_STATIC_CONFIG_NETWORK_ENCODERS": sum(
+            1 for encoder in device.encoders if encoder.network
+        ),
+        "LSH_STATIC_CONFIG_OCCUPANCY_INPUTS": len(device.occupancy),
+        "LSH_STATIC_CONFIG_NETWORK_OCCUPANCY": sum(
+            1 for occupancy in device.occupancy if occupancy.network
+        ),
+        "LSH_STATIC_CONFIG_TEMPERATURE_SENSORS": len(device.temperature),
+        "LSH_STATIC_CONFIG_ONE_WIRE_BUSES": len(one_wire_buses(device)),
+        "LSH_STATIC_CONFIG_PEER_ADDRESS": device.peer_address,
         "LSH_STATIC_CONFIG_ACTIVE_NETWORK_CLICKS": profile.active_network_clicks,
         "LSH_STATIC_CONFIG_DISABLE_NETWORK_CLICKS": 1
         if profile.active_network_clicks == 0
@@ -18,6 +18,7 @@ from .click_actions import (
     render_direct_short_clicks,
     render_direct_super_long_clicks,
     render_get_network_click_clickable_index,
+    render_get_network_click_queue_depth,
     render_get_network_click_slot_count,
     render_get_network_click_slot_index,
     render_get_network_click_type,
@@ -27,9 +28,17 @@ from .click_actions import (
     render_turn_off_all_actuators,
     render_turn_off_unprotected_actuators,
 )
-from .click_scan import render_scan_clickables
-from .constants import CLANG_FORMAT_COLUMN_LIMIT
+from .click_scan import render_get_bounce_profile, render_scan_clickables
+from .constants import (
+    CLANG_FORMAT_COLUMN_LIMIT,
+    FNV1A32_OFFSET_BASIS,
+    FNV1A32_PRIME,
+)
 from .cpp import append_section, u8, u32
+from .encoders import render_drain_encoders
+from .occupancy import render_report_occupancy, render_scan_occupancy
+from .one_wire import render_poll_one_wire
+from .priority_inputs import render_reconcile_priority_inputs
 from .topology import actuator_name_at, indicator_object_name
 
 if TYPE_CHECKING:
@@ -143,6 +152,29 @@ def render_apply_packed_state_byte(
     return lines
 
 
+def actuator_topology_fingerprint(device: DeviceConfig) -> int:
+    """Return the FNV-1a hash of the ordered actuator IDs and pins.
+
+    Packed state bytes carry one bit per actuator index, so two firmware
+    images may only exchange them when every index keeps its ID and pin.
+    """
+    fingerprint = FNV1A32_OFFSET_BASIS
+    for actuator in device.actuators:
+        for value in (actuator.actuator_id, *actuator.pin.encode(), 0):
+            fingerprint = ((fingerprint ^ value) * FNV1A32_PRIME) & 0xFFFFFFFF
+    return fingerprint
+
+
+def render_actuator_topology_fingerprint(device: DeviceConfig) -> list[str]:
+    """Render the fingerprint that ties packed state bytes to this topology."""
+    return [
+        "auto actuatorTopologyFingerprint() noexcept -> uint32_t",
+        "{",
+        f"    return {u32(actuator_topology_fingerprint(device))};",
+        "}",
+    ]
+
+
 def render_set_actuator_state_by_id(device: DeviceConfig) -> list[str]:
     """Render direct inbound actuator command dispatch by wire ID."""
     lines = [
@@ -294,6 +326,87 @@ def render_check_auto_off_timers(device: DeviceConfig) -> list[str]:
     return lines
 
 
+def render_get_active_timer(device: DeviceConfig) -> list[str]:
+    """Render the TIMERS_STATE reader over auto-off entries, then pulse slots."""
+    auto_off_entries = [
+        (actuator_index, actuator)
+        for actuator_index, actuator in enumerate(device.actuators)
+        if actuator.auto_off_ms is not None
+    ]
+    pulse_entries = [
+        actuator_index
+        for actuator_index, actuator in enumerate(device.actuators)
+        if actuator.pulse_ms is not None
+    ]
+    lines = [
+        (
+            "auto getActiveTimer(uint8_t timerIndex, uint32_t now_ms, "
+            "uint8_t &actuatorId, uint32_t &remaining_ms) noexcept -> bool"
+        ),
+        "{",
+    ]
+    if not auto_off_entries and not pulse_entries:
+        lines.extend(
+            [
+                "    static_cast<void>(timerIndex);",
+                "    static_cast<void>(now_ms);",
+                "    static_cast<void>(actuatorId);",
+                "    static_cast<void>(remaining_ms);",
+                "    return false;",
+                "}",
+            ]
+        )
+        return lines
+
+    if not auto_off_entries:
+        lines.append("    static_cast<void>(now_ms);")
+    lines.extend(["    switch (timerIndex)", "    {"])
+    for auto_off_index, (actuator_index, actuator) in enumerate(auto_off_entries):
+        timer_ms = actuator.auto_off_ms if actuator.auto_off_ms is not None else 0
+        actuator_name = actuator_name_at(device, actuator_index)
+        lines.extend(
+            [
+                f"    case {auto_off_index}U:",
+                "#if CONFIG_USE_COMPACT_ACTUATOR_SWITCH_TIMES",
+                (
+                    "        if (!Actuators::getCompactAutoOffRemaining("
+                    f"{u8(auto_off_index)}, {actuator_name}, now_ms, "
+                    f"{u32(timer_ms)}, remaining_ms))"
+                ),
+                "#else",
+                (
+                    f"        if (!{actuator_name}.getAutoOffRemaining(now_ms, "
+                    f"{u32(timer_ms)}, remaining_ms))"
+                ),
+                "#endif",
+                "        {",
+                "            return false;",
+                "        }",
+                f"        actuatorId = {u8(actuator.actuator_id)};",
+                "        return true;",
+            ]
+        )
+    for pulse_index, actuator_index in enumerate(pulse_entries):
+        timer_index = len(auto_off_entries) + pulse_index
+        lines.extend(
+            [
+                f"    case {timer_index}U:",
+                f"        if (pulseRemaining_ms[{u8(pulse_index)}] == 0U)",
+                "        {",
+                "            return false;",
+                "        }",
+                f"        remaining_ms = pulseRemaining_ms[{u8(pulse_index)}];",
+                (
+                    "        actuatorId = "
+                    f"{u8(device.actuators[actuator_index].actuator_id)};"
+                ),
+                "        return true;",
+            ]
+        )
+    lines.extend(["    default:", "        return false;", "    }", "}"])
+    return lines
+
+
 def render_check_pulse_timers(device: DeviceConfig) -> list[str]:
     """Render the generated pulse countdown sweep for momentary actuators."""
     entries = [
@@ -308,7 +421,7 @@ def render_check_pulse_timers(device: DeviceConfig) -> list[str]:
 
     lines.extend(
         [
-            "    if (activePulseActuators == 0U)",
+            "    if (hotLoopState::activePulseActuators() == 0U)",
             "    {",
             "        return false;",
             "    }",
@@ -330,7 +443,7 @@ def render_check_pulse_timers(device: DeviceConfig) -> list[str]:
                 f"        if (pulseRemaining_ms[{u8(pulse_index)}] <= elapsed_ms)",
                 "        {",
                 f"            pulseRemaining_ms[{u8(pulse_index)}] = 0U;",
-                "            --activePulseActuators;",
+                "            --hotLoopState::activePulseActuators();",
                 f"            anyActuatorChangedState |= {off_call};",
                 "        }",
                 "        else",
@@ -422,12 +535,21 @@ def render_generated_action_accessors(
         render_get_network_click_slot_index(profile),
         render_get_network_click_clickable_index(profile),
         render_get_network_click_type(profile),
+        render_get_network_click_queue_depth(device, profile),
         render_is_clickable_configuration_valid(device, profile),
         render_set_actuator_state_by_id(device),
         render_scan_clickables(device, profile),
+        render_get_bounce_profile(device),
         render_check_pulse_timers(device),
+        render_reconcile_priority_inputs(device),
+        render_drain_encoders(device),
+        render_scan_occupancy(device),
+        render_report_occupancy(device),
+        render_poll_one_wire(device),
         render_check_auto_off_timers(device),
+        render_get_active_timer(device),
         render_apply_packed_state_byte(device),
+        render_actuator_topology_fingerprint(device),
         render_compute_indicator_state(device, profile),
         render_refresh_indicators(device, profile),
     ):
@@ -31,6 +31,64 @@ def render_details_payload_accessors() -> list[str]:
     ]
 
 
+def render_network_click_request_accessor(profile: StaticProfileData) -> list[str]:
+    """Render the slot-indexed writer of pre-framed NETWORK_CLICK_REQUEST prefixes."""
+    lines = [
+        (
+            "auto writeNetworkClickRequestPrefix(uint8_t slotIndex, "
+            "bool timestamped) noexcept -> bool"
+        ),
+        "{",
+    ]
+    if not profile.network_click_slots:
+        lines.extend(
+            [
+                "    static_cast<void>(slotIndex);",
+                "    static_cast<void>(timestamped);",
+                "    return false;",
+                "}",
+            ]
+        )
+        return lines
+
+    slot_indexes = range(len(profile.network_click_slots))
+    lines.extend(["#ifdef CONFIG_MSG_PACK", "    switch (slotIndex)", "    {"])
+    for slot_index in slot_indexes:
+        lines.extend(
+            [
+                f"    case {slot_index}U:",
+                (
+                    "        return writeGeneratedMsgPackMapPrefix("
+                    f"NETWORK_CLICK_REQUEST_MSGPACK_PREFIX_{slot_index}, timestamped);"
+                ),
+            ]
+        )
+    lines.extend(
+        [
+            "    default:",
+            "        return false;",
+            "    }",
+            "#else",
+            "    // JSON appends `m` after the correlation value: same prefix.",
+            "    static_cast<void>(timestamped);",
+            "    switch (slotIndex)",
+            "    {",
+        ]
+    )
+    for slot_index in slot_indexes:
+        lines.extend(
+            [
+                f"    case {slot_index}U:",
+                (
+                    "        return writeGeneratedPayloadLoop("
+                    f"NETWORK_CLICK_REQUEST_JSON_PREFIX_{slot_index});"
+                ),
+            ]
+        )
+    lines.extend(["    default:", "        return false;", "    }", "#endif", "}"])
+    return lines
+
+
 def render_core_static_accessors(
     device: DeviceConfig,
     profile: StaticProfileData,
@@ -122,6 +180,7 @@ def render_static_config_accessors(
         render_core_static_accessors(device, profile),
         render_indicator_static_accessors(profile),
         render_details_payload_accessors(),
+        render_network_click_request_accessor(profile),
         render_generated_action_accessors(device, profile),
     ):
         append_section(lines, section)
@@ -11,7 +11,10 @@ if TYPE_CHECKING:
         ActuatorConfig,
         ClickableConfig,
         DeviceConfig,
+        EncoderConfig,
         IndicatorConfig,
+        OccupancyConfig,
+        TemperatureSensorConfig,
     )
 
 
@@ -31,6 +34,29 @@ def clickable_object_name(clickable_index: int, clickable: ClickableConfig) -> s
     return f"button{clickable_index}_{_object_suffix(clickable.name)}"
 
 
+def encoder_object_name(encoder_index: int, encoder: EncoderConfig) -> str:
+    """Return the C++ object name for one generated rotary encoder."""
+    return f"encoder{encoder_index}_{_object_suffix(encoder.name)}"
+
+
+def occupancy_object_name(occupancy_index: int, occupancy: OccupancyConfig) -> str:
+    """Return the C++ object name for one generated occupancy input."""
+    return f"occupancy{occupancy_index}_{_object_suffix(occupancy.name)}"
+
+
+def one_wire_buses(device: DeviceConfig) -> list[list[TemperatureSensorConfig]]:
+    """Group temperature sensors into buses by pin, in declaration order."""
+    buses: dict[str, list[TemperatureSensorConfig]] = {}
+    for sensor in device.temperature:
+        buses.setdefault(sensor.pin, []).append(sensor)
+    return list(buses.values())
+
+
+def one_wire_bus_object_name(bus_index: int) -> str:
+    """Return the C++ object name for one generated 1-Wire bus."""
+    return f"oneWireBus{bus_index}"
+
+
 def indicator_object_name(indicator_index: int, indicator: IndicatorConfig) -> str:
     """Return the C++ object name for one generated indicator."""
     return f"indicator{indicator_index}_{_object_suffix(indicator.name)}"
@@ -0,0 +1,123 @@
+"""Render touch buttons, their ADC sweep interrupt and the per-scan update."""
+
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from .cpp import u8
+from .topology import clickable_object_name
+
+if TYPE_CHECKING:
+    from .models import ClickableConfig, DeviceConfig
+
+
+def touch_keys(device: DeviceConfig) -> list[tuple[int, ClickableConfig]]:
+    """Return dense clickable indexes of every touch button."""
+    return [
+        (clickable_index, clickable)
+        for clickable_index, clickable in enumerate(device.clickables)
+        if clickable.touch
+    ]
+
+
+def touch_key_object_name(clickable_index: int, clickable: ClickableConfig) -> str:
+    """Return the C++ detector name of one touch button."""
+    return f"{clickable_object_name(clickable_index, clickable)}Touch"
+
+
+def _pin_tag(clickable: ClickableConfig) -> str:
+    """Render the compile-time pin tag of one touch electrode."""
+    return f"::lsh::core::PinTag<({clickable.pin})>{{}}"
+
+
+def render_touch_declarations(device: DeviceConfig) -> list[str]:
+    """Render detectors, sample storage and the sweep service of touch buttons.
+
+    `serviceTouchKeys()` runs at the top of every clickable scan: it folds a
+    finished sweep into the detectors and starts the next one, which the ADC
+    interrupt then carries through every electrode on its own.
+    """
+    keys = touch_keys(device)
+    if not keys:
+        return []
+
+    sweep_done = u8(2 * len(keys))
+    lines = [
+        f"LSH_TOUCH_KEY({touch_key_object_name(index, clickable)});"
+        for index, clickable in keys
+    ]
+    lines.extend(
+        [
+            f"volatile uint16_t touchSamples[{len(keys)}] = {{}};",
+            "volatile uint8_t touchStep = TouchSense::SWEEP_IDLE;",
+            "",
+            "void serviceTouchKeys() noexcept",
+            "{",
+            "    const uint8_t step = touchStep;",
+            f"    if (step != TouchSense::SWEEP_IDLE && step != {sweep_done})",
+            "    {",
+            "        return;",
+            "    }",
+            f"    if (step == {sweep_done})",
+            "    {",
+        ]
+    )
+    for sample_index, (index, clickable) in enumerate(keys):
+        threshold = (
+            ""
+            if clickable.touch_threshold is None
+            else f"<{u8(clickable.touch_threshold)}>"
+        )
+        lines.append(
+            f"        {touch_key_object_name(index, clickable)}"
+            f".update{threshold}(touchSamples[{sample_index}]);"
+        )
+    lines.extend(
+        [
+            "    }",
+            "    touchStep = 0U;",
+            f"    TouchSense::startSweep({_pin_tag(keys[0][1])});",
+            "}",
+        ]
+    )
+    return lines
+
+
+def render_touch_isr(device: DeviceConfig) -> list[str]:
+    """Render the ADC interrupt that chains both conversions of every key."""
+    keys = touch_keys(device)
+    if not keys:
+        return []
+
+    sweep_done = u8(2 * len(keys))
+    lines = [
+        "ISR(ADC_vect)",
+        "{",
+        "    const uint8_t step = touchStep;",
+        "    // A conversion outside a running sweep must not start or advance one.",
+        f"    if (step >= {sweep_done})",
+        "    {",
+        "        return;",
+        "    }",
+        "    touchStep = static_cast<uint8_t>(step + 1U);",
+        "    switch (step)",
+        "    {",
+    ]
+    for sample_index, (_index, clickable) in enumerate(keys):
+        lines.extend(
+            [
+                f"    case {u8(2 * sample_index)}:",
+                f"        TouchSense::shareCharge({_pin_tag(clickable)});",
+                "        break;",
+                f"    case {u8(2 * sample_index + 1)}:",
+                f"        touchSamples[{sample_index}] = ADC;",
+            ]
+        )
+        if sample_index + 1 < len(keys):
+            next_clickable = keys[sample_index + 1][1]
+            lines.append(f"        TouchSense::precharge({_pin_tag(next_clickable)});")
+        else:
+            lines.append("        TouchSense::finishSweep();")
+        lines.append("        break;")
+    lines.extend(["    default:", "        break;", "    }", "}"])
+    return lines
@@ -4,8 +4,18 @@ from __future__ import annotations
 
 from typing import TYPE_CHECKING, TypeVar
 
-from .constants import DEFAULT_LONG_CLICK_MS, DEFAULT_SUPER_LONG_CLICK_MS, UINT8_MAX
+from .constants import (
+    CONTROLLINO_OC0B_PINS,
+    DEFAULT_LONG_CLICK_MS,
+    DEFAULT_SUPER_LONG_CLICK_MS,
+    MAX_COMPACT_CLICK_TICK_SHIFT,
+    MAX_ONE_WIRE_SENSORS_PER_BUS,
+    MAX_PRIORITY_INPUTS,
+    MAX_TOUCH_KEYS,
+    UINT8_MAX,
+)
 from .errors import fail
+from .topology import one_wire_buses
 
 if TYPE_CHECKING:
     from collections.abc import Callable, Hashable, Iterable, Sequence
@@ -14,6 +24,7 @@ if TYPE_CHECKING:
 
 TConfig = TypeVar("TConfig")
 GENERATED_TOP_LEVEL_HEADER_COUNT = 2
+ONE_WIRE_TEMPERATURE_FAMILIES = {0x22: "DS1822", 0x28: "DS18B20"}
 
 
 def validate_unique(
@@ -50,10 +61,31 @@ def _validate_resource_counts(device: DeviceConfig) -> None:
         len(device.clickables),
         f"devices.{device.key}.clickables",
     )
+    _validate_resource_count(
+        len(device.encoders),
+        f"devices.{device.key}.encoders",
+    )
+    _validate_resource_count(
+        len(device.occupancy),
+        f"devices.{device.key}.occupancy",
+    )
+    _validate_resource_count(
+        len(device.temperature),
+        f"devices.{device.key}.temperature",
+    )
     _validate_resource_count(
         len(device.indicators),
         f"devices.{device.key}.indicators",
     )
+    # Auto-off and pulse countdowns share one uint8_t timer index space.
+    _validate_resource_count(
+        sum(
+            1
+            for actuator in device.actuators
+            if actuator.auto_off_ms is not None or actuator.pulse_ms is not None
+        ),
+        f"devices.{device.key}.actuators with auto_off or pulse",
+    )
 
 
 def _validate_unique_fields(device: DeviceConfig) -> None:
@@ -82,6 +114,48 @@ def _validate_unique_fields(device: DeviceConfig) -> None:
         f"devices.{device.key}.clickables",
         lambda clickable: clickable.clickable_id,
     )
+    validate_unique(
+        device.encoders,
+        "name",
+        f"devices.{device.key}.encoders",
+        lambda encoder: encoder.name,
+    )
+    validate_unique(
+        device.encoders,
+        "encoder_id",
+        f"devices.{device.key}.encoders",
+        lambda encoder: encoder.encoder_id,
+    )
+    validate_unique(
+        device.occupancy,
+        "name",
+        f"devices.{device.key}.occupancy",
+        lambda occupancy: occupancy.name,
+    )
+    validate_unique(
+        device.occupancy,
+        "occupancy_id",
+        f"devices.{device.key}.occupancy",
+        lambda occupancy: occupancy.occupancy_id,
+    )
+    validate_unique(
+        device.temperature,
+        "name",
+        f"devices.{device.key}.temperature",
+        lambda sensor: sensor.name,
+    )
+    validate_unique(
+        device.temperature,
+        "sensor_id",
+        f"devices.{device.key}.temperature",
+        lambda sensor: sensor.sensor_id,
+    )
+    validate_unique(
+        [sensor for sensor in device.temperature if sensor.rom is not None],
+        "rom",
+        f"devices.{device.key}.temperature",
+        lambda sensor: tuple(sensor.rom or ()),
+    )
     validate_unique(
         device.indicators,
         "name",
@@ -188,6 +262,7 @@ def _validate_clickable_targets(device: DeviceConfig) -> None:
             not _has_effective_short_action(clickable)
             and not _has_effective_long_action(clickable)
             and not _has_effective_super_long_action(device, clickable)
+            and not clickable.priority_off_targets
         ):
             fail(
                 f"devices.{device.key}.clickables.{clickable.name} has no "
@@ -195,6 +270,199 @@ def _validate_clickable_targets(device: DeviceConfig) -> None:
             )
 
 
+def _validate_priority_inputs(device: DeviceConfig) -> None:
+    """Validate interrupt-level OFF targets and the priority input budget."""
+    actuator_names = {actuator.name for actuator in device.actuators}
+    protected_actuator_names = {
+        actuator.name for actuator in device.actuators if actuator.protected
+    }
+    priority_inputs = [
+        clickable for clickable in device.clickables if clickable.priority_off_targets
+    ]
+    if len(priority_inputs) > MAX_PRIORITY_INPUTS:
+        fail(
+            f"devices.{device.key} declares {len(priority_inputs)} priority "
+            f"inputs; at most {MAX_PRIORITY_INPUTS} are supported."
+        )
+    for clickable in priority_inputs:
+        path = f"devices.{device.key}.clickables.{clickable.name}.priority_off"
+        validate_target_set(clickable.priority_off_targets, actuator_names, path)
+        for target in clickable.priority_off_targets:
+            if target in protected_actuator_names:
+                fail(
+                    f"{path} targets protected actuator {target!r}; protected "
+                    "actuators cannot be switched off by priority inputs."
+                )
+
+
+def _validate_touch_keys(device: DeviceConfig) -> None:
+    """Validate the touch key budget and reject digital-only options."""
+    touch_keys = [clickable for clickable in device.clickables if clickable.touch]
+    if len(touch_keys) > MAX_TOUCH_KEYS:
+        fail(
+            f"devices.{device.key} declares {len(touch_keys)} touch buttons; "
+            f"at most {MAX_TOUCH_KEYS} are supported."
+        )
+    for clickable in device.clickables:
+        path = f"devices.{device.key}.clickables.{clickable.name}"
+        if clickable.touch_threshold is not None and not clickable.touch:
+            fail(f"{path}.touch.threshold needs touch enabled.")
+        if clickable.touch and clickable.priority_off_targets:
+            fail(
+                f"{path} cannot combine touch with priority_off; a touch "
+                "electrode has no digital edge for an interrupt."
+            )
+
+
+def _validate_key_matrix(device: DeviceConfig) -> None:
+    """Validate key positions against the matrix and reject pin-only options."""
+    matrix = device.key_matrix
+    keys = [clickable for clickable in device.clickables if clickable.matrix_key]
+    path = f"devices.{device.key}.key_matrix"
+    if matrix is None:
+        if keys:
+            fail(
+                f"devices.{device.key}.clickables.{keys[0].name}.key needs "
+                f"{path} to be declared."
+            )
+        return
+    if not keys:
+        fail(f"{path} is declared but no button sets a key.")
+    validate_unique([*matrix.rows, *matrix.columns], "pin", path, lambda pin: pin)
+    _validate_key_matrix_pins(device, [*matrix.rows, *matrix.columns], path)
+    validate_unique(
+        keys,
+        "key",
+        f"devices.{device.key}.clickables",
+        lambda clickable: clickable.matrix_key,
+    )
+    for clickable in keys:
+        row, column = clickable.matrix_key or (0, 0)
+        key_path = f"devices.{device.key}.clickables.{clickable.name}.key"
+        if row >= len(matrix.rows) or column >= len(matrix.columns):
+            fail(
+                f"{key_path} ({row}, {column}) lies outside the "
+                f"{len(matrix.rows)}x{len(matrix.columns)} matrix."
+            )
+        if clickable.touch or clickable.priority_off_targets:
+            fail(
+                f"{key_path} cannot combine with touch or priority_off; a "
+                "matrix key has neither its own pin nor its own interrupt."
+            )
+
+
+def _validate_key_matrix_pins(
+    device: DeviceConfig,
+    pins: list[str],
+    path: str,
+) -> None:
+    """Reject matrix lines that another interrupt-driven resource also uses.
+
+    The scan, 1-Wire, touch and occupancy interrupts all rewrite DDR bits, so
+    one pin cannot belong to two of them. The OC0B pin carries the compare
+    point that paces the scan; other boards are checked by the generated
+    `static_assert`.
+    """
+    owners = {
+        **{sensor.pin: "a 1-Wire bus" for sensor in device.temperature},
+        **{
+            clickable.pin: "a touch button"
+            for clickable in device.clickables
+            if clickable.touch
+        },
+        **{occupancy.pin: "an occupancy input" for occupancy in device.occupancy},
+    }
+    controllino = device.hardware_include.strip('<>"') == "Controllino.h"
+    for pin in pins:
+        if controllino and pin in CONTROLLINO_OC0B_PINS:
+            fail(
+                f"{path} pin {pin} is the OC0B pin; the Timer0 compare-B "
+                "match paces the scan."
+            )
+        if pin in owners:
+            fail(f"{path} pin {pin} is also used by {owners[pin]}.")
+
+
+def _validate_scan_slices(device: DeviceConfig) -> None:
+    """Reject scan slices that would leave a slice without buttons."""
+    if device.scan_slices > max(len(device.clickables), 1):
+        fail(
+            f"devices.{device.key}.scan_slices ({device.scan_slices}) cannot "
+            f"exceed the button count ({len(device.clickables)})."
+        )
+
+
+def _validate_encoders(device: DeviceConfig) -> None:
+    """Validate encoder pins and level links, and reject inert encoders."""
+    actuator_names = {actuator.name for actuator in device.actuators}
+    for encoder in device.encoders:
+        path = f"devices.{device.key}.encoders.{encoder.name}"
+        if encoder.pin_a == encoder.pin_b:
+            fail(f"{path}.pin_a and {path}.pin_b must be different pins.")
+        validate_target_set(encoder.level_targets, actuator_names, f"{path}.levels")
+        if not encoder.level_targets and not encoder.network:
+            fail(f"{path} must declare levels, network = true, or both.")
+
+
+def _validate_occupancy(device: DeviceConfig) -> None:
+    """Validate occupancy targets, which must own an auto-off hold time."""
+    actuators = {actuator.name: actuator for actuator in device.actuators}
+    for occupancy in device.occupancy:
+        path = f"devices.{device.key}.occupancy.{occupancy.name}"
+        validate_target_set(occupancy.targets, set(actuators), f"{path}.targets")
+        for target in occupancy.targets:
+            if actuators[target].auto_off_ms is None:
+                fail(
+                    f"{path}.targets lists {target!r}, which needs auto_off: "
+                    "it is the occupancy hold time."
+                )
+        if not occupancy.targets and not occupancy.network:
+            fail(f"{path} must declare targets, network = true, or both.")
+
+
+def one_wire_crc8(data: Sequence[int]) -> int:
+    """Return the Dallas/Maxim CRC8 used by ROM codes and scratchpads."""
+    crc = 0
+    for byte in data:
+        value = byte
+        for _ in range(8):
+            mix = (crc ^ value) & 0x01
+            crc >>= 1
+            if mix:
+                crc ^= 0x8C
+            value >>= 1
+    return crc
+
+
+def _validate_temperature(device: DeviceConfig) -> None:
+    """Validate ROM codes and the sensors sharing each 1-Wire pin."""
+    for sensor in device.temperature:
+        if sensor.rom is None:
+            continue
+        path = f"devices.{device.key}.temperature.{sensor.name}.rom"
+        if sensor.rom[0] not in ONE_WIRE_TEMPERATURE_FAMILIES:
+            fail(
+                f"{path} has family 0x{sensor.rom[0]:02X}; only DS18B20 (0x28) "
+                "and DS1822 (0x22) sensors are supported."
+            )
+        if one_wire_crc8(sensor.rom[:7]) != sensor.rom[7]:
+            fail(f"{path} fails its CRC check; copy the full 64-bit ROM code.")
+    for bus in one_wire_buses(device):
+        path = f"devices.{device.key}.temperature pin {bus[0].pin}"
+        if len(bus) > MAX_ONE_WIRE_SENSORS_PER_BUS:
+            fail(
+                f"{path} has {len(bus)} sensors; one 1-Wire bus supports at most "
+                f"{MAX_ONE_WIRE_SENSORS_PER_BUS}."
+            )
+        if len(bus) > 1:
+            for sensor in bus:
+                if sensor.rom is None:
+                    fail(
+                        f"devices.{device.key}.temperature.{sensor.name} shares "
+                        f"pin {sensor.pin} with other sensors and needs a rom."
+                    )
+
+
 def _validate_indicator_targets(device: DeviceConfig) -> None:
     """Validate indicator links and reject inert indicators."""
     actuator_names = {actuator.name for actuator in device.actuators}
@@ -217,7 +485,16 @@ def validate_device(device: DeviceConfig) -> None:
     _validate_unique_fields(device)
     _validate_actuator_options(device)
     _validate_clickable_targets(device)
+    _validate_priority_inputs(device)
+    _validate_touch_keys(device)
+    _validate_key_matrix(device)
+    _validate_scan_slices(device)
+    _validate_encoders(device)
+    _validate_occupancy(device)
+    _validate_temperature(device)
     _validate_indicator_targets(device)
+    if device.defines.get("CONFIG_COMPACT_CLICKABLES") is True:
+        compact_click_tick_shift(device)
 
 
 def validate_project(project: ProjectConfig) -> None:
@@ -264,7 +541,9 @@ def validate_project(project: ProjectConfig) -> None:
 def _has_effective_short_action(clickable: ClickableConfig) -> bool:
     """Return true when the short-click action can change at least one actuator."""
     return clickable.short_enabled and (
-        bool(clickable.short_targets) or bool(clickable.short_steps)
+        bool(clickable.short_targets)
+        or bool(clickable.short_steps)
+        or clickable.peer is not None
     )
 
 
@@ -308,6 +587,51 @@ def _effective_click_time_ms(clickable: ClickableConfig, action_name: str) -> in
     )
 
 
+def compact_click_ticks(time_ms: int, tick_shift: int) -> int:
+    """Return a compact threshold that never fires before ``time_ms``.
+
+    Ticks are shared by every clickable, so a press may start anywhere inside
+    the first tick. One extra tick absorbs that unknown phase.
+    """
+    tick_ms = 1 << tick_shift
+    return (time_ms + tick_ms - 1) // tick_ms + 1
+
+
+def compact_click_tick_shift(device: DeviceConfig) -> int:
+    """Return the finest tick whose thresholds fit the 8-bit compact press age."""
+    thresholds = [
+        _effective_click_time_ms(clickable, action_name)
+        for clickable in device.clickables
+        for action_name, action in (
+            ("long", clickable.long),
+            ("super_long", clickable.super_long),
+        )
+        if action.enabled
+    ]
+    longest_ms = max(thresholds, default=0)
+    tick_shift = next(
+        (
+            shift
+            for shift in range(MAX_COMPACT_CLICK_TICK_SHIFT + 1)
+            if compact_click_ticks(longest_ms, shift) <= UINT8_MAX
+        ),
+        None,
+    )
+    if tick_shift is None:
+        fail(
+            f"devices.{device.key}.features.compact_buttons cannot represent the "
+            f"{longest_ms} ms click threshold; keep every long/super-long "
+            f"threshold at or below {compact_click_max_ms()} ms or disable "
+            "compact_buttons."
+        )
+    return tick_shift
+
+
+def compact_click_max_ms() -> int:
+    """Return the longest threshold that still fits the coarsest compact tick."""
+    return (UINT8_MAX - 1) << MAX_COMPACT_CLICK_TICK_SHIFT
+
+
 def _validate_click_timing(device: DeviceConfig, clickable: ClickableConfig) -> None:
     """Reject timed click thresholds that would make event ordering ambiguous."""
     if not (clickable.long.enabled and clickable.super_long.enabled):